@@ -15,12 +15,14 @@ template <class Iterator, class Char, class Traits, class Allocator>
 class AddLexerActionHandler
 {
     typedef std::function<void (Iterator* begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol)> LexerActionFunction;
+    typedef void (*LexerActionPointer)( void* context, Iterator* begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol );
 
     Lexer<Iterator, Char, Traits, Allocator>* lexer_; ///< The Lexer to add handlers to.
 
     public:
         AddLexerActionHandler( Lexer<Iterator, Char, Traits, Allocator>* lexer );
         const AddLexerActionHandler& operator()( const char* identifier, LexerActionFunction function ) const;
+        const AddLexerActionHandler& operator()( const char* identifier, LexerActionPointer function, void* context ) const;
 };
 
 }
@@ -44,6 +44,18 @@ AddLexerActionHandler<Iterator, Char, Traits, Allocator>::operator()( const char
     return *this;
 }
 
+/**
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+const AddLexerActionHandler<Iterator, Char, Traits, Allocator>& 
+AddLexerActionHandler<Iterator, Char, Traits, Allocator>::operator()( const char* identifier, LexerActionPointer function, void* context ) const
+{
+    LALR_ASSERT( identifier );
+    LALR_ASSERT( lexer_ );
+    lexer_->set_action_handler( identifier, function, context );
+    return *this;
+}
+
 }
 
 #endif
@@ -8,22 +8,25 @@ namespace lalr
 {
 
 class ParserSymbol;
-template <class Iterator, class UserData, class Char, class Traits, class Allocator> class Parser;
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables> class Parser;
 
 /**
 // A helper that provides a convenient syntax for adding handlers to a %Parser.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
 class AddParserActionHandler
 {
-    typedef std::function<UserData (const lalr::ParserNode<UserData, Char, Traits, Allocator>* start, const lalr::ParserNode<UserData, Char, Traits, Allocator>* finish)> ParserActionFunction;
+    typedef std::function<UserData (lalr::ParserNode<UserData, Char, Traits, Allocator>* start, lalr::ParserNode<UserData, Char, Traits, Allocator>* finish)> ParserActionFunction;
+    typedef UserData (*ParserActionPointer)( void* context, lalr::ParserNode<UserData, Char, Traits, Allocator>* start, lalr::ParserNode<UserData, Char, Traits, Allocator>* finish );
 
-    Parser<Iterator, UserData, Char, Traits, Allocator>* parser_; ///< The Parser to add handlers to.
+    Parser<Iterator, UserData, Char, Traits, Allocator, Tables>* parser_; ///< The Parser to add handlers to.
 
     public:
-        AddParserActionHandler( Parser<Iterator, UserData, Char, Traits, Allocator>* parser );
+        AddParserActionHandler( Parser<Iterator, UserData, Char, Traits, Allocator, Tables>* parser );
         const AddParserActionHandler& default_action( ParserActionFunction function ) const;
+        const AddParserActionHandler& default_action( ParserActionPointer function, void* context ) const;
         const AddParserActionHandler& operator()( const char* identifier, ParserActionFunction function ) const;
+        const AddParserActionHandler& operator()( const char* identifier, ParserActionPointer function, void* context ) const;
 };
 
 }
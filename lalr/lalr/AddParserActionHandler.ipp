@@ -13,8 +13,8 @@ namespace lalr
 // @param parser
 //  The %Parser to add actions to (assumed not null).
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>::AddParserActionHandler( Parser<Iterator, UserData, Char, Traits, Allocator>* parser )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>::AddParserActionHandler( Parser<Iterator, UserData, Char, Traits, Allocator, Tables>* parser )
 : parser_( parser )
 {
     LALR_ASSERT( parser_ );
@@ -30,15 +30,36 @@ AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>::AddParserAc
 // @return
 //  This %AddParserActionHandler.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-const AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>& 
-AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>::default_action( ParserActionFunction function ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>& 
+AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>::default_action( ParserActionFunction function ) const
 {
     LALR_ASSERT( parser_ );
     parser_->set_default_action_handler( function );
     return *this;
 }
 
+/**
+// Set the plain function to call with \e context for the default action.
+//
+// @param function
+//  The function to call for the default action.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+//
+// @return
+//  This %AddParserActionHandler.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>& 
+AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>::default_action( ParserActionPointer function, void* context ) const
+{
+    LALR_ASSERT( parser_ );
+    parser_->set_default_action_handler( function, context );
+    return *this;
+}
+
 /**
 // Set the function to call when the %parser action \e identifier is taken.
 //
@@ -53,9 +74,9 @@ AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>::default_act
 // @return
 //  This AddParserActionHandler.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-const AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>& 
-AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>::operator()( const char* identifier, ParserActionFunction function ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>& 
+AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>::operator()( const char* identifier, ParserActionFunction function ) const
 {
     LALR_ASSERT( identifier );
     LALR_ASSERT( parser_ );
@@ -63,6 +84,32 @@ AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>::operator()(
     return *this;
 }
 
+/**
+// Set the plain function to call with \e context when the %parser action 
+// \e identifier is taken.
+//
+// @param identifier
+//  The identifier of the %parser action to assign a function to.
+//
+// @param function
+//  The function to call when the %parser action needs to be taken.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+//
+// @return
+//  This AddParserActionHandler.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>& 
+AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>::operator()( const char* identifier, ParserActionPointer function, void* context ) const
+{
+    LALR_ASSERT( identifier );
+    LALR_ASSERT( parser_ );
+    parser_->set_action_handler( identifier, function, context );
+    return *this;
+}
+
 }
 
 #endif
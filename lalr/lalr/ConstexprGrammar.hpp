@@ -0,0 +1,206 @@
+#ifndef LALR_CONSTEXPRGRAMMAR_HPP_INCLUDED
+#define LALR_CONSTEXPRGRAMMAR_HPP_INCLUDED
+
+#include "ConstexprGrammarCompiler.hpp"
+
+#if defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+
+#include "ParserAction.hpp"
+#include "ParserSymbol.hpp"
+#include "ParserTransition.hpp"
+#include "ParserState.hpp"
+#include "ParserStateMachine.hpp"
+#include "LexerState.hpp"
+#include "LexerTransition.hpp"
+#include "LexerStateMachine.hpp"
+#include <cstddef>
+#include <utility>
+
+namespace lalr
+{
+
+/**
+// A grammar passed as a string literal template argument.
+*/
+template <std::size_t N>
+class GrammarLiteral
+{
+public:
+    char text[N]; ///< The text of the grammar including its terminating null.
+
+    constexpr GrammarLiteral( const char (&literal)[N] )
+    : text()
+    {
+        for ( std::size_t i = 0; i < N; ++i )
+        {
+            text[i] = literal[i];
+        }
+    }
+
+    constexpr const char* begin() const
+    {
+        return text;
+    }
+
+    constexpr const char* end() const
+    {
+        return text + N - 1;
+    }
+};
+
+/**
+// The identifiers and lexemes of the grammar, actions, and symbols of a
+// grammar compiled during constant evaluation.
+*/
+template <ConstexprGrammarSizes Sizes>
+class ConstexprStrings
+{
+public:
+    char text[Sizes.strings_size]; ///< The null terminated strings in the order written by ConstexprGrammarCompiler::populate_strings().
+};
+
+/**
+// The tables of a state machine compiled from a grammar during constant
+// evaluation.
+//
+// The tables are sized from the ConstexprGrammarSizes of the grammar with
+// at least one element in each so that grammars without actions or
+// whitespace still have valid arrays.  The strings that the tables point to
+// are stored separately in constexpr_grammar_strings_v.
+*/
+template <ConstexprGrammarSizes Sizes>
+class ConstexprStateMachine
+{
+    static constexpr int at_least_one( int size )
+    {
+        return size > 0 ? size : 1;
+    }
+
+public:
+    ParserAction actions[at_least_one(Sizes.actions_size)]; ///< The parser actions.
+    ParserSymbol symbols[at_least_one(Sizes.symbols_size)]; ///< The symbols.
+    ParserTransition transitions[at_least_one(Sizes.transitions_size)]; ///< The parser transitions.
+    ParserState states[at_least_one(Sizes.states_size)]; ///< The parser states.
+    int transition_table[at_least_one(Sizes.states_size * Sizes.symbols_size)]; ///< The index of the transition from each state on each symbol or -1.
+    LexerTransition lexer_transitions[at_least_one(Sizes.lexer_transitions_size)]; ///< The lexer transitions.
+    LexerState lexer_states[at_least_one(Sizes.lexer_states_size)]; ///< The lexer states.
+    LexerTransition whitespace_lexer_transitions[at_least_one(Sizes.whitespace_lexer_transitions_size)]; ///< The whitespace lexer transitions.
+    LexerState whitespace_lexer_states[at_least_one(Sizes.whitespace_lexer_states_size)]; ///< The whitespace lexer states.
+    LexerStateMachine lexer_state_machine; ///< The lexer state machine.
+    LexerStateMachine whitespace_lexer_state_machine; ///< The whitespace lexer state machine.
+    ParserStateMachine parser_state_machine; ///< The parser state machine.
+};
+
+/**
+// Compile \e Grammar and return the sizes of its tables.
+*/
+template <GrammarLiteral Grammar>
+constexpr ConstexprGrammarSizes constexpr_grammar_sizes()
+{
+    ConstexprGrammarCompiler compiler;
+    compiler.compile( Grammar.begin(), Grammar.end() );
+    return compiler.sizes();
+}
+
+/**
+// Compile \e Grammar and return its strings.
+*/
+template <GrammarLiteral Grammar, ConstexprGrammarSizes Sizes>
+constexpr ConstexprStrings<Sizes> constexpr_strings()
+{
+    ConstexprGrammarCompiler compiler;
+    compiler.compile( Grammar.begin(), Grammar.end() );
+    ConstexprStrings<Sizes> strings{};
+    compiler.populate_strings( strings.text );
+    return strings;
+}
+
+/**
+// Compile \e Grammar and return its tables as they are when copied to
+// \e address with strings at \e strings.
+*/
+template <GrammarLiteral Grammar, ConstexprGrammarSizes Sizes>
+constexpr ConstexprStateMachine<Sizes> constexpr_state_machine( const ConstexprStateMachine<Sizes>* address, const char* strings )
+{
+    ConstexprGrammarCompiler compiler;
+    compiler.compile( Grammar.begin(), Grammar.end() );
+    ConstexprStateMachine<Sizes> state_machine{};
+    compiler.populate( &state_machine, address, strings );
+    return state_machine;
+}
+
+template <GrammarLiteral Grammar>
+inline constexpr ConstexprGrammarSizes constexpr_grammar_sizes_v = constexpr_grammar_sizes<Grammar>();
+
+template <GrammarLiteral Grammar>
+inline constexpr ConstexprStrings<constexpr_grammar_sizes_v<Grammar>> constexpr_strings_v = constexpr_strings<Grammar, constexpr_grammar_sizes_v<Grammar>>();
+
+/**
+// The strings of \e Grammar copied into a plain character array.
+//
+// The tables point into this array rather than into a class member because
+// compilers can see the terminating nulls of a plain array initialized
+// from a list of characters, but not those of an array member of a class
+// returned from constant evaluation, and warn about string functions
+// reading past its end (-Wstringop-overread and -Wformat-overflow).
+*/
+template <GrammarLiteral Grammar, std::size_t... Indices>
+inline constexpr char constexpr_grammar_strings_v[] = { constexpr_strings_v<Grammar>.text[Indices]... };
+
+/**
+// Get the address of constexpr_grammar_strings_v for \e Grammar.
+*/
+template <GrammarLiteral Grammar, std::size_t... Indices>
+constexpr const char* constexpr_grammar_strings( std::index_sequence<Indices...> )
+{
+    return constexpr_grammar_strings_v<Grammar, Indices...>;
+}
+
+template <GrammarLiteral Grammar>
+inline constexpr ConstexprStateMachine<constexpr_grammar_sizes_v<Grammar>> constexpr_state_machine_v = constexpr_state_machine<Grammar, constexpr_grammar_sizes_v<Grammar>>( &constexpr_state_machine_v<Grammar>, constexpr_grammar_strings<Grammar>(std::make_index_sequence<constexpr_grammar_sizes_v<Grammar>.strings_size>()) );
+
+/**
+// A grammar compiled to parser and lexer tables during compilation.
+//
+// The tables are constant initialized so nothing is generated at startup.
+// The parser state machine can be passed anywhere a ParserStateMachine
+// from GrammarCompiler is used and the class itself can be passed as the
+// Tables parameter of Parser to look transitions up in a constexpr table.
+//
+// ~~~c++
+// const lalr::ParserStateMachine* state_machine = lalr::ConstexprGrammar<R"(
+//     example {
+//         %whitespace "[ \t\r\n]*";
+//         list: list ',' item | item;
+//         item: "[a-z]+";
+//     }
+// )">::state_machine;
+// ~~~
+//
+// See ConstexprGrammarCompiler for the subset of grammars that can be
+// compiled this way.  Grammars that use unsupported features fail to
+// compile with a static_assert naming the feature; compile those with
+// GrammarCompiler or lalrc instead.
+*/
+template <GrammarLiteral Grammar>
+class ConstexprGrammar
+{
+    static_assert( (constexpr_grammar_sizes_v<Grammar>.unsupported & CONSTEXPR_GRAMMAR_LEXER_ACTIONS) == 0, "ConstexprGrammar doesn't support lexer actions (:action: in regular expressions)" );
+    static_assert( (constexpr_grammar_sizes_v<Grammar>.unsupported & CONSTEXPR_GRAMMAR_NEGATIVE_CHARACTER_CLASSES) == 0, "ConstexprGrammar doesn't support character class names in negative bracket expressions" );
+    static_assert( (constexpr_grammar_sizes_v<Grammar>.unsupported & CONSTEXPR_GRAMMAR_NUMERIC_LITERAL_ESCAPES) == 0, "ConstexprGrammar doesn't support escaped numeric characters in literals" );
+
+    static constexpr const ConstexprStateMachine<constexpr_grammar_sizes_v<Grammar>>& tables = constexpr_state_machine_v<Grammar>;
+
+public:
+    static constexpr int states_size = constexpr_grammar_sizes_v<Grammar>.states_size; ///< The number of parser states.
+    static constexpr int symbols_size = constexpr_grammar_sizes_v<Grammar>.symbols_size; ///< The number of symbols.
+    static constexpr int transitions_size = constexpr_grammar_sizes_v<Grammar>.transitions_size; ///< The number of parser transitions.
+    static constexpr const int* transition_table = tables.transition_table; ///< The index of the transition from each state on each symbol or -1.
+    static constexpr const ParserStateMachine* state_machine = &tables.parser_state_machine; ///< The parser state machine.
+};
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,263 @@
+#ifndef LALR_CONSTEXPRGRAMMARCOMPILER_HPP_INCLUDED
+#define LALR_CONSTEXPRGRAMMARCOMPILER_HPP_INCLUDED
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Associativity.hpp"
+#include "LexemeType.hpp"
+#include "RegexNodeType.hpp"
+#include "RegexTokenType.hpp"
+#include "SymbolType.hpp"
+#include "TransitionType.hpp"
+
+#if defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+
+namespace lalr
+{
+
+/**
+// The features of grammars that a ConstexprGrammarCompiler doesn't support.
+*/
+enum ConstexprGrammarUnsupported
+{
+    CONSTEXPR_GRAMMAR_LEXER_ACTIONS = 0x01, ///< Lexer actions (`:action:`) in regular expressions.
+    CONSTEXPR_GRAMMAR_NEGATIVE_CHARACTER_CLASSES = 0x02, ///< Character class names in negative bracket expressions.
+    CONSTEXPR_GRAMMAR_NUMERIC_LITERAL_ESCAPES = 0x04 ///< Escaped numeric characters in literals.
+};
+
+/**
+// The sizes of the tables of a state machine compiled by a
+// ConstexprGrammarCompiler.
+*/
+class ConstexprGrammarSizes
+{
+public:
+    int strings_size; ///< The number of characters in the identifiers and lexemes including their terminating nulls.
+    int actions_size; ///< The number of parser actions.
+    int symbols_size; ///< The number of symbols.
+    int transitions_size; ///< The number of parser transitions.
+    int states_size; ///< The number of parser states.
+    int lexer_transitions_size; ///< The number of transitions in the lexer state machine.
+    int lexer_states_size; ///< The number of states in the lexer state machine.
+    int whitespace_lexer_transitions_size; ///< The number of transitions in the whitespace lexer state machine.
+    int whitespace_lexer_states_size; ///< The number of states in the whitespace lexer state machine or 0 if there is no whitespace lexer state machine.
+    int unsupported; ///< The ConstexprGrammarUnsupported features that the grammar uses or 0 if the tables can be used.
+};
+
+/**
+// Compiles a grammar into parser and lexer tables during constant
+// evaluation.
+//
+// Parses the same syntax as GrammarParser and generates the same LALR(1)
+// parser tables as GrammarGenerator using std::vector and std::string in
+// place of the sets, maps, and shared pointers that can't be used in
+// constant evaluation.  Lexers are generated from the same positions as
+// RegexGenerator and their states are minimized by partition refinement.
+//
+// Only a subset of grammars is supported.  Lexer actions (`:action:` in
+// regular expressions), character class names in negative bracket
+// expressions, and escaped numeric characters in literals (which
+// RegexSyntaxTree::escape() doesn't support either) aren't supported.
+// Grammars that use them still compile but the features that they use are
+// returned in ConstexprGrammarSizes::unsupported so that ConstexprGrammar
+// can reject them with a static_assert that names each feature.  Errors,
+// including conflicts, fail constant evaluation with a call to
+// constexpr_grammar_error() that names the error rather than being
+// reported to an ErrorPolicy.
+*/
+class ConstexprGrammarCompiler
+{
+    struct Symbol
+    {
+        std::string lexeme;
+        std::string identifier;
+        LexemeType lexeme_type;
+        SymbolType symbol_type;
+        int line;
+        int precedence;
+        Associativity associativity;
+        std::vector<int> productions;
+        bool nullable;
+    };
+
+    struct Production
+    {
+        int symbol;
+        std::vector<int> symbols;
+        int action;
+        int precedence_symbol;
+    };
+
+    struct Item
+    {
+        int production;
+        int position;
+        std::vector<char> lookahead_symbols;
+    };
+
+    struct Transition
+    {
+        int symbol;
+        int state;
+        int reduced_symbol;
+        int reduced_length;
+        int precedence;
+        int action;
+        int production;
+        TransitionType type;
+    };
+
+    struct State
+    {
+        std::vector<Item> items;
+        std::vector<Transition> transitions;
+        int default_reduction;
+    };
+
+    struct Token
+    {
+        RegexTokenType type;
+        int line;
+        int symbol;
+        std::string lexeme;
+    };
+
+    struct RegexNode
+    {
+        RegexNodeType type;
+        int begin_character;
+        int end_character;
+        int token;
+        int left;
+        int right;
+        bool nullable;
+        std::vector<int> first_positions;
+        std::vector<int> last_positions;
+        std::vector<int> follow_positions;
+    };
+
+    struct RegexSyntaxTree
+    {
+        std::vector<RegexNode> nodes;
+        std::vector<int> stack;
+        const char* position;
+        const char* end;
+        int unsupported;
+    };
+
+    struct RegexTransition
+    {
+        int begin;
+        int end;
+        int state;
+    };
+
+    struct RegexState
+    {
+        std::vector<int> positions;
+        std::vector<RegexTransition> transitions;
+        int symbol;
+    };
+
+    struct RegexStateMachine
+    {
+        std::vector<RegexState> states;
+        int transitions_size;
+        int unsupported;
+    };
+
+    std::string identifier_; ///< The identifier of the grammar.
+    std::vector<std::string> actions_; ///< The identifiers of the parser actions.
+    std::vector<Symbol> symbols_; ///< The symbols of the grammar.
+    std::vector<Production> productions_; ///< The productions of the grammar.
+    std::vector<State> states_; ///< The parser states.
+    std::vector<std::string> whitespace_tokens_; ///< The regular expressions matched by the whitespace lexer.
+    RegexStateMachine lexer_; ///< The lexer state machine.
+    RegexStateMachine whitespace_lexer_; ///< The whitespace lexer state machine.
+    int start_symbol_; ///< The index of the start symbol.
+    int end_symbol_; ///< The index of the end symbol.
+    int error_symbol_; ///< The index of the error symbol.
+    const char* position_; ///< The current position while parsing the grammar.
+    const char* end_; ///< One past the last character of the grammar.
+    int line_; ///< The current line while parsing the grammar.
+    std::string lexeme_; ///< The most recently matched lexeme.
+    int associativity_; ///< The associativity of the active precedence directive.
+    int precedence_; ///< The precedence of the most recent precedence directive.
+    bool active_precedence_directive_; ///< True when the next symbol sets the precedence of the active production.
+    int active_symbol_; ///< The symbol whose productions are being parsed or -1.
+    int active_production_; ///< The production being parsed or -1.
+
+public:
+    constexpr ConstexprGrammarCompiler();
+    constexpr void compile( const char* begin, const char* end );
+    constexpr ConstexprGrammarSizes sizes() const;
+    constexpr void populate_strings( char* strings ) const;
+    template <class StateMachine> constexpr void populate( StateMachine* state_machine, const StateMachine* address, const char* strings ) const;
+
+private:
+    constexpr void parse_grammar();
+    constexpr bool match_statement();
+    constexpr bool match_symbol();
+    constexpr void match_expressions();
+    constexpr bool match_literal();
+    constexpr bool match_regex();
+    constexpr bool match_identifier();
+    constexpr void match_whitespace_and_comments();
+    constexpr bool match( const char* keyword );
+    constexpr bool match_without_skipping_whitespace( const char* lexeme );
+    constexpr void expect( const char* lexeme );
+    constexpr void begin_directive( Associativity associativity );
+    constexpr void add_symbol_to_directive_or_production( int symbol );
+    constexpr int add_symbol( const std::string& lexeme, int line, LexemeType lexeme_type, SymbolType symbol_type );
+    constexpr int add_production( int symbol );
+    constexpr int add_action( const std::string& identifier );
+    constexpr void generate();
+    constexpr void check_for_errors() const;
+    constexpr void calculate_implicit_terminal_symbols();
+    constexpr void calculate_nullable();
+    constexpr void calculate_precedence_of_productions();
+    constexpr void generate_states();
+    constexpr void closure( State* state ) const;
+    constexpr int find_state_by_kernel( const State& state ) const;
+    constexpr void generate_lookaheads();
+    constexpr void traverse( int element, const std::vector<std::vector<int>>& relation, std::vector<std::vector<char>>* sets, std::vector<int>* stack, std::vector<int>* depths ) const;
+    constexpr void digraph( const std::vector<std::vector<int>>& relation, std::vector<std::vector<char>>* sets ) const;
+    constexpr void generate_reduce_transitions();
+    constexpr void generate_reduce_transition( State* state, int symbol, int production );
+    constexpr void generate_default_reductions();
+    constexpr RegexStateMachine generate_lexer( const std::vector<Token>& tokens ) const;
+    constexpr int precedence_of_production( int production ) const;
+    constexpr int goto_state( int state, int symbol ) const;
+
+    static constexpr std::string calculate_identifier( const std::string& lexeme, SymbolType symbol_type );
+    static constexpr bool is_alpha( int character );
+    static constexpr bool is_digit( int character );
+    static constexpr bool is_space( int character );
+    static constexpr bool is_xdigit( int character );
+    static constexpr void insert_positions( std::vector<int>* positions, const std::vector<int>& other_positions );
+    static constexpr void insert_symbols( std::vector<char>* symbols, const std::vector<char>& other_symbols );
+    static constexpr void insert_characters( std::vector<int>* ranges, int begin, int end );
+    static constexpr void erase_characters( std::vector<int>* ranges, int begin, int end );
+    static constexpr void insert_character_class( std::vector<int>* ranges, const char* name );
+    static constexpr void minimize_lexer( RegexStateMachine* lexer );
+    static constexpr int escape_literal( const std::string& literal, std::size_t* position, int* unsupported );
+    static constexpr int escape_regex( const char* begin, const char* end );
+    static constexpr void regex_node( RegexSyntaxTree* syntax_tree, RegexNodeType type, int begin_character, int end_character, int token );
+    static constexpr bool match_or_expression( RegexSyntaxTree* syntax_tree );
+    static constexpr bool match_cat_expression( RegexSyntaxTree* syntax_tree );
+    static constexpr bool match_postfix_expression( RegexSyntaxTree* syntax_tree );
+    static constexpr bool match_base_expression( RegexSyntaxTree* syntax_tree );
+    static constexpr bool match_regex_character( RegexSyntaxTree* syntax_tree, int* character );
+    static constexpr bool match_regex_lexeme( RegexSyntaxTree* syntax_tree, const char* lexeme );
+};
+
+inline void constexpr_grammar_error( const char* message );
+
+}
+
+#include "ConstexprGrammarCompiler.ipp"
+
+#endif
+
+#endif
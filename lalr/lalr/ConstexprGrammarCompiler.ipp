@@ -0,0 +1,2203 @@
+//
+// ConstexprGrammarCompiler.ipp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#ifndef LALR_CONSTEXPRGRAMMARCOMPILER_IPP_INCLUDED
+#define LALR_CONSTEXPRGRAMMARCOMPILER_IPP_INCLUDED
+
+#include "ConstexprGrammarCompiler.hpp"
+#include "ParserAction.hpp"
+#include "ParserSymbol.hpp"
+#include "ParserTransition.hpp"
+#include "ParserState.hpp"
+#include "ParserStateMachine.hpp"
+#include "LexerState.hpp"
+#include "LexerTransition.hpp"
+#include "LexerStateMachine.hpp"
+#include "assert.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+
+namespace lalr
+{
+
+/**
+// Fail the constant evaluation of a ConstexprGrammarCompiler.
+//
+// This function isn't constexpr so calling it while compiling a grammar
+// during constant evaluation is a compile-time error whose diagnostic
+// includes \e message.
+//
+// @param message
+//  A description of the error.
+*/
+inline void constexpr_grammar_error( const char* message )
+{
+    LALR_ASSERT( message && false );
+    (void) message;
+}
+
+/**
+// Constructor.
+*/
+constexpr ConstexprGrammarCompiler::ConstexprGrammarCompiler()
+: identifier_(),
+  actions_(),
+  symbols_(),
+  productions_(),
+  states_(),
+  whitespace_tokens_(),
+  lexer_{std::vector<RegexState>(), 0, 0},
+  whitespace_lexer_{std::vector<RegexState>(), 0, 0},
+  start_symbol_( -1 ),
+  end_symbol_( -1 ),
+  error_symbol_( -1 ),
+  position_( nullptr ),
+  end_( nullptr ),
+  line_( 1 ),
+  lexeme_(),
+  associativity_( ASSOCIATE_NULL ),
+  precedence_( 0 ),
+  active_precedence_directive_( false ),
+  active_symbol_( -1 ),
+  active_production_( -1 )
+{
+}
+
+/**
+// Compile the grammar in [\e begin, \e end).
+//
+// @param begin
+//  The first character of the grammar to compile.
+//
+// @param end
+//  One past the last character of the grammar to compile.
+*/
+constexpr void ConstexprGrammarCompiler::compile( const char* begin, const char* end )
+{
+    LALR_ASSERT( begin && end && begin <= end );
+    position_ = begin;
+    end_ = end;
+    line_ = 1;
+    start_symbol_ = add_symbol( ".start", 0, LEXEME_NULL, SYMBOL_NON_TERMINAL );
+    end_symbol_ = add_symbol( ".end", 0, LEXEME_NULL, SYMBOL_END );
+    error_symbol_ = add_symbol( ".error", 0, LEXEME_NULL, SYMBOL_NULL );
+    parse_grammar();
+    generate();
+
+    std::vector<Token> tokens;
+    for ( int i = 0; i < int(symbols_.size()); ++i )
+    {
+        const Symbol& symbol = symbols_[i];
+        if ( symbol.symbol_type == SYMBOL_TERMINAL )
+        {
+            RegexTokenType token_type = symbol.lexeme_type == LEXEME_REGULAR_EXPRESSION ? TOKEN_REGULAR_EXPRESSION : TOKEN_LITERAL;
+            tokens.push_back( Token{token_type, symbol.line, i, symbol.lexeme} );
+        }
+    }
+    lexer_ = generate_lexer( tokens );
+
+    if ( !whitespace_tokens_.empty() )
+    {
+        tokens.clear();
+        for ( const std::string& whitespace_token : whitespace_tokens_ )
+        {
+            tokens.push_back( Token{TOKEN_REGULAR_EXPRESSION, 0, -1, whitespace_token} );
+        }
+        whitespace_lexer_ = generate_lexer( tokens );
+    }
+}
+
+/**
+// Get the sizes of the tables for the most recently compiled grammar.
+//
+// @return
+//  The sizes of the tables that populate() fills in.
+*/
+constexpr ConstexprGrammarSizes ConstexprGrammarCompiler::sizes() const
+{
+    int strings_size = int(identifier_.size()) + 1;
+    for ( const std::string& action : actions_ )
+    {
+        strings_size += int(action.size()) + 1;
+    }
+    for ( const Symbol& symbol : symbols_ )
+    {
+        strings_size += int(symbol.identifier.size()) + 1 + int(symbol.lexeme.size()) + 1;
+    }
+
+    int transitions_size = 0;
+    for ( const State& state : states_ )
+    {
+        transitions_size += int(state.transitions.size());
+    }
+
+    return ConstexprGrammarSizes{
+        strings_size,
+        int(actions_.size()),
+        int(symbols_.size()),
+        transitions_size,
+        int(states_.size()),
+        lexer_.transitions_size,
+        int(lexer_.states.size()),
+        whitespace_lexer_.transitions_size,
+        int(whitespace_lexer_.states.size()),
+        lexer_.unsupported | whitespace_lexer_.unsupported
+    };
+}
+
+/**
+// Populate the identifiers and lexemes of the grammar, actions, and symbols
+// from the most recently compiled grammar.
+//
+// The strings are null terminated and stored in the order that populate()
+// expects them.
+//
+// @param strings
+//  The array of ConstexprGrammarSizes::strings_size characters to populate
+//  (assumed not null).
+*/
+constexpr void ConstexprGrammarCompiler::populate_strings( char* strings ) const
+{
+    LALR_ASSERT( strings );
+    auto add_string = [&]( const std::string& string )
+    {
+        for ( char character : string )
+        {
+            *strings = character;
+            ++strings;
+        }
+        *strings = 0;
+        ++strings;
+    };
+
+    add_string( identifier_ );
+    for ( const std::string& action : actions_ )
+    {
+        add_string( action );
+    }
+    for ( const Symbol& symbol : symbols_ )
+    {
+        add_string( symbol.identifier );
+        add_string( symbol.lexeme );
+    }
+}
+
+/**
+// Populate the tables of \e state_machine from the most recently compiled
+// grammar.
+//
+// The tables refer to each other through pointers into \e address rather
+// than into \e state_machine so that \e state_machine can be returned from
+// constant evaluation and used to initialize the object at \e address.
+//
+// @param state_machine
+//  The tables to populate; a ConstexprStateMachine whose sizes are those
+//  returned by sizes() (assumed not null).
+//
+// @param address
+//  The address of the object that the tables are copied to.
+//
+// @param strings
+//  The address of the strings populated by populate_strings().
+*/
+template <class StateMachine>
+constexpr void ConstexprGrammarCompiler::populate( StateMachine* state_machine, const StateMachine* address, const char* strings ) const
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( address );
+    LALR_ASSERT( strings );
+
+    auto add_string = [&]( const std::string& string ) -> const char*
+    {
+        const char* added_string = strings;
+        strings += string.size() + 1;
+        return added_string;
+    };
+
+    const char* identifier = add_string( identifier_ );
+
+    const int actions_size = int(actions_.size());
+    for ( int i = 0; i < actions_size; ++i )
+    {
+        state_machine->actions[i] = ParserAction{i, add_string(actions_[i])};
+    }
+
+    const int symbols_size = int(symbols_.size());
+    for ( int i = 0; i < symbols_size; ++i )
+    {
+        const Symbol& symbol = symbols_[i];
+        const char* symbol_identifier = add_string( symbol.identifier );
+        state_machine->symbols[i] = ParserSymbol{i, symbol_identifier, add_string(symbol.lexeme), symbol.symbol_type};
+    }
+
+    const int states_size = int(states_.size());
+    for ( int i = 0; i < states_size * symbols_size; ++i )
+    {
+        state_machine->transition_table[i] = -1;
+    }
+
+    int transition_index = 0;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const State& state = states_[i];
+        const ParserTransition* default_reduction = state.default_reduction >= 0 ? &address->transitions[transition_index + state.default_reduction] : nullptr;
+        state_machine->states[i] = ParserState{i, int(state.transitions.size()), &address->transitions[transition_index], default_reduction};
+        for ( const Transition& transition : state.transitions )
+        {
+            state_machine->transitions[transition_index] = ParserTransition{
+                &address->symbols[transition.symbol],
+                transition.state >= 0 ? &address->states[transition.state] : nullptr,
+                transition.reduced_symbol >= 0 ? &address->symbols[transition.reduced_symbol] : nullptr,
+                transition.reduced_length,
+                transition.precedence,
+                transition.action,
+                transition.production,
+                transition.type,
+                transition_index
+            };
+            state_machine->transition_table[i * symbols_size + transition.symbol] = transition_index;
+            ++transition_index;
+        }
+    }
+
+    auto populate_lexer = [&]( const RegexStateMachine& lexer, LexerTransition* transitions, LexerState* states, const LexerTransition* transitions_address, const LexerState* states_address ) -> LexerStateMachine
+    {
+        int lexer_transition_index = 0;
+        const int lexer_states_size = int(lexer.states.size());
+        for ( int i = 0; i < lexer_states_size; ++i )
+        {
+            const RegexState& state = lexer.states[i];
+            const void* symbol = state.symbol >= 0 ? &address->symbols[state.symbol] : nullptr;
+            states[i] = LexerState{i, int(state.transitions.size()), &transitions_address[lexer_transition_index], symbol};
+            for ( const RegexTransition& transition : state.transitions )
+            {
+                transitions[lexer_transition_index] = LexerTransition{transition.begin, transition.end, &states_address[transition.state], nullptr};
+                ++lexer_transition_index;
+            }
+        }
+        return LexerStateMachine{0, lexer.transitions_size, lexer_states_size, nullptr, transitions_address, states_address, states_address, 0, nullptr, nullptr, nullptr, nullptr};
+    };
+
+    state_machine->lexer_state_machine = populate_lexer( lexer_, state_machine->lexer_transitions, state_machine->lexer_states, address->lexer_transitions, address->lexer_states );
+    const LexerStateMachine* whitespace_lexer_state_machine = nullptr;
+    if ( !whitespace_lexer_.states.empty() )
+    {
+        state_machine->whitespace_lexer_state_machine = populate_lexer( whitespace_lexer_, state_machine->whitespace_lexer_transitions, state_machine->whitespace_lexer_states, address->whitespace_lexer_transitions, address->whitespace_lexer_states );
+        whitespace_lexer_state_machine = &address->whitespace_lexer_state_machine;
+    }
+
+    state_machine->parser_state_machine = ParserStateMachine{
+        identifier,
+        actions_size,
+        symbols_size,
+        transition_index,
+        states_size,
+        address->actions,
+        address->symbols,
+        address->transitions,
+        address->states,
+        &address->symbols[start_symbol_],
+        &address->symbols[end_symbol_],
+        &address->symbols[error_symbol_],
+        &address->states[0],
+        &address->lexer_state_machine,
+        whitespace_lexer_state_machine,
+        address->transition_table,
+        0,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr
+    };
+}
+
+/**
+// Parse the grammar as GrammarParser does and build its symbols and
+// productions as Grammar does.
+*/
+constexpr void ConstexprGrammarCompiler::parse_grammar()
+{
+    if ( !match_identifier() )
+    {
+        constexpr_grammar_error( "Syntax error in grammar" );
+    }
+    identifier_ = lexeme_;
+    expect( "{" );
+    while ( match_statement() )
+    {
+    }
+    expect( "}" );
+    match_whitespace_and_comments();
+    if ( position_ != end_ )
+    {
+        constexpr_grammar_error( "Syntax error in grammar" );
+    }
+}
+
+constexpr bool ConstexprGrammarCompiler::match_statement()
+{
+    if ( match("%left") || match("%right") || match("%none") )
+    {
+        begin_directive( lexeme_ == "%left" ? ASSOCIATE_LEFT : lexeme_ == "%right" ? ASSOCIATE_RIGHT : ASSOCIATE_NONE );
+        while ( match_symbol() )
+        {
+        }
+        expect( ";" );
+        return true;
+    }
+    else if ( match("%whitespace") )
+    {
+        associativity_ = ASSOCIATE_NULL;
+        active_precedence_directive_ = false;
+        active_production_ = -1;
+        active_symbol_ = -1;
+        if ( match_regex() )
+        {
+            whitespace_tokens_.push_back( lexeme_ );
+        }
+        expect( ";" );
+        return true;
+    }
+    else if ( match_identifier() )
+    {
+        associativity_ = ASSOCIATE_NULL;
+        active_precedence_directive_ = false;
+        active_production_ = -1;
+        active_symbol_ = add_symbol( lexeme_, line_, LEXEME_NULL, SYMBOL_NON_TERMINAL );
+        expect( ":" );
+        match_expressions();
+        expect( ";" );
+        active_production_ = -1;
+        active_symbol_ = -1;
+        return true;
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_symbol()
+{
+    if ( match("error") )
+    {
+        if ( associativity_ != ASSOCIATE_NULL )
+        {
+            symbols_[error_symbol_].associativity = Associativity(associativity_);
+            symbols_[error_symbol_].precedence = precedence_;
+        }
+        else if ( active_symbol_ >= 0 )
+        {
+            if ( active_production_ < 0 )
+            {
+                active_production_ = add_production( active_symbol_ );
+            }
+            productions_[active_production_].symbols.push_back( error_symbol_ );
+        }
+        return true;
+    }
+    else if ( match_literal() )
+    {
+        add_symbol_to_directive_or_production( add_symbol(lexeme_, line_, LEXEME_LITERAL, SYMBOL_TERMINAL) );
+        return true;
+    }
+    else if ( match_regex() )
+    {
+        add_symbol_to_directive_or_production( add_symbol(lexeme_, line_, LEXEME_REGULAR_EXPRESSION, SYMBOL_TERMINAL) );
+        return true;
+    }
+    else if ( match_identifier() )
+    {
+        add_symbol_to_directive_or_production( add_symbol(lexeme_, line_, LEXEME_NULL, SYMBOL_NON_TERMINAL) );
+        return true;
+    }
+    return false;
+}
+
+constexpr void ConstexprGrammarCompiler::match_expressions()
+{
+    bool expression = true;
+    while ( expression )
+    {
+        while ( match_symbol() )
+        {
+        }
+
+        if ( match("%precedence") )
+        {
+            active_precedence_directive_ = active_symbol_ >= 0;
+            match_symbol();
+        }
+
+        if ( match("[") )
+        {
+            if ( match_identifier() )
+            {
+                if ( active_production_ < 0 )
+                {
+                    active_production_ = add_production( active_symbol_ );
+                }
+                productions_[active_production_].action = add_action( lexeme_ );
+                active_production_ = -1;
+            }
+            expect( "]" );
+        }
+        else
+        {
+            if ( active_production_ < 0 )
+            {
+                active_production_ = add_production( active_symbol_ );
+            }
+            active_production_ = -1;
+        }
+
+        expression = match( "|" );
+    }
+}
+
+constexpr bool ConstexprGrammarCompiler::match_literal()
+{
+    match_whitespace_and_comments();
+    if ( match_without_skipping_whitespace("'") )
+    {
+        bool escaped = false;
+        const char* position = position_;
+        while ( position != end_ && (*position != '\'' || escaped) )
+        {
+            escaped = *position == '\\';
+            ++position;
+        }
+        std::string lexeme( position_, position );
+        position_ = position;
+        expect( "'" );
+        lexeme_ = lexeme;
+        return true;
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_regex()
+{
+    match_whitespace_and_comments();
+    if ( match_without_skipping_whitespace("\"") )
+    {
+        bool escaped = false;
+        const char* position = position_;
+        while ( position != end_ && (*position != '"' || escaped) )
+        {
+            escaped = *position == '\\';
+            ++position;
+        }
+        std::string lexeme( position_, position );
+        position_ = position;
+        expect( "\"" );
+        lexeme_ = lexeme;
+        return true;
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_identifier()
+{
+    match_whitespace_and_comments();
+    const char* position = position_;
+    if ( position != end_ && (is_alpha(*position) || is_digit(*position) || *position == '_') )
+    {
+        ++position;
+        while ( position != end_ && (is_alpha(*position) || is_digit(*position) || *position == '_') )
+        {
+            ++position;
+        }
+        lexeme_.assign( position_, position );
+        position_ = position;
+        return true;
+    }
+    return false;
+}
+
+constexpr void ConstexprGrammarCompiler::match_whitespace_and_comments()
+{
+    bool matched = true;
+    while ( matched )
+    {
+        matched = false;
+        if ( position_ != end_ && is_space(*position_) )
+        {
+            while ( position_ != end_ && is_space(*position_) )
+            {
+                if ( *position_ == '\n' || *position_ == '\r' )
+                {
+                    ++line_;
+                }
+                ++position_;
+            }
+            matched = true;
+        }
+        else if ( match_without_skipping_whitespace("//") )
+        {
+            bool done = false;
+            while ( position_ != end_ && !done )
+            {
+                done = *position_ == '\n' || *position_ == '\r';
+                ++position_;
+            }
+            if ( position_ != end_ && (*position_ == '\n' || *position_ == '\r') )
+            {
+                char newline = *position_;
+                ++position_;
+                if ( position_ != end_ && (*position_ == '\n' || *position_ == '\r') && *position_ != newline )
+                {
+                    ++position_;
+                }
+            }
+            matched = true;
+        }
+        else if ( match_without_skipping_whitespace("/*") )
+        {
+            bool done = false;
+            while ( position_ != end_ && !done )
+            {
+                if ( *position_ == '*' )
+                {
+                    ++position_;
+                    done = position_ != end_ && *position_ == '/';
+                }
+                ++position_;
+            }
+            if ( position_ > end_ )
+            {
+                position_ = end_;
+            }
+            matched = true;
+        }
+    }
+}
+
+constexpr bool ConstexprGrammarCompiler::match( const char* keyword )
+{
+    match_whitespace_and_comments();
+    return match_without_skipping_whitespace( keyword );
+}
+
+constexpr bool ConstexprGrammarCompiler::match_without_skipping_whitespace( const char* lexeme )
+{
+    const char* position = position_;
+    const char* character = lexeme;
+    while ( position != end_ && *character != 0 && *position == *character )
+    {
+        ++position;
+        ++character;
+    }
+    if ( *character == 0 )
+    {
+        lexeme_.assign( position_, position );
+        position_ = position;
+        return true;
+    }
+    return false;
+}
+
+constexpr void ConstexprGrammarCompiler::expect( const char* lexeme )
+{
+    if ( !match(lexeme) )
+    {
+        constexpr_grammar_error( "Syntax error in grammar" );
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::begin_directive( Associativity associativity )
+{
+    associativity_ = associativity;
+    ++precedence_;
+    active_precedence_directive_ = false;
+    active_production_ = -1;
+    active_symbol_ = -1;
+}
+
+constexpr void ConstexprGrammarCompiler::add_symbol_to_directive_or_production( int symbol )
+{
+    if ( associativity_ != ASSOCIATE_NULL )
+    {
+        symbols_[symbol].associativity = Associativity(associativity_);
+        symbols_[symbol].precedence = precedence_;
+    }
+    else if ( active_symbol_ >= 0 )
+    {
+        if ( active_production_ < 0 )
+        {
+            active_production_ = add_production( active_symbol_ );
+        }
+        if ( active_precedence_directive_ )
+        {
+            productions_[active_production_].precedence_symbol = symbol;
+            active_precedence_directive_ = false;
+        }
+        else
+        {
+            productions_[active_production_].symbols.push_back( symbol );
+        }
+    }
+}
+
+constexpr int ConstexprGrammarCompiler::add_symbol( const std::string& lexeme, int line, LexemeType lexeme_type, SymbolType symbol_type )
+{
+    for ( int i = 0; i < int(symbols_.size()); ++i )
+    {
+        if ( symbols_[i].lexeme == lexeme && symbols_[i].symbol_type == symbol_type )
+        {
+            return i;
+        }
+    }
+    symbols_.push_back( Symbol{lexeme, std::string(), lexeme_type, symbol_type, line, 0, ASSOCIATE_NULL, std::vector<int>(), false} );
+    return int(symbols_.size()) - 1;
+}
+
+constexpr int ConstexprGrammarCompiler::add_production( int symbol )
+{
+    LALR_ASSERT( symbol >= 0 );
+    if ( productions_.empty() )
+    {
+        productions_.push_back( Production{start_symbol_, std::vector<int>(1, symbol), -1, -1} );
+        symbols_[start_symbol_].productions.push_back( 0 );
+    }
+    productions_.push_back( Production{symbol, std::vector<int>(), -1, -1} );
+    symbols_[symbol].productions.push_back( int(productions_.size()) - 1 );
+    return int(productions_.size()) - 1;
+}
+
+constexpr int ConstexprGrammarCompiler::add_action( const std::string& identifier )
+{
+    for ( int i = 0; i < int(actions_.size()); ++i )
+    {
+        if ( actions_[i] == identifier )
+        {
+            return i;
+        }
+    }
+    actions_.push_back( identifier );
+    return int(actions_.size()) - 1;
+}
+
+/**
+// Generate the parser states as GrammarGenerator::generate() does.
+*/
+constexpr void ConstexprGrammarCompiler::generate()
+{
+    for ( Symbol& symbol : symbols_ )
+    {
+        symbol.identifier = calculate_identifier( symbol.lexeme, symbol.symbol_type );
+    }
+    check_for_errors();
+    for ( Symbol& symbol : symbols_ )
+    {
+        if ( symbol.symbol_type == SYMBOL_NULL )
+        {
+            symbol.symbol_type = symbol.productions.empty() ? SYMBOL_TERMINAL : SYMBOL_NON_TERMINAL;
+        }
+    }
+    calculate_implicit_terminal_symbols();
+    calculate_nullable();
+    calculate_precedence_of_productions();
+    generate_states();
+}
+
+constexpr void ConstexprGrammarCompiler::check_for_errors() const
+{
+    for ( int i = 0; i < int(symbols_.size()); ++i )
+    {
+        const Symbol& symbol = symbols_[i];
+        if ( symbol.symbol_type == SYMBOL_NON_TERMINAL && symbol.productions.empty() && symbol.precedence <= 0 )
+        {
+            constexpr_grammar_error( "Undefined symbol in grammar" );
+        }
+
+        if ( i != start_symbol_ && i != end_symbol_ && i != error_symbol_ )
+        {
+            int references = 0;
+            for ( const Production& production : productions_ )
+            {
+                for ( int production_symbol : production.symbols )
+                {
+                    references += production_symbol == i ? 1 : 0;
+                }
+                references += production.precedence_symbol == i ? 1 : 0;
+            }
+            if ( references == 0 )
+            {
+                constexpr_grammar_error( "Unreferenced symbol in grammar" );
+            }
+        }
+    }
+
+    if ( !symbols_[error_symbol_].productions.empty() )
+    {
+        constexpr_grammar_error( "The 'error' symbol appears on the left hand side of a production" );
+    }
+}
+
+/**
+// Collapse non-terminals that name a single terminal into that terminal
+// as GrammarGenerator::calculate_implicit_terminal_symbols() does.
+*/
+constexpr void ConstexprGrammarCompiler::calculate_implicit_terminal_symbols()
+{
+    const int symbols_size = int(symbols_.size());
+    std::vector<char> removed( symbols_size, 0 );
+    for ( int i = 0; i < symbols_size; ++i )
+    {
+        const Symbol& non_terminal_symbol = symbols_[i];
+        if ( i != error_symbol_ && non_terminal_symbol.productions.size() == 1 )
+        {
+            const Production& production = productions_[non_terminal_symbol.productions.front()];
+            if ( production.symbols.size() == 1 && production.action < 0 && symbols_[production.symbols.front()].symbol_type == SYMBOL_TERMINAL )
+            {
+                int terminal = production.symbols.front();
+                Symbol& terminal_symbol = symbols_[terminal];
+                terminal_symbol.identifier = non_terminal_symbol.lexeme;
+                terminal_symbol.line = non_terminal_symbol.line;
+                terminal_symbol.precedence = non_terminal_symbol.precedence;
+                terminal_symbol.associativity = non_terminal_symbol.associativity;
+                for ( Production& other_production : productions_ )
+                {
+                    other_production.symbol = other_production.symbol == i ? terminal : other_production.symbol;
+                    other_production.precedence_symbol = other_production.precedence_symbol == i ? terminal : other_production.precedence_symbol;
+                    for ( int& symbol : other_production.symbols )
+                    {
+                        symbol = symbol == i ? terminal : symbol;
+                    }
+                }
+                removed[i] = 1;
+            }
+        }
+    }
+
+    std::vector<int> indices( symbols_size, -1 );
+    int index = 0;
+    for ( int i = 0; i < symbols_size; ++i )
+    {
+        if ( !removed[i] )
+        {
+            indices[i] = index;
+            if ( index != i )
+            {
+                symbols_[index] = std::move( symbols_[i] );
+            }
+            ++index;
+        }
+    }
+    symbols_.resize( index );
+    for ( Production& production : productions_ )
+    {
+        production.symbol = indices[production.symbol];
+        production.precedence_symbol = production.precedence_symbol >= 0 ? indices[production.precedence_symbol] : -1;
+        for ( int& symbol : production.symbols )
+        {
+            symbol = indices[symbol];
+        }
+    }
+    start_symbol_ = indices[start_symbol_];
+    end_symbol_ = indices[end_symbol_];
+    error_symbol_ = indices[error_symbol_];
+}
+
+constexpr void ConstexprGrammarCompiler::calculate_nullable()
+{
+    bool added = true;
+    while ( added )
+    {
+        added = false;
+        for ( Symbol& symbol : symbols_ )
+        {
+            if ( symbol.symbol_type == SYMBOL_NON_TERMINAL && !symbol.nullable )
+            {
+                for ( int production : symbol.productions )
+                {
+                    bool nullable = true;
+                    for ( int production_symbol : productions_[production].symbols )
+                    {
+                        nullable = nullable && symbols_[production_symbol].nullable;
+                    }
+                    if ( nullable && !symbol.nullable )
+                    {
+                        symbol.nullable = true;
+                        added = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::calculate_precedence_of_productions()
+{
+    for ( int i = 0; i < int(productions_.size()); ++i )
+    {
+        Production& production = productions_[i];
+        if ( precedence_of_production(i) == 0 )
+        {
+            for ( int j = int(production.symbols.size()) - 1; j >= 0; --j )
+            {
+                if ( symbols_[production.symbols[j]].symbol_type == SYMBOL_TERMINAL )
+                {
+                    production.precedence_symbol = production.symbols[j];
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+// Generate the LR(0) states in the same order as
+// GrammarGenerator::generate_states() and then their lookaheads, reduce
+// transitions, and default reductions.
+*/
+constexpr void ConstexprGrammarCompiler::generate_states()
+{
+    if ( symbols_[start_symbol_].productions.empty() )
+    {
+        constexpr_grammar_error( "Grammar has no productions" );
+    }
+
+    State start_state;
+    start_state.items.push_back( Item{symbols_[start_symbol_].productions.front(), 0, std::vector<char>()} );
+    start_state.default_reduction = -1;
+    closure( &start_state );
+    states_.push_back( std::move(start_state) );
+
+    std::vector<int> goto_symbols;
+    for ( int index = 0; index < int(states_.size()); ++index )
+    {
+        goto_symbols.clear();
+        for ( const Item& item : states_[index].items )
+        {
+            const Production& production = productions_[item.production];
+            if ( item.position < int(production.symbols.size()) && production.symbols[item.position] != end_symbol_ )
+            {
+                goto_symbols.push_back( production.symbols[item.position] );
+            }
+        }
+        std::sort( goto_symbols.begin(), goto_symbols.end() );
+        goto_symbols.erase( std::unique(goto_symbols.begin(), goto_symbols.end()), goto_symbols.end() );
+
+        for ( int symbol : goto_symbols )
+        {
+            State goto_state;
+            goto_state.default_reduction = -1;
+            for ( const Item& item : states_[index].items )
+            {
+                const Production& production = productions_[item.production];
+                if ( item.position < int(production.symbols.size()) && production.symbols[item.position] == symbol )
+                {
+                    goto_state.items.push_back( Item{item.production, item.position + 1, std::vector<char>()} );
+                }
+            }
+
+            int goto_index = find_state_by_kernel( goto_state );
+            if ( goto_index < 0 )
+            {
+                closure( &goto_state );
+                goto_index = int(states_.size());
+                states_.push_back( std::move(goto_state) );
+            }
+            states_[index].transitions.push_back( Transition{symbol, goto_index, -1, 0, 0, -1, -1, TRANSITION_SHIFT} );
+        }
+    }
+
+    generate_lookaheads();
+    generate_reduce_transitions();
+    generate_default_reductions();
+}
+
+constexpr void ConstexprGrammarCompiler::closure( State* state ) const
+{
+    LALR_ASSERT( state );
+    bool added = true;
+    while ( added )
+    {
+        added = false;
+        for ( int i = 0; i < int(state->items.size()); ++i )
+        {
+            const Production& production = productions_[state->items[i].production];
+            if ( state->items[i].position < int(production.symbols.size()) )
+            {
+                for ( int closure_production : symbols_[production.symbols[state->items[i].position]].productions )
+                {
+                    auto item = state->items.begin();
+                    while ( item != state->items.end() && (item->production < closure_production) )
+                    {
+                        ++item;
+                    }
+                    if ( item == state->items.end() || item->production != closure_production || item->position != 0 )
+                    {
+                        state->items.insert( item, Item{closure_production, 0, std::vector<char>()} );
+                        added = true;
+                    }
+                }
+            }
+        }
+    }
+}
+
+constexpr int ConstexprGrammarCompiler::find_state_by_kernel( const State& state ) const
+{
+    for ( int index = 0; index < int(states_.size()); ++index )
+    {
+        const std::vector<Item>& items = states_[index].items;
+        auto i = items.begin();
+        auto j = state.items.begin();
+        bool equal = false;
+        for ( ;; )
+        {
+            while ( i != items.end() && i->position == 0 )
+            {
+                ++i;
+            }
+            while ( j != state.items.end() && j->position == 0 )
+            {
+                ++j;
+            }
+            if ( i == items.end() || j == state.items.end() )
+            {
+                equal = i == items.end() && j == state.items.end();
+                break;
+            }
+            if ( i->production != j->production || i->position != j->position )
+            {
+                break;
+            }
+            ++i;
+            ++j;
+        }
+        if ( equal )
+        {
+            return index;
+        }
+    }
+    return -1;
+}
+
+/**
+// Generate the LALR(1) lookaheads with DeRemer and Pennello's relations
+// as GrammarGenerator::generate_lookaheads() does.
+*/
+constexpr void ConstexprGrammarCompiler::generate_lookaheads()
+{
+    const int symbols_size = int(symbols_.size());
+    const int states_size = int(states_.size());
+    std::vector<int> non_terminal_transitions_by_state_and_symbol( states_size * symbols_size, -1 );
+    std::vector<int> non_terminal_transition_states( 1, 0 );
+    std::vector<int> non_terminal_transition_symbols( 1, start_symbol_ );
+    for ( int state = 0; state < states_size; ++state )
+    {
+        for ( const Transition& transition : states_[state].transitions )
+        {
+            if ( symbols_[transition.symbol].symbol_type == SYMBOL_NON_TERMINAL )
+            {
+                non_terminal_transitions_by_state_and_symbol[state * symbols_size + transition.symbol] = int(non_terminal_transition_states.size());
+                non_terminal_transition_states.push_back( state );
+                non_terminal_transition_symbols.push_back( transition.symbol );
+            }
+        }
+    }
+
+    const int non_terminal_transitions_size = int(non_terminal_transition_states.size());
+    std::vector<std::vector<char>> lookaheads( non_terminal_transitions_size, std::vector<char>(symbols_size, 0) );
+    std::vector<std::vector<int>> reads( non_terminal_transitions_size );
+    lookaheads[0][end_symbol_] = 1;
+    for ( int i = 1; i < non_terminal_transitions_size; ++i )
+    {
+        int state = goto_state( non_terminal_transition_states[i], non_terminal_transition_symbols[i] );
+        LALR_ASSERT( state >= 0 );
+        for ( const Transition& transition : states_[state].transitions )
+        {
+            const Symbol& read_symbol = symbols_[transition.symbol];
+            if ( read_symbol.symbol_type != SYMBOL_NON_TERMINAL )
+            {
+                lookaheads[i][transition.symbol] = 1;
+            }
+            else if ( read_symbol.nullable )
+            {
+                reads[i].push_back( non_terminal_transitions_by_state_and_symbol[state * symbols_size + transition.symbol] );
+            }
+        }
+    }
+    digraph( reads, &lookaheads );
+
+    std::vector<std::vector<int>> includes( non_terminal_transitions_size );
+    std::vector<int> lookback_states;
+    std::vector<int> lookback_productions;
+    std::vector<int> lookback_transitions;
+    for ( int i = 0; i < non_terminal_transitions_size; ++i )
+    {
+        for ( int production : symbols_[non_terminal_transition_symbols[i]].productions )
+        {
+            const std::vector<int>& production_symbols = productions_[production].symbols;
+            int nullable_suffix = int(production_symbols.size());
+            while ( nullable_suffix > 0 && symbols_[production_symbols[nullable_suffix - 1]].nullable )
+            {
+                --nullable_suffix;
+            }
+
+            int state = non_terminal_transition_states[i];
+            for ( int position = 0; position < int(production_symbols.size()); ++position )
+            {
+                int next_symbol = production_symbols[position];
+                if ( symbols_[next_symbol].symbol_type == SYMBOL_NON_TERMINAL && position + 1 >= nullable_suffix )
+                {
+                    int included = non_terminal_transitions_by_state_and_symbol[state * symbols_size + next_symbol];
+                    LALR_ASSERT( included >= 0 );
+                    includes[included].push_back( i );
+                }
+                state = goto_state( state, next_symbol );
+                LALR_ASSERT( state >= 0 );
+            }
+            lookback_states.push_back( state );
+            lookback_productions.push_back( production );
+            lookback_transitions.push_back( i );
+        }
+    }
+    digraph( includes, &lookaheads );
+
+    for ( int i = 0; i < int(lookback_states.size()); ++i )
+    {
+        const int production = lookback_productions[i];
+        const int position = int(productions_[production].symbols.size());
+        for ( Item& item : states_[lookback_states[i]].items )
+        {
+            if ( item.production == production && item.position == position )
+            {
+                item.lookahead_symbols.resize( symbols_size, 0 );
+                insert_symbols( &item.lookahead_symbols, lookaheads[lookback_transitions[i]] );
+            }
+        }
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::digraph( const std::vector<std::vector<int>>& relation, std::vector<std::vector<char>>* sets ) const
+{
+    LALR_ASSERT( sets );
+    LALR_ASSERT( sets->size() == relation.size() );
+    std::vector<int> depths( relation.size(), 0 );
+    std::vector<int> stack;
+    for ( int element = 0; element < int(relation.size()); ++element )
+    {
+        if ( depths[element] == 0 )
+        {
+            traverse( element, relation, sets, &stack, &depths );
+        }
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::traverse( int element, const std::vector<std::vector<int>>& relation, std::vector<std::vector<char>>* sets, std::vector<int>* stack, std::vector<int>* depths ) const
+{
+    stack->push_back( element );
+    int depth = int(stack->size());
+    (*depths)[element] = depth;
+
+    for ( int related_element : relation[element] )
+    {
+        if ( (*depths)[related_element] == 0 )
+        {
+            traverse( related_element, relation, sets, stack, depths );
+        }
+        (*depths)[element] = std::min( (*depths)[element], (*depths)[related_element] );
+        insert_symbols( &(*sets)[element], (*sets)[related_element] );
+    }
+
+    if ( (*depths)[element] == depth )
+    {
+        int top = INT_MAX;
+        while ( top != element )
+        {
+            top = stack->back();
+            stack->pop_back();
+            (*depths)[top] = INT_MAX;
+            if ( top != element )
+            {
+                (*sets)[top] = (*sets)[element];
+            }
+        }
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::generate_reduce_transitions()
+{
+    for ( int state = 0; state < int(states_.size()); ++state )
+    {
+        for ( int i = 0; i < int(states_[state].items.size()); ++i )
+        {
+            const Item& item = states_[state].items[i];
+            if ( item.position == int(productions_[item.production].symbols.size()) )
+            {
+                for ( int symbol = 0; symbol < int(item.lookahead_symbols.size()); ++symbol )
+                {
+                    if ( states_[state].items[i].lookahead_symbols[symbol] )
+                    {
+                        generate_reduce_transition( &states_[state], symbol, states_[state].items[i].production );
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+// Generate a reduce transition resolving conflicts by precedence as
+// GrammarGenerator::generate_reduce_transition() does.
+*/
+constexpr void ConstexprGrammarCompiler::generate_reduce_transition( State* state, int symbol, int production )
+{
+    LALR_ASSERT( state );
+    const int reduced_symbol = productions_[production].symbol;
+    const int reduced_length = int(productions_[production].symbols.size());
+    const int precedence = precedence_of_production( production );
+    const int action = productions_[production].action;
+
+    auto transition = state->transitions.begin();
+    while ( transition != state->transitions.end() && transition->symbol < symbol )
+    {
+        ++transition;
+    }
+    if ( transition == state->transitions.end() || transition->symbol != symbol )
+    {
+        state->transitions.insert( transition, Transition{symbol, -1, reduced_symbol, reduced_length, precedence, action, production, TRANSITION_REDUCE} );
+    }
+    else if ( transition->type == TRANSITION_SHIFT )
+    {
+        const Symbol& shifted_symbol = symbols_[symbol];
+        if ( precedence == 0 || shifted_symbol.precedence == 0 || (shifted_symbol.precedence == precedence && shifted_symbol.associativity == ASSOCIATE_NULL) )
+        {
+            constexpr_grammar_error( "Shift/reduce conflict in grammar" );
+        }
+        else if ( precedence > shifted_symbol.precedence || (shifted_symbol.precedence == precedence && shifted_symbol.associativity == ASSOCIATE_RIGHT) )
+        {
+            *transition = Transition{symbol, -1, reduced_symbol, reduced_length, precedence, action, production, TRANSITION_REDUCE};
+        }
+    }
+    else
+    {
+        if ( precedence == 0 || transition->precedence == 0 || precedence == transition->precedence )
+        {
+            constexpr_grammar_error( "Reduce/reduce conflict in grammar" );
+        }
+        else if ( precedence > transition->precedence )
+        {
+            *transition = Transition{symbol, -1, reduced_symbol, reduced_length, precedence, action, production, TRANSITION_REDUCE};
+        }
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::generate_default_reductions()
+{
+    for ( State& state : states_ )
+    {
+        state.default_reduction = -1;
+        for ( int i = 0; i < int(state.transitions.size()); ++i )
+        {
+            const Transition& transition = state.transitions[i];
+            if ( transition.type != TRANSITION_REDUCE || transition.reduced_symbol == start_symbol_ )
+            {
+                state.default_reduction = -1;
+                break;
+            }
+
+            if ( state.default_reduction < 0 )
+            {
+                state.default_reduction = i;
+            }
+            else
+            {
+                const Transition& default_reduction = state.transitions[state.default_reduction];
+                if ( transition.production != default_reduction.production )
+                {
+                    state.default_reduction = -1;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+// Generate a lexer that matches \e tokens.
+//
+// Literals are concatenations of their characters and regular expressions
+// are parsed as RegexParser does.  States are generated from the positions
+// of the combined syntax tree as RegexGenerator::generate_states() does.
+// Each state matches the symbol of the token with the highest priority
+// type, literals before regular expressions, and then the earliest line.
+// The states are then minimized with minimize_lexer().
+//
+// @param tokens
+//  The tokens to match.
+//
+// @return
+//  The states of the lexer.
+*/
+constexpr ConstexprGrammarCompiler::RegexStateMachine ConstexprGrammarCompiler::generate_lexer( const std::vector<Token>& tokens ) const
+{
+    RegexSyntaxTree syntax_tree{std::vector<RegexNode>(), std::vector<int>(), nullptr, nullptr, 0};
+    for ( int i = 0; i < int(tokens.size()); ++i )
+    {
+        const Token& token = tokens[i];
+        if ( token.lexeme.empty() )
+        {
+            constexpr_grammar_error( "Empty literal or regular expression in grammar" );
+        }
+
+        if ( token.type == TOKEN_LITERAL )
+        {
+            std::size_t position = 0;
+            int character = escape_literal( token.lexeme, &position, &syntax_tree.unsupported );
+            regex_node( &syntax_tree, LEXER_NODE_SYMBOL, character, character + 1, -1 );
+            while ( position < token.lexeme.size() )
+            {
+                character = escape_literal( token.lexeme, &position, &syntax_tree.unsupported );
+                regex_node( &syntax_tree, LEXER_NODE_SYMBOL, character, character + 1, -1 );
+                regex_node( &syntax_tree, LEXER_NODE_CAT, 0, 0, -1 );
+            }
+        }
+        else
+        {
+            syntax_tree.position = token.lexeme.data();
+            syntax_tree.end = token.lexeme.data() + token.lexeme.size();
+            if ( !match_or_expression(&syntax_tree) || syntax_tree.position != syntax_tree.end )
+            {
+                constexpr_grammar_error( "Syntax error in regular expression" );
+            }
+        }
+
+        regex_node( &syntax_tree, LEXER_NODE_SYMBOL, -1, -1, i );
+        regex_node( &syntax_tree, LEXER_NODE_CAT, 0, 0, -1 );
+        while ( syntax_tree.stack.size() > 1 )
+        {
+            regex_node( &syntax_tree, LEXER_NODE_OR, 0, 0, -1 );
+        }
+    }
+    LALR_ASSERT( syntax_tree.stack.size() == 1 );
+
+    std::vector<RegexNode>& nodes = syntax_tree.nodes;
+    for ( int i = 0; i < int(nodes.size()); ++i )
+    {
+        RegexNode& node = nodes[i];
+        switch ( node.type )
+        {
+            case LEXER_NODE_SYMBOL:
+                node.nullable = false;
+                node.first_positions.push_back( i );
+                node.last_positions.push_back( i );
+                break;
+
+            case LEXER_NODE_CAT:
+            {
+                const RegexNode& left = nodes[node.left];
+                const RegexNode& right = nodes[node.right];
+                node.nullable = left.nullable && right.nullable;
+                node.first_positions = left.first_positions;
+                if ( left.nullable )
+                {
+                    insert_positions( &node.first_positions, right.first_positions );
+                }
+                node.last_positions = right.last_positions;
+                if ( right.nullable )
+                {
+                    insert_positions( &node.last_positions, left.last_positions );
+                }
+                for ( int position : left.last_positions )
+                {
+                    insert_positions( &nodes[position].follow_positions, right.first_positions );
+                }
+                break;
+            }
+
+            case LEXER_NODE_OR:
+                node.nullable = nodes[node.left].nullable || nodes[node.right].nullable;
+                node.first_positions = nodes[node.left].first_positions;
+                insert_positions( &node.first_positions, nodes[node.right].first_positions );
+                node.last_positions = nodes[node.left].last_positions;
+                insert_positions( &node.last_positions, nodes[node.right].last_positions );
+                break;
+
+            case LEXER_NODE_STAR:
+            case LEXER_NODE_PLUS:
+            case LEXER_NODE_OPTIONAL:
+                node.nullable = node.type != LEXER_NODE_PLUS || nodes[node.left].nullable;
+                node.first_positions = nodes[node.left].first_positions;
+                node.last_positions = nodes[node.left].last_positions;
+                if ( node.type != LEXER_NODE_OPTIONAL )
+                {
+                    for ( int position : node.last_positions )
+                    {
+                        insert_positions( &nodes[position].follow_positions, node.first_positions );
+                    }
+                }
+                break;
+
+            default:
+                LALR_ASSERT( false );
+                break;
+        }
+    }
+
+    RegexStateMachine lexer{std::vector<RegexState>(), 0, syntax_tree.unsupported};
+    lexer.states.push_back( RegexState{nodes[syntax_tree.stack.back()].first_positions, std::vector<RegexTransition>(), -1} );
+    std::vector<int> boundaries;
+    for ( int index = 0; index < int(lexer.states.size()); ++index )
+    {
+        const std::vector<int> positions = lexer.states[index].positions;
+
+        int token = -1;
+        for ( int position : positions )
+        {
+            int other_token = nodes[position].token;
+            if ( other_token >= 0 )
+            {
+                if ( token < 0 || tokens[other_token].type > tokens[token].type || (tokens[other_token].type == tokens[token].type && tokens[other_token].line < tokens[token].line) )
+                {
+                    token = other_token;
+                }
+                else if ( tokens[other_token].type == tokens[token].type && tokens[other_token].line == tokens[token].line )
+                {
+                    constexpr_grammar_error( "Symbols conflict but are both defined on the same line" );
+                }
+            }
+        }
+        lexer.states[index].symbol = token >= 0 ? tokens[token].symbol : -1;
+
+        boundaries.clear();
+        for ( int position : positions )
+        {
+            if ( nodes[position].token < 0 )
+            {
+                boundaries.push_back( nodes[position].begin_character );
+                boundaries.push_back( nodes[position].end_character );
+            }
+        }
+        std::sort( boundaries.begin(), boundaries.end() );
+        boundaries.erase( std::unique(boundaries.begin(), boundaries.end()), boundaries.end() );
+
+        for ( int i = 0; i + 1 < int(boundaries.size()); ++i )
+        {
+            int begin = boundaries[i];
+            int end = boundaries[i + 1];
+            std::vector<int> goto_positions;
+            for ( int position : positions )
+            {
+                const RegexNode& node = nodes[position];
+                if ( node.token < 0 && node.begin_character <= begin && node.end_character >= end )
+                {
+                    insert_positions( &goto_positions, node.follow_positions );
+                }
+            }
+
+            if ( !goto_positions.empty() )
+            {
+                int goto_index = 0;
+                while ( goto_index < int(lexer.states.size()) && lexer.states[goto_index].positions != goto_positions )
+                {
+                    ++goto_index;
+                }
+                if ( goto_index == int(lexer.states.size()) )
+                {
+                    lexer.states.push_back( RegexState{goto_positions, std::vector<RegexTransition>(), -1} );
+                }
+
+                std::vector<RegexTransition>& transitions = lexer.states[index].transitions;
+                if ( !transitions.empty() && transitions.back().end == begin && transitions.back().state == goto_index )
+                {
+                    transitions.back().end = end;
+                }
+                else
+                {
+                    transitions.push_back( RegexTransition{begin, end, goto_index} );
+                    ++lexer.transitions_size;
+                }
+            }
+        }
+    }
+    minimize_lexer( &lexer );
+    return lexer;
+}
+
+/**
+// Merge equivalent states of \e lexer using Moore's partition refinement.
+//
+// States start out partitioned by the symbol that they match and blocks
+// are split until every state in a block transitions to the same blocks
+// on the same characters.  Blocks are numbered in the order of their
+// lowest state so the start state stays first and each block is replaced
+// by its lowest state as in RegexGenerator::minimize_states().
+//
+// @param lexer
+//  The lexer to minimize (assumed not null).
+*/
+constexpr void ConstexprGrammarCompiler::minimize_lexer( RegexStateMachine* lexer )
+{
+    LALR_ASSERT( lexer );
+    std::vector<RegexState>& states = lexer->states;
+    const int states_size = int(states.size());
+
+    // The transitions of each state to blocks with adjacent transitions to
+    // the same block merged.
+    auto block_transitions = [&]( int state, const std::vector<int>& blocks ) -> std::vector<RegexTransition>
+    {
+        std::vector<RegexTransition> transitions;
+        for ( const RegexTransition& transition : states[state].transitions )
+        {
+            const int block = blocks[transition.state];
+            if ( !transitions.empty() && transitions.back().end == transition.begin && transitions.back().state == block )
+            {
+                transitions.back().end = transition.end;
+            }
+            else
+            {
+                transitions.push_back( RegexTransition{transition.begin, transition.end, block} );
+            }
+        }
+        return transitions;
+    };
+
+    auto equal_transitions = [&]( const std::vector<RegexTransition>& transitions, const std::vector<RegexTransition>& other_transitions )
+    {
+        if ( transitions.size() != other_transitions.size() )
+        {
+            return false;
+        }
+        for ( std::size_t i = 0; i < transitions.size(); ++i )
+        {
+            const RegexTransition& transition = transitions[i];
+            const RegexTransition& other_transition = other_transitions[i];
+            if ( transition.begin != other_transition.begin || transition.end != other_transition.end || transition.state != other_transition.state )
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    std::vector<int> blocks( states_size, -1 );
+    std::vector<int> representatives;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        int block = 0;
+        while ( block < int(representatives.size()) && states[representatives[block]].symbol != states[i].symbol )
+        {
+            ++block;
+        }
+        if ( block == int(representatives.size()) )
+        {
+            representatives.push_back( i );
+        }
+        blocks[i] = block;
+    }
+
+    std::vector<std::vector<RegexTransition>> transitions;
+    int blocks_size = 0;
+    while ( blocks_size != int(representatives.size()) )
+    {
+        blocks_size = int(representatives.size());
+        transitions.clear();
+        for ( int i = 0; i < states_size; ++i )
+        {
+            transitions.push_back( block_transitions(i, blocks) );
+        }
+
+        std::vector<int> split_blocks( states_size, -1 );
+        representatives.clear();
+        for ( int i = 0; i < states_size; ++i )
+        {
+            int block = 0;
+            while ( block < int(representatives.size()) && (blocks[representatives[block]] != blocks[i] || !equal_transitions(transitions[representatives[block]], transitions[i])) )
+            {
+                ++block;
+            }
+            if ( block == int(representatives.size()) )
+            {
+                representatives.push_back( i );
+            }
+            split_blocks[i] = block;
+        }
+        blocks.swap( split_blocks );
+    }
+
+    if ( blocks_size < states_size )
+    {
+        std::vector<RegexState> minimized_states;
+        lexer->transitions_size = 0;
+        for ( int representative : representatives )
+        {
+            std::vector<RegexTransition> minimized_transitions = block_transitions( representative, blocks );
+            lexer->transitions_size += int(minimized_transitions.size());
+            minimized_states.push_back( RegexState{std::vector<int>(), minimized_transitions, states[representative].symbol} );
+        }
+        states.swap( minimized_states );
+    }
+}
+
+constexpr int ConstexprGrammarCompiler::precedence_of_production( int production ) const
+{
+    int precedence_symbol = productions_[production].precedence_symbol;
+    return precedence_symbol >= 0 ? symbols_[precedence_symbol].precedence : 0;
+}
+
+constexpr int ConstexprGrammarCompiler::goto_state( int state, int symbol ) const
+{
+    for ( const Transition& transition : states_[state].transitions )
+    {
+        if ( transition.symbol == symbol )
+        {
+            return transition.state;
+        }
+    }
+    return -1;
+}
+
+/**
+// Calculate the identifier of a symbol from its lexeme as
+// GrammarSymbol::calculate_identifier() does.
+*/
+constexpr std::string ConstexprGrammarCompiler::calculate_identifier( const std::string& lexeme, SymbolType symbol_type )
+{
+    const char* CHARACTER_NAMES [] =
+    {
+        "nul", "soh", "stx", "etx", "eot", "enq", "ack", "bel",
+        "bs", "tab", "lf", "vt", "ff", "cr", "so", "si",
+        "dle", "dc1", "dc2", "dc3", "dc4", "nak", "syn", "etb",
+        "can", "em", "sub", "esc", "fs", "gs", "rs", "us",
+        "space", "bang", "double_quote", "hash", "dollar", "percent", "amp", "single_quote",
+        "left_paren", "right_paren", "star", "plus", "comma", "minus", "dot", "slash",
+        "0", "1", "2", "3", "4", "5", "6", "7",
+        "8", "9", "colon", "semi_colon", "lt", "eq", "gt", "question",
+        "at", "A", "B", "C", "D", "E", "F", "G",
+        "H", "I", "J", "K", "L", "M", "N", "O",
+        "P", "Q", "R", "S", "T", "U", "V", "W",
+        "X", "Y", "Z", "left_square_paren", "backslash", "right_square_paren", "hat", "underscore",
+        "backtick", "a", "b", "c", "d", "e", "f", "g",
+        "h", "i", "j", "k", "l", "m", "n", "o",
+        "p", "q", "r", "s", "t", "u", "v", "w",
+        "x", "y", "z", "left_curly_brace", "pipe", "right_curly_brace", "tilde", "del"
+    };
+
+    std::string identifier;
+    for ( std::size_t i = 0; i < lexeme.size(); ++i )
+    {
+        int character = lexeme[i];
+        if ( is_alpha(character) || is_digit(character) || character == '_' )
+        {
+            identifier.push_back( char(character) );
+        }
+        else
+        {
+            if ( character < 0 || character >= 128 )
+            {
+                constexpr_grammar_error( "Non-ASCII character in symbol" );
+            }
+            if ( i != 0 )
+            {
+                identifier.append( "_" );
+            }
+            identifier.append( CHARACTER_NAMES[character] );
+            if ( i + 1 != lexeme.size() )
+            {
+                identifier.append( "_" );
+            }
+        }
+    }
+
+    if ( symbol_type == SYMBOL_TERMINAL )
+    {
+        identifier.append( "_terminal" );
+    }
+    return identifier;
+}
+
+constexpr bool ConstexprGrammarCompiler::is_alpha( int character )
+{
+    return (character >= 'a' && character <= 'z') || (character >= 'A' && character <= 'Z');
+}
+
+constexpr bool ConstexprGrammarCompiler::is_digit( int character )
+{
+    return character >= '0' && character <= '9';
+}
+
+constexpr bool ConstexprGrammarCompiler::is_space( int character )
+{
+    return character == ' ' || (character >= '\t' && character <= '\r');
+}
+
+constexpr bool ConstexprGrammarCompiler::is_xdigit( int character )
+{
+    return is_digit( character ) || (character >= 'a' && character <= 'f') || (character >= 'A' && character <= 'F');
+}
+
+constexpr void ConstexprGrammarCompiler::insert_positions( std::vector<int>* positions, const std::vector<int>& other_positions )
+{
+    LALR_ASSERT( positions );
+    for ( int position : other_positions )
+    {
+        auto i = positions->begin();
+        while ( i != positions->end() && *i < position )
+        {
+            ++i;
+        }
+        if ( i == positions->end() || *i != position )
+        {
+            positions->insert( i, position );
+        }
+    }
+}
+
+constexpr void ConstexprGrammarCompiler::insert_symbols( std::vector<char>* symbols, const std::vector<char>& other_symbols )
+{
+    LALR_ASSERT( symbols );
+    LALR_ASSERT( symbols->size() == other_symbols.size() );
+    for ( std::size_t i = 0; i < other_symbols.size(); ++i )
+    {
+        (*symbols)[i] = (*symbols)[i] || other_symbols[i];
+    }
+}
+
+/**
+// Add the characters in [\e begin, \e end) to the sorted, disjoint
+// [begin, end) pairs in \e ranges.
+*/
+constexpr void ConstexprGrammarCompiler::insert_characters( std::vector<int>* ranges, int begin, int end )
+{
+    LALR_ASSERT( ranges );
+    if ( begin >= end )
+    {
+        constexpr_grammar_error( "Empty range in regular expression" );
+    }
+    std::vector<int> inserted_ranges;
+    std::size_t i = 0;
+    while ( i < ranges->size() && (*ranges)[i + 1] < begin )
+    {
+        inserted_ranges.push_back( (*ranges)[i] );
+        inserted_ranges.push_back( (*ranges)[i + 1] );
+        i += 2;
+    }
+    while ( i < ranges->size() && (*ranges)[i] <= end )
+    {
+        begin = std::min( begin, (*ranges)[i] );
+        end = std::max( end, (*ranges)[i + 1] );
+        i += 2;
+    }
+    inserted_ranges.push_back( begin );
+    inserted_ranges.push_back( end );
+    inserted_ranges.insert( inserted_ranges.end(), ranges->begin() + i, ranges->end() );
+    ranges->swap( inserted_ranges );
+}
+
+/**
+// Remove the characters in [\e begin, \e end) from the sorted, disjoint
+// [begin, end) pairs in \e ranges.
+*/
+constexpr void ConstexprGrammarCompiler::erase_characters( std::vector<int>* ranges, int begin, int end )
+{
+    LALR_ASSERT( ranges );
+    std::vector<int> erased_ranges;
+    for ( std::size_t i = 0; i < ranges->size(); i += 2 )
+    {
+        int range_begin = (*ranges)[i];
+        int range_end = (*ranges)[i + 1];
+        if ( range_begin < std::min(range_end, begin) )
+        {
+            erased_ranges.push_back( range_begin );
+            erased_ranges.push_back( std::min(range_end, begin) );
+        }
+        if ( std::max(range_begin, end) < range_end )
+        {
+            erased_ranges.push_back( std::max(range_begin, end) );
+            erased_ranges.push_back( range_end );
+        }
+    }
+    ranges->swap( erased_ranges );
+}
+
+/**
+// Add the characters named by the character class \e name (e.g.
+// "[:alnum:]") as RegexSyntaxTree::item_alnum() etc do.
+*/
+constexpr void ConstexprGrammarCompiler::insert_character_class( std::vector<int>* ranges, const char* name )
+{
+    const std::string class_name( name );
+    const bool alpha = class_name == "[:alnum:]" || class_name == "[:word:]" || class_name == "[:alpha:]";
+    if ( alpha || class_name == "[:lower:]" )
+    {
+        insert_characters( ranges, 'a', 'z' + 1 );
+    }
+    if ( alpha || class_name == "[:upper:]" )
+    {
+        insert_characters( ranges, 'A', 'Z' + 1 );
+    }
+    if ( class_name == "[:alnum:]" || class_name == "[:word:]" || class_name == "[:digit:]" )
+    {
+        insert_characters( ranges, '0', '9' + 1 );
+    }
+
+    const char* characters = "";
+    if ( class_name == "[:word:]" )
+    {
+        characters = "_";
+    }
+    else if ( class_name == "[:blank:]" )
+    {
+        characters = " \t";
+    }
+    else if ( class_name == "[:punct:]" )
+    {
+        characters = "-!\"#$%&'()*+,./:;<=>?@[\\]_`{|}~";
+    }
+    else if ( class_name == "[:space:]" )
+    {
+        characters = " \t\r\n";
+    }
+    else if ( class_name == "[:xdigit:]" )
+    {
+        characters = "0123456789abcdefABCDEF";
+    }
+    else if ( class_name == "[:cntrl:]" )
+    {
+        insert_characters( ranges, 0x00, 0x1f + 1 );
+        insert_characters( ranges, 0x7f, 0x7f + 1 );
+    }
+    else if ( class_name == "[:graph:]" )
+    {
+        insert_characters( ranges, 0x21, 0x7e + 1 );
+    }
+    else if ( class_name == "[:print:]" )
+    {
+        insert_characters( ranges, 0x20, 0x7e + 1 );
+    }
+    for ( const char* character = characters; *character != 0; ++character )
+    {
+        insert_characters( ranges, *character, *character + 1 );
+    }
+}
+
+/**
+// Get the character at \e position in \e literal as
+// RegexSyntaxTree::escape() does and advance \e position past it.
+//
+// Numeric escapes aren't supported (RegexSyntaxTree::escape() asserts on
+// them) and add CONSTEXPR_GRAMMAR_NUMERIC_LITERAL_ESCAPES to
+// \e unsupported.
+*/
+constexpr int ConstexprGrammarCompiler::escape_literal( const std::string& literal, std::size_t* position, int* unsupported )
+{
+    LALR_ASSERT( position && *position < literal.size() );
+    LALR_ASSERT( unsupported );
+    int character = literal[*position];
+    if ( character == '\\' && *position + 1 < literal.size() )
+    {
+        ++*position;
+        switch ( literal[*position] )
+        {
+            case 'b':
+                character = '\b';
+                break;
+
+            case 'f':
+                character = '\f';
+                break;
+
+            case 'n':
+                character = '\n';
+                break;
+
+            case 'r':
+                character = '\r';
+                break;
+
+            case 't':
+                character = '\t';
+                break;
+
+            case 'x':
+            case 'X':
+            case '0':
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+                *unsupported |= CONSTEXPR_GRAMMAR_NUMERIC_LITERAL_ESCAPES;
+                break;
+
+            default:
+                character = literal[*position];
+                break;
+        }
+    }
+    ++*position;
+    return character;
+}
+
+/**
+// Get the character in the escape sequence or character [\e begin, \e end)
+// as RegexParser::escape() does.
+*/
+constexpr int ConstexprGrammarCompiler::escape_regex( const char* begin, const char* end )
+{
+    int character = *begin;
+    if ( character == '\\' )
+    {
+        ++begin;
+        if ( begin != end )
+        {
+            switch ( *begin )
+            {
+                case 'b':
+                    character = '\b';
+                    break;
+
+                case 'f':
+                    character = '\f';
+                    break;
+
+                case 'n':
+                    character = '\n';
+                    break;
+
+                case 'r':
+                    character = '\r';
+                    break;
+
+                case 't':
+                    character = '\t';
+                    break;
+
+                case 'x':
+                case 'X':
+                    ++begin;
+                    character = 0;
+                    while ( begin != end && is_xdigit(*begin) )
+                    {
+                        character <<= 4;
+                        if ( is_digit(*begin) )
+                        {
+                            character += *begin - '0';
+                        }
+                        else if ( *begin >= 'a' && *begin <= 'f' )
+                        {
+                            character += *begin - 'a' + 10;
+                        }
+                        else
+                        {
+                            character += *begin - 'A' + 10;
+                        }
+                        ++begin;
+                    }
+                    break;
+
+                case '0':
+                case '1':
+                case '2':
+                case '3':
+                case '4':
+                case '5':
+                case '6':
+                case '7':
+                {
+                    character = 0;
+                    int count = 0;
+                    while ( begin != end && *begin >= '0' && *begin <= '7' && count < 3 )
+                    {
+                        character <<= 3;
+                        character += *begin - '0';
+                        ++begin;
+                        ++count;
+                    }
+                    break;
+                }
+
+                default:
+                    character = *begin;
+                    break;
+            }
+        }
+    }
+    return character;
+}
+
+/**
+// Push a new node onto the stack of \e syntax_tree.
+//
+// Leaf nodes (LEXER_NODE_SYMBOL) match the characters in
+// [\e begin_character, \e end_character) or, when \e token isn't -1, mark
+// the end of \e token.  Other nodes pop their operands from the stack as
+// RegexSyntaxTree::cat_expression() etc do.
+*/
+constexpr void ConstexprGrammarCompiler::regex_node( RegexSyntaxTree* syntax_tree, RegexNodeType type, int begin_character, int end_character, int token )
+{
+    LALR_ASSERT( syntax_tree );
+    std::vector<int>& stack = syntax_tree->stack;
+    int left = -1;
+    int right = -1;
+    if ( type == LEXER_NODE_CAT || type == LEXER_NODE_OR )
+    {
+        LALR_ASSERT( stack.size() >= 2 );
+        right = stack.back();
+        stack.pop_back();
+        left = stack.back();
+        stack.pop_back();
+    }
+    else if ( type != LEXER_NODE_SYMBOL )
+    {
+        LALR_ASSERT( !stack.empty() );
+        left = stack.back();
+        stack.pop_back();
+    }
+    syntax_tree->nodes.push_back( RegexNode{type, begin_character, end_character, token, left, right, false, std::vector<int>(), std::vector<int>(), std::vector<int>()} );
+    stack.push_back( int(syntax_tree->nodes.size()) - 1 );
+}
+
+constexpr bool ConstexprGrammarCompiler::match_or_expression( RegexSyntaxTree* syntax_tree )
+{
+    if ( match_cat_expression(syntax_tree) )
+    {
+        if ( match_regex_lexeme(syntax_tree, "|") )
+        {
+            if ( !match_or_expression(syntax_tree) )
+            {
+                constexpr_grammar_error( "Syntax error in regular expression" );
+            }
+            regex_node( syntax_tree, LEXER_NODE_OR, 0, 0, -1 );
+        }
+        return true;
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_cat_expression( RegexSyntaxTree* syntax_tree )
+{
+    if ( match_postfix_expression(syntax_tree) )
+    {
+        if ( match_cat_expression(syntax_tree) )
+        {
+            regex_node( syntax_tree, LEXER_NODE_CAT, 0, 0, -1 );
+        }
+        return true;
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_postfix_expression( RegexSyntaxTree* syntax_tree )
+{
+    if ( match_base_expression(syntax_tree) )
+    {
+        if ( match_regex_lexeme(syntax_tree, "*") )
+        {
+            regex_node( syntax_tree, LEXER_NODE_STAR, 0, 0, -1 );
+        }
+        else if ( match_regex_lexeme(syntax_tree, "+") )
+        {
+            regex_node( syntax_tree, LEXER_NODE_PLUS, 0, 0, -1 );
+        }
+        else if ( match_regex_lexeme(syntax_tree, "?") )
+        {
+            regex_node( syntax_tree, LEXER_NODE_OPTIONAL, 0, 0, -1 );
+        }
+        return true;
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_base_expression( RegexSyntaxTree* syntax_tree )
+{
+    const char* CHARACTER_CLASSES [] =
+    {
+        "[:alnum:]", "[:word:]", "[:alpha:]", "[:blank:]", "[:cntrl:]", "[:digit:]", "[:graph:]",
+        "[:lower:]", "[:print:]", "[:punct:]", "[:space:]", "[:upper:]", "[:xdigit:]"
+    };
+
+    const bool negative = match_regex_lexeme( syntax_tree, "[^" );
+    if ( negative || match_regex_lexeme(syntax_tree, "[") )
+    {
+        std::vector<int> ranges;
+        if ( negative )
+        {
+            ranges.push_back( 0 );
+            ranges.push_back( INT_MAX );
+        }
+
+        if ( match_regex_lexeme(syntax_tree, "-") )
+        {
+            negative ? erase_characters( &ranges, '-', '-' + 1 ) : insert_characters( &ranges, '-', '-' + 1 );
+        }
+
+        bool item = true;
+        while ( item )
+        {
+            item = false;
+            for ( const char* character_class : CHARACTER_CLASSES )
+            {
+                if ( !item && match_regex_lexeme(syntax_tree, character_class) )
+                {
+                    if ( negative )
+                    {
+                        syntax_tree->unsupported |= CONSTEXPR_GRAMMAR_NEGATIVE_CHARACTER_CLASSES;
+                    }
+                    insert_character_class( &ranges, character_class );
+                    item = true;
+                }
+            }
+
+            int begin = 0;
+            if ( !item && match_regex_character(syntax_tree, &begin) )
+            {
+                int end = begin + 1;
+                const char* position = syntax_tree->position;
+                if ( match_regex_lexeme(syntax_tree, "-") )
+                {
+                    if ( match_regex_character(syntax_tree, &end) )
+                    {
+                        ++end;
+                    }
+                    else
+                    {
+                        syntax_tree->position = position;
+                    }
+                }
+                negative ? erase_characters( &ranges, begin, end ) : insert_characters( &ranges, begin, end );
+                item = true;
+            }
+        }
+
+        if ( match_regex_lexeme(syntax_tree, "-") )
+        {
+            negative ? erase_characters( &ranges, '-', '-' + 1 ) : insert_characters( &ranges, '-', '-' + 1 );
+        }
+
+        if ( !match_regex_lexeme(syntax_tree, "]") || ranges.empty() )
+        {
+            constexpr_grammar_error( "Syntax error in regular expression" );
+        }
+
+        regex_node( syntax_tree, LEXER_NODE_SYMBOL, ranges[0], ranges[1], -1 );
+        for ( std::size_t i = 2; i < ranges.size(); i += 2 )
+        {
+            regex_node( syntax_tree, LEXER_NODE_SYMBOL, ranges[i], ranges[i + 1], -1 );
+            regex_node( syntax_tree, LEXER_NODE_OR, 0, 0, -1 );
+        }
+        return true;
+    }
+    else if ( match_regex_lexeme(syntax_tree, ":") )
+    {
+        // Skip the action and match any character in its place so that
+        // the rest of the grammar still compiles; the grammar is rejected
+        // through CONSTEXPR_GRAMMAR_LEXER_ACTIONS.
+        while ( syntax_tree->position != syntax_tree->end && (is_alpha(*syntax_tree->position) || is_digit(*syntax_tree->position) || *syntax_tree->position == '_') )
+        {
+            ++syntax_tree->position;
+        }
+        if ( !match_regex_lexeme(syntax_tree, ":") )
+        {
+            constexpr_grammar_error( "Syntax error in regular expression" );
+        }
+        syntax_tree->unsupported |= CONSTEXPR_GRAMMAR_LEXER_ACTIONS;
+        regex_node( syntax_tree, LEXER_NODE_SYMBOL, 0, INT_MAX, -1 );
+        return true;
+    }
+    else if ( match_regex_lexeme(syntax_tree, "(") )
+    {
+        if ( !match_or_expression(syntax_tree) || !match_regex_lexeme(syntax_tree, ")") )
+        {
+            constexpr_grammar_error( "Syntax error in regular expression" );
+        }
+        return true;
+    }
+    else if ( match_regex_lexeme(syntax_tree, ".") )
+    {
+        regex_node( syntax_tree, LEXER_NODE_SYMBOL, 0, INT_MAX, -1 );
+        return true;
+    }
+
+    int character = 0;
+    if ( match_regex_character(syntax_tree, &character) )
+    {
+        regex_node( syntax_tree, LEXER_NODE_SYMBOL, character, character + 1, -1 );
+        return true;
+    }
+    return false;
+}
+
+/**
+// Match a character or escape sequence as RegexParser::match_character()
+// does.
+*/
+constexpr bool ConstexprGrammarCompiler::match_regex_character( RegexSyntaxTree* syntax_tree, int* character )
+{
+    LALR_ASSERT( syntax_tree );
+    LALR_ASSERT( character );
+    const char* begin = syntax_tree->position;
+    const char* position = begin;
+    const char* end = syntax_tree->end;
+    if ( position != end )
+    {
+        if ( *position == '\\' )
+        {
+            ++position;
+            if ( position != end && (*position == 'x' || *position == 'X') )
+            {
+                ++position;
+                while ( position != end && is_xdigit(*position) )
+                {
+                    ++position;
+                }
+            }
+            else if ( position != end && is_digit(*position) )
+            {
+                ++position;
+                while ( position != end && is_digit(*position) )
+                {
+                    ++position;
+                }
+            }
+            else if ( position != end )
+            {
+                ++position;
+            }
+            *character = escape_regex( begin, position );
+            syntax_tree->position = position;
+            return true;
+        }
+
+        const std::string operators( "|*+?[]()-" );
+        if ( operators.find(*position) == std::string::npos )
+        {
+            *character = *position;
+            syntax_tree->position = position + 1;
+            return true;
+        }
+    }
+    return false;
+}
+
+constexpr bool ConstexprGrammarCompiler::match_regex_lexeme( RegexSyntaxTree* syntax_tree, const char* lexeme )
+{
+    LALR_ASSERT( syntax_tree );
+    LALR_ASSERT( lexeme );
+    const char* position = syntax_tree->position;
+    while ( position != syntax_tree->end && *lexeme != 0 && *position == *lexeme )
+    {
+        ++position;
+        ++lexeme;
+    }
+    if ( *lexeme == 0 )
+    {
+        syntax_tree->position = position;
+        return true;
+    }
+    return false;
+}
+
+}
+
+#endif
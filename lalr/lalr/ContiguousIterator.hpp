@@ -0,0 +1,53 @@
+#ifndef LALR_CONTIGUOUSITERATOR_HPP_INCLUDED
+#define LALR_CONTIGUOUSITERATOR_HPP_INCLUDED
+
+namespace lalr
+{
+
+template <class Iterator> class PositionIterator;
+
+/**
+// Traits to identify iterators over contiguous memory.
+//
+// Lexers that scan contiguous iterators refer to lexemes as spans of their 
+// input rather than copying each lexeme into a string.  Iterators are 
+// assumed not to be contiguous unless specialized otherwise.
+*/
+template <class Iterator>
+struct ContiguousIterator
+{
+    static const bool value = false; ///< True if the iterator is over contiguous memory otherwise false.
+};
+
+/**
+// Pointers are contiguous iterators.
+*/
+template <class Type>
+struct ContiguousIterator<Type*>
+{
+    static const bool value = true;
+
+    static Type* address( Type* iterator )
+    {
+        return iterator;
+    }
+};
+
+/**
+// PositionIterators are contiguous iterators when the iterators that they
+// wrap are.
+*/
+template <class Iterator>
+struct ContiguousIterator<PositionIterator<Iterator> >
+{
+    static const bool value = ContiguousIterator<Iterator>::value;
+
+    static auto address( const PositionIterator<Iterator>& iterator ) -> decltype( ContiguousIterator<Iterator>::address(iterator.base()) )
+    {
+        return ContiguousIterator<Iterator>::address( iterator.base() );
+    }
+};
+
+}
+
+#endif
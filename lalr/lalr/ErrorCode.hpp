@@ -20,7 +20,9 @@ enum ErrorCode
     PARSER_ERROR_PARSE_TABLE_CONFLICT, ///< A shift-reduce or reduce-reduce conflict was found in the parse table.
     PARSER_ERROR_UNDEFINED_SYMBOL, ///< A grammar symbol is referenced but not defined.
     PARSER_ERROR_UNREFERENCED_SYMBOL, ///< A grammar symbol is defined but not referenced.
-    PARSER_ERROR_ERROR_SYMBOL_ON_LEFT_HAND_SIDE ///< The 'error' symbol has been used on the left hand side of a production.
+    PARSER_ERROR_ERROR_SYMBOL_ON_LEFT_HAND_SIDE, ///< The 'error' symbol has been used on the left hand side of a production.
+    PARSER_ERROR_WRITING_FILE_FAILED, ///< Writing a compiled state machine file failed.
+    PARSER_ERROR_INVALID_FILE ///< A compiled state machine file is truncated, corrupt, or was written by a different version of the library.
 };
 
 }
@@ -14,6 +14,7 @@
 #include "RegexGenerator.hpp"
 #include "RegexToken.hpp"
 #include "ParserStateMachine.hpp"
+#include "ParserStateMachineFile.hpp"
 #include "ParserSymbol.hpp"
 #include "ParserState.hpp"
 #include "ParserAction.hpp"
@@ -22,12 +23,27 @@
 #include "ErrorPolicy.hpp"
 #include "assert.hpp"
 #include <iterator>
+#include <algorithm>
+#include <atomic>
+#include <stdint.h>
+#include <stdio.h>
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 using std::set;
+using std::string;
 using std::vector;
 using std::copy;
-using std::back_inserter;
+using std::fill;
+using std::pair;
+using std::make_pair;
+using std::move;
 using std::unique_ptr;
+using std::stable_sort;
+using std::back_inserter;
 using std::shared_ptr;
 using namespace lalr;
 
@@ -37,9 +53,18 @@ GrammarCompiler::GrammarCompiler()
   symbols_(),
   transitions_(),
   states_(),
+  transition_table_(),
+  compressed_base_(),
+  compressed_check_(),
+  compressed_next_(),
+  default_transitions_(),
   lexer_(),
   whitespace_lexer_(),
-  parser_state_machine_()
+  parser_state_machine_(),
+  cache_file_(),
+  cache_directory_(),
+  compressed_( false ),
+  fused_whitespace_( false )
 {
     lexer_.reset( new RegexCompiler );
     whitespace_lexer_.reset( new RegexCompiler );
@@ -66,20 +91,194 @@ const ParserStateMachine* GrammarCompiler::parser_state_machine() const
     return parser_state_machine_.get();
 }
 
+bool GrammarCompiler::compressed() const
+{
+    return compressed_;
+}
+
+void GrammarCompiler::set_compressed( bool compressed )
+{
+    compressed_ = compressed;
+}
+
+bool GrammarCompiler::fused_whitespace() const
+{
+    return fused_whitespace_;
+}
+
+/**
+// Set whether or not whitespace is matched by the lexer state machine.
+//
+// When fused the whitespace tokens are compiled into the lexer state 
+// machine with the state machine's whitespace symbol and the parser state
+// machine has no whitespace lexer state machine.  The Lexer then skips 
+// whitespace and matches the following token in a single pass over one
+// state machine rather than running two.  Whitespace tokens keep the line
+// of their %whitespace directive so between whitespace and a regular 
+// expression that match the same input the one on the earlier line is 
+// matched while literals always take priority over whitespace.
+//
+// @param fused_whitespace
+//  True to match whitespace in the lexer state machine or false to match it
+//  in a separate whitespace lexer state machine (the default).
+*/
+void GrammarCompiler::set_fused_whitespace( bool fused_whitespace )
+{
+    fused_whitespace_ = fused_whitespace;
+}
+
+const std::string& GrammarCompiler::cache_directory() const
+{
+    return cache_directory_;
+}
+
+/**
+// Set the directory to cache compiled state machines in.
+//
+// When set GrammarCompiler::compile() loads a previously compiled state 
+// machine for the same grammar, options, and library version from the 
+// cache directory if there is one and otherwise writes the state machine 
+// that it compiles into the cache directory.  State machines loaded from the
+// cache don't populate the lexers returned by GrammarCompiler::lexer() and 
+// GrammarCompiler::whitespace_lexer().
+//
+// @param cache_directory
+//  The existing directory to cache compiled state machines in or empty to
+//  disable caching (the default).
+*/
+void GrammarCompiler::set_cache_directory( const std::string& cache_directory )
+{
+    cache_directory_ = cache_directory;
+}
+
 void GrammarCompiler::compile( const char* begin, const char* end, ErrorPolicy* error_policy )
 {
+    cache_file_.reset();
+    string filename;
+    string key;
+    if ( !cache_directory_.empty() )
+    {
+        filename = cache_filename( begin, end );
+        key = cache_key( begin, end );
+        if ( load_cached_state_machine(filename, key) )
+        {
+            return;
+        }
+    }
+
     Grammar grammar;
 
     GrammarParser parser;
-    parser.parse( begin, end, &grammar );
+    bool parsed = parser.parse( begin, end, &grammar );
 
     GrammarGenerator generator;
     int errors = generator.generate( grammar, error_policy );
     if ( errors == 0 )
     {
         populate_parser_state_machine( grammar, generator );
-        populate_lexer_state_machine( generator, error_policy );
-        populate_whitespace_lexer_state_machine( grammar, error_policy );
+        errors += populate_lexer_state_machine( grammar, generator, error_policy );
+        errors += populate_whitespace_lexer_state_machine( grammar, error_policy );
+        if ( parsed && errors == 0 && !filename.empty() )
+        {
+            save_cached_state_machine( filename, key );
+        }
+    }
+}
+
+/**
+// Get the name of the file that caches the state machine compiled from 
+// [\e begin, \e end).
+//
+// The name is a 64 bit FNV-1a hash of the key returned by 
+// GrammarCompiler::cache_key().
+*/
+string GrammarCompiler::cache_filename( const char* begin, const char* end ) const
+{
+    const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ull;
+    const uint64_t FNV_PRIME = 1099511628211ull;
+    uint64_t hash = FNV_OFFSET_BASIS;
+    string key = cache_key( begin, end );
+    for ( string::const_iterator character = key.begin(); character != key.end(); ++character )
+    {
+        hash = (hash ^ uint8_t(*character)) * FNV_PRIME;
+    }
+
+    char name [32];
+    snprintf( name, sizeof(name), "%016llx.lalr", static_cast<unsigned long long>(hash) );
+    string filename = cache_directory_;
+    if ( filename.back() != '/' && filename.back() != '\\' )
+    {
+        filename += '/';
+    }
+    return filename + name;
+}
+
+/**
+// Get the key that identifies the state machine compiled from 
+// [\e begin, \e end).
+//
+// The key is the generator version, the file format version, and the 
+// options that affect the compiled state machine followed by the grammar.
+// It is stored in cached state machine files and compared when they are 
+// loaded so that a file is never used for a different grammar whose name 
+// hashes to the same value.
+*/
+string GrammarCompiler::cache_key( const char* begin, const char* end ) const
+{
+    LALR_ASSERT( begin <= end );
+    char options [64];
+    snprintf( options, sizeof(options), "lalr %d %d %d %d\n", GENERATOR_VERSION, ParserStateMachineFile::VERSION, compressed_ ? 1 : 0, fused_whitespace_ ? 1 : 0 );
+    string key( options );
+    key.append( begin, end );
+    return key;
+}
+
+/**
+// Load a cached state machine.
+//
+// The file is only used if it was saved with \e key; a grammar containing
+// null characters never matches the key stored in the file and so is never
+// loaded from the cache.
+*/
+bool GrammarCompiler::load_cached_state_machine( const std::string& filename, const std::string& key )
+{
+    unique_ptr<ParserStateMachineFile> cache_file( new ParserStateMachineFile );
+    if ( !cache_file->load(filename.c_str()) || !cache_file->key() || key.compare(cache_file->key()) != 0 )
+    {
+        return false;
+    }
+    *parser_state_machine_ = *cache_file->parser_state_machine();
+    cache_file_ = move( cache_file );
+    return true;
+}
+
+/**
+// Write the compiled state machine into the cache.
+//
+// The state machine is written to a temporary file that is then renamed so
+// that other processes never load a partially written file.  The temporary
+// file is named with the process id and a count of the files written by 
+// this process so that processes and threads caching the same grammar at 
+// the same time never write to the same file.  Failing to write the cache 
+// is silently ignored; the next compile just misses again.
+*/
+void GrammarCompiler::save_cached_state_machine( const std::string& filename, const std::string& key ) const
+{
+#if defined(_WIN32)
+    int process = _getpid();
+#else
+    int process = int( getpid() );
+#endif
+    static std::atomic<unsigned int> temporary_files( 0 );
+    char suffix [64];
+    snprintf( suffix, sizeof(suffix), ".%d.%u.tmp", process, temporary_files++ );
+    string temporary_filename = filename + suffix;
+    if ( ParserStateMachineFile::save(parser_state_machine_.get(), temporary_filename.c_str(), nullptr, key.c_str()) )
+    {
+        if ( rename(temporary_filename.c_str(), filename.c_str()) != 0 )
+        {
+            remove( temporary_filename.c_str() );
+        }
     }
 }
 
@@ -132,6 +331,31 @@ void GrammarCompiler::set_states( std::unique_ptr<ParserState[]>& states, int st
     parser_state_machine_->start_state = start_state;
 }
 
+void GrammarCompiler::set_transition_table( std::unique_ptr<int[]>& transition_table )
+{
+    LALR_ASSERT( transition_table );
+    transition_table_ = move( transition_table );
+    parser_state_machine_->transition_table = transition_table_.get();
+}
+
+void GrammarCompiler::set_compressed_transition_table( std::unique_ptr<int[]>& base, std::unique_ptr<int[]>& check, std::unique_ptr<int[]>& next, int compressed_size, std::unique_ptr<int[]>& default_transitions )
+{
+    LALR_ASSERT( base );
+    LALR_ASSERT( check );
+    LALR_ASSERT( next );
+    LALR_ASSERT( compressed_size >= 0 );
+    LALR_ASSERT( default_transitions );
+    compressed_base_ = move( base );
+    compressed_check_ = move( check );
+    compressed_next_ = move( next );
+    default_transitions_ = move( default_transitions );
+    parser_state_machine_->compressed_size = compressed_size;
+    parser_state_machine_->compressed_base = compressed_base_.get();
+    parser_state_machine_->compressed_check = compressed_check_.get();
+    parser_state_machine_->compressed_next = compressed_next_.get();
+    parser_state_machine_->default_transitions = default_transitions_.get();
+}
+
 void GrammarCompiler::set_lexer_allocations( std::unique_ptr<RegexCompiler>& lexer_allocations )
 {
     LALR_ASSERT( lexer_allocations.get() );
@@ -181,7 +405,7 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
         symbol->type = source_symbol->symbol_type();
     }
 
-    const set<shared_ptr<GrammarState>, GrammarStateLess>& grammar_states = generator.states();
+    const vector<shared_ptr<GrammarState>>& grammar_states = generator.states();
     int states_size = int(grammar_states.size());
     unique_ptr<ParserState[]> states( new ParserState [states_size] );
 
@@ -207,6 +431,7 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
         state->index = state_index;
         state->length = int(source_transitions.size());
         state->transitions = &transitions[transition_index];
+        state->default_reduction = grammar_state->default_reduction() ? &transitions[transition_index + grammar_state->default_reduction()->index()] : nullptr;
         if ( grammar_state == generator.start_state() )
         {
             start_state = state;
@@ -226,6 +451,7 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
             transition->reduced_length = source_transition->reduced_length();
             transition->precedence = source_transition->precedence();
             transition->action = source_transition->action();
+            transition->production = source_transition->production();
             transition->type = source_transition->type();
             transition->index = transition_index;
             ++transition_index;
@@ -238,9 +464,167 @@ void GrammarCompiler::populate_parser_state_machine( const Grammar& grammar, con
     set_symbols( symbols, symbols_size );
     set_transitions( transitions, transitions_size );
     set_states( states, states_size, start_state );
+    if ( compressed_ )
+    {
+        populate_compressed_transition_table();
+    }
+    else
+    {
+        populate_transition_table();
+    }
+}
+
+void GrammarCompiler::populate_transition_table()
+{
+    // Fill in the index of the first transition from each state on each 
+    // symbol; this matches the transition that a linear search through the
+    // state's transitions would find.
+    const int states_size = parser_state_machine_->states_size;
+    const int symbols_size = parser_state_machine_->symbols_size;
+    unique_ptr<int[]> transition_table( new int [states_size * symbols_size] );
+    fill( transition_table.get(), transition_table.get() + states_size * symbols_size, -1 );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const ParserState* state = &parser_state_machine_->states[i];
+        for ( int j = 0; j < state->length; ++j )
+        {
+            const ParserTransition* transition = &state->transitions[j];
+            int& index = transition_table[state->index * symbols_size + transition->symbol->index];
+            if ( index == -1 )
+            {
+                index = transition->index;
+            }
+        }
+    }
+    set_transition_table( transition_table );
+}
+
+void GrammarCompiler::populate_compressed_transition_table()
+{
+    const int states_size = parser_state_machine_->states_size;
+    const int symbols_size = parser_state_machine_->symbols_size;
+    const ParserSymbol* start_symbol = parser_state_machine_->start_symbol;
+
+    // Choose the most common reduction from each state as its default 
+    // transition.  Reductions that are equivalent at runtime (same reduced
+    // symbol, length, and action) are counted together.  Reductions to the
+    // start symbol accept the input and are never taken by default.
+    unique_ptr<int[]> default_transitions( new int [states_size] );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const ParserState* state = &parser_state_machine_->states[i];
+        int default_transition = -1;
+        int default_count = 0;
+        for ( int j = 0; j < state->length; ++j )
+        {
+            const ParserTransition* transition = &state->transitions[j];
+            if ( transition->type == TRANSITION_REDUCE && transition->reduced_symbol != start_symbol )
+            {
+                int count = 0;
+                for ( int k = 0; k < state->length; ++k )
+                {
+                    count += equivalent_reductions( transition, &state->transitions[k] ) ? 1 : 0;
+                }
+                if ( count > default_count )
+                {
+                    default_transition = transition->index;
+                    default_count = count;
+                }
+            }
+        }
+        default_transitions[state->index] = default_transition;
+    }
+
+    // Collect the remaining transitions for each state as (symbol, 
+    // transition) pairs keeping only the first transition on each symbol.
+    // Transitions on the error symbol are always kept as default 
+    // transitions aren't taken during error recovery.
+    vector<vector<pair<int, int>>> rows( states_size );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const ParserState* state = &parser_state_machine_->states[i];
+        const int default_transition = default_transitions[state->index];
+        vector<bool> symbols( symbols_size, false );
+        for ( int j = 0; j < state->length; ++j )
+        {
+            const ParserTransition* transition = &state->transitions[j];
+            int symbol = transition->symbol->index;
+            if ( !symbols[symbol] )
+            {
+                symbols[symbol] = true;
+                if ( default_transition == -1 || transition->symbol == parser_state_machine_->error_symbol || !equivalent_reductions(&parser_state_machine_->transitions[default_transition], transition) )
+                {
+                    rows[state->index].push_back( make_pair(symbol, transition->index) );
+                }
+            }
+        }
+    }
+
+    // Place rows into the compressed table, longest first, at the lowest 
+    // offset where none of their entries collide with entries already 
+    // placed.
+    vector<int> order( states_size );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        order[i] = i;
+    }
+    stable_sort( order.begin(), order.end(), [&rows]( int lhs, int rhs ) {
+        return rows[lhs].size() > rows[rhs].size();
+    } );
+
+    unique_ptr<int[]> base( new int [states_size] );
+    vector<int> check;
+    vector<int> next;
+    for ( auto i = order.begin(); i != order.end(); ++i )
+    {
+        const vector<pair<int, int>>& row = rows[*i];
+        int offset = 0;
+        bool collides = true;
+        while ( collides )
+        {
+            collides = false;
+            for ( auto j = row.begin(); j != row.end() && !collides; ++j )
+            {
+                int entry = offset + j->first;
+                collides = entry < int(check.size()) && check[entry] != -1;
+            }
+            offset += collides ? 1 : 0;
+        }
+
+        base[*i] = offset;
+        for ( auto j = row.begin(); j != row.end(); ++j )
+        {
+            int entry = offset + j->first;
+            if ( entry >= int(check.size()) )
+            {
+                check.resize( entry + 1, -1 );
+                next.resize( entry + 1, -1 );
+            }
+            check[entry] = *i;
+            next[entry] = j->second;
+        }
+    }
+
+    int compressed_size = int(check.size());
+    unique_ptr<int[]> compressed_check( new int [compressed_size] );
+    unique_ptr<int[]> compressed_next( new int [compressed_size] );
+    copy( check.begin(), check.end(), compressed_check.get() );
+    copy( next.begin(), next.end(), compressed_next.get() );
+    set_compressed_transition_table( base, compressed_check, compressed_next, compressed_size, default_transitions );
+}
+
+bool GrammarCompiler::equivalent_reductions( const ParserTransition* transition, const ParserTransition* other_transition )
+{
+    LALR_ASSERT( transition );
+    LALR_ASSERT( other_transition );
+    return 
+        transition->type == TRANSITION_REDUCE &&
+        other_transition->type == TRANSITION_REDUCE &&
+        transition->production == other_transition->production
+    ;
 }
 
-void GrammarCompiler::populate_lexer_state_machine( const GrammarGenerator& generator, ErrorPolicy* error_policy )
+int GrammarCompiler::populate_lexer_state_machine( const Grammar& grammar, const GrammarGenerator& generator, ErrorPolicy* error_policy )
 {
     // Generate tokens for generating the lexical analyzer from each of 
     // the terminal symbols in the grammar.
@@ -260,17 +644,35 @@ void GrammarCompiler::populate_lexer_state_machine( const GrammarGenerator& gene
         }
     }
 
-    lexer_->compile( tokens, error_policy );
+    // Fused whitespace tokens match the address one past the last symbol 
+    // so that the whitespace symbol is never a symbol in the grammar but 
+    // can still be written and loaded as an index into the symbols.
+    const void* whitespace_symbol = nullptr;
+    const vector<RegexToken>& whitespace_tokens = grammar.whitespace_tokens();
+    if ( fused_whitespace_ && !whitespace_tokens.empty() )
+    {
+        whitespace_symbol = symbols_.get() + parser_state_machine_->symbols_size;
+        for ( vector<RegexToken>::const_iterator token = whitespace_tokens.begin(); token != whitespace_tokens.end(); ++token )
+        {
+            tokens.push_back( RegexToken(token->type(), token->line(), whitespace_symbol, token->lexeme()) );
+        }
+    }
+
+    int errors = lexer_->compile( tokens, error_policy );
+    lexer_->set_whitespace_symbol( whitespace_symbol );
     parser_state_machine_->lexer_state_machine = lexer_->state_machine();
+    return errors;
 }
 
-void GrammarCompiler::populate_whitespace_lexer_state_machine( const Grammar& grammar, ErrorPolicy* error_policy )
+int GrammarCompiler::populate_whitespace_lexer_state_machine( const Grammar& grammar, ErrorPolicy* error_policy )
 {
     unique_ptr<RegexCompiler> whitespace_lexer_allocations;
     const vector<RegexToken>& whitespace_tokens = grammar.whitespace_tokens();
-    if ( !whitespace_tokens.empty() )
+    int errors = 0;
+    if ( !whitespace_tokens.empty() && !fused_whitespace_ )
     {
-        whitespace_lexer_->compile( whitespace_tokens, error_policy );
+        errors = whitespace_lexer_->compile( whitespace_tokens, error_policy );
         parser_state_machine_->whitespace_lexer_state_machine = whitespace_lexer_->state_machine();
     }
+    return errors;
 }
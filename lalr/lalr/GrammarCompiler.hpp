@@ -16,18 +16,32 @@ class ParserSymbol;
 class ParserTransition;
 class ParserState;
 class ParserStateMachine;
+class ParserStateMachineFile;
 class RegexCompiler;
 
 class GrammarCompiler
 {    
+public:
+    static const int GENERATOR_VERSION = 2; ///< The version of the state machines generated by this library; increment whenever a change alters the state machine generated from any grammar so that cached state machines are recompiled.
+
+private:
     std::deque<std::string> strings_;
     std::unique_ptr<ParserAction[]> actions_; ///< The parser actions for this ParserStateMachine.
     std::unique_ptr<ParserSymbol[]> symbols_; ///< The symbols in the grammar for this ParserStateMachine.
     std::unique_ptr<ParserTransition[]> transitions_; ///< The transitions in the state machine for this ParserStateMachine.
     std::unique_ptr<ParserState[]> states_; ///< The states in the state machine for this ParserStateMachine.
+    std::unique_ptr<int[]> transition_table_; ///< The dense table of transitions indexed by state and symbol for this ParserStateMachine.
+    std::unique_ptr<int[]> compressed_base_; ///< The offset of each state's row in the compressed transition table.
+    std::unique_ptr<int[]> compressed_check_; ///< The state that owns each entry in the compressed transition table.
+    std::unique_ptr<int[]> compressed_next_; ///< The transition for each entry in the compressed transition table.
+    std::unique_ptr<int[]> default_transitions_; ///< The default transition for each state in the compressed transition table.
     std::unique_ptr<RegexCompiler> lexer_; ///< Allocated lexer state machine.
     std::unique_ptr<RegexCompiler> whitespace_lexer_; ///< Allocated whitespace lexer state machine.
     std::unique_ptr<ParserStateMachine> parser_state_machine_; ///< Allocated parser state machine.
+    std::unique_ptr<ParserStateMachineFile> cache_file_; ///< The cached state machine loaded by the most recent compile or null if it wasn't loaded from the cache.
+    std::string cache_directory_; ///< The directory to cache compiled state machines in or empty to disable caching.
+    bool compressed_; ///< True to generate a compressed transition table rather than a dense one.
+    bool fused_whitespace_; ///< True to match whitespace in the lexer state machine rather than in a separate whitespace lexer state machine.
 
 public:
     GrammarCompiler();
@@ -35,19 +49,34 @@ public:
     const RegexCompiler* lexer() const;
     const RegexCompiler* whitespace_lexer() const;
     const ParserStateMachine* parser_state_machine() const;
+    bool compressed() const;
+    void set_compressed( bool compressed );
+    bool fused_whitespace() const;
+    void set_fused_whitespace( bool fused_whitespace );
+    const std::string& cache_directory() const;
+    void set_cache_directory( const std::string& cache_directory );
+    std::string cache_filename( const char* begin, const char* end ) const;
     void compile( const char* begin, const char* end, ErrorPolicy* error_policy = nullptr );
 
 private:
+    std::string cache_key( const char* begin, const char* end ) const;
+    bool load_cached_state_machine( const std::string& filename, const std::string& key );
+    void save_cached_state_machine( const std::string& filename, const std::string& key ) const;
     const char* add_string( const std::string& string );
     void set_actions( std::unique_ptr<ParserAction[]>& actions, int actions_size );
     void set_symbols( std::unique_ptr<ParserSymbol[]>& symbols, int symbols_size );
     void set_transitions( std::unique_ptr<ParserTransition[]>& transitions, int transitions_size );
     void set_states( std::unique_ptr<ParserState[]>& states, int states_size, const ParserState* start_state );
+    void set_transition_table( std::unique_ptr<int[]>& transition_table );
+    void set_compressed_transition_table( std::unique_ptr<int[]>& base, std::unique_ptr<int[]>& check, std::unique_ptr<int[]>& next, int compressed_size, std::unique_ptr<int[]>& default_transitions );
     void set_lexer_allocations( std::unique_ptr<RegexCompiler>& lexer_allocations );
     void set_whitespace_lexer_allocations( std::unique_ptr<RegexCompiler>& whitespace_lexer_allocations );
     void populate_parser_state_machine( const Grammar& grammar, const GrammarGenerator& generator );
-    void populate_lexer_state_machine( const GrammarGenerator& generator, ErrorPolicy* error_policy );
-    void populate_whitespace_lexer_state_machine( const Grammar& grammar, ErrorPolicy* error_policy );
+    void populate_transition_table();
+    void populate_compressed_transition_table();
+    static bool equivalent_reductions( const ParserTransition* transition, const ParserTransition* other_transition );
+    int populate_lexer_state_machine( const Grammar& grammar, const GrammarGenerator& generator, ErrorPolicy* error_policy );
+    int populate_whitespace_lexer_state_machine( const Grammar& grammar, ErrorPolicy* error_policy );
 };
 
 }
@@ -6,6 +6,8 @@
 #include "GrammarGenerator.hpp"
 #include "GrammarProduction.hpp"
 #include "GrammarState.hpp"
+#include "GrammarStateHash.hpp"
+#include "GrammarStateEqual.hpp"
 #include "GrammarItem.hpp"
 #include "Grammar.hpp"
 #include "GrammarSymbol.hpp"   
@@ -21,8 +23,15 @@
 #include "ErrorPolicy.hpp"
 #include "ErrorCode.hpp"
 #include "assert.hpp"
+#include <unordered_set>
+#include <limits.h>
 
+using std::map;
+using std::pair;
 using std::set;
+using std::min;
+using std::make_pair;
+using std::unordered_set;
 using std::vector;
 using std::unique_ptr;
 using std::shared_ptr;
@@ -67,7 +76,7 @@ const std::vector<std::unique_ptr<GrammarSymbol>>& GrammarGenerator::symbols() c
     return symbols_;
 }
 
-const std::set<std::shared_ptr<GrammarState>, GrammarStateLess>& GrammarGenerator::states() const
+const std::vector<std::shared_ptr<GrammarState>>& GrammarGenerator::states() const
 {
     return states_;
 }
@@ -101,10 +110,9 @@ int GrammarGenerator::generate( Grammar& grammar, ErrorPolicy* error_policy )
         calculate_terminal_and_non_terminal_symbols();
         calculate_implicit_terminal_symbols();
         calculate_symbol_indices();
-        calculate_first();
-        calculate_follow();
+        calculate_nullable();
         calculate_precedence_of_productions();
-        generate_states( start_symbol_, end_symbol_, symbols_ );
+        generate_states( start_symbol_, end_symbol_ );
     }
 
     int errors = errors_;
@@ -160,51 +168,6 @@ void GrammarGenerator::fire_printf( const char* format, ... ) const
     }
 }
 
-/**
-// Generate lookaheads for an item.
-//
-// @param item
-//  The item to generate lookaheads from.
-//
-// @return
-//  The generated lookahead symbols.
-*/
-std::set<const GrammarSymbol*, GrammarSymbolLess> GrammarGenerator::lookahead( const GrammarItem& item ) const
-{
-    set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols;
-
-    const GrammarProduction* production = item.production();
-    LALR_ASSERT( production );
-        
-    const vector<GrammarSymbol*>& symbols = production->symbols();    
-    vector<GrammarSymbol*>::const_iterator i = symbols.begin() + item.position();
-    if ( i != symbols.end() )
-    {
-        ++i;
-    }
-    
-    while ( i != symbols.end() && (*i)->nullable() )
-    {
-        const GrammarSymbol* symbol = *i;
-        LALR_ASSERT( symbol );
-        lookahead_symbols.insert( symbol->first().begin(), symbol->first().end() );
-        ++i;
-    }
-    
-    if ( i != symbols.end() )
-    {
-        const GrammarSymbol* symbol = *i;
-        LALR_ASSERT( symbol );
-        lookahead_symbols.insert( symbol->first().begin(), symbol->first().end() );
-    }
-    else
-    {
-        lookahead_symbols.insert( item.lookahead_symbols().begin(), item.lookahead_symbols().end() );
-    }
-
-    return lookahead_symbols;    
-}
-
 /**
 // Generate the closure of the items contained in \e state.
 //
@@ -238,114 +201,42 @@ void GrammarGenerator::closure( const std::shared_ptr<GrammarState>& state )
 }
 
 /**
-// Generate the state that results from accepting \e symbol from \e state.
+// Generate the kernels of the states that result from accepting each 
+// symbol that appears after the dot in an item in \e state.
+//
+// The items in \e state are grouped by the symbol after their dot so that 
+// each goto state is generated in a single pass over the items rather than
+// one pass per symbol in the grammar.  The closure of each goto state isn't
+// generated here so that states that already exist aren't closed again.
 //
 // @param state
 //  The state to generate from.
 //
-// @param symbol
-//  The symbol to accept to generate the goto state.
-//
 // @return
-//  The goto state generated when accepting \e symbol from \e state.
+//  The kernel of the goto state generated when accepting each symbol from 
+//  \e state.
 */
-std::shared_ptr<GrammarState> GrammarGenerator::goto_( const std::shared_ptr<GrammarState>& state, const GrammarSymbol& symbol )
+std::map<const GrammarSymbol*, std::shared_ptr<GrammarState>, GrammarSymbolLess> GrammarGenerator::goto_( const std::shared_ptr<GrammarState>& state )
 {
     LALR_ASSERT( state );
 
-    std::shared_ptr<GrammarState> goto_state( new GrammarState() );
+    map<const GrammarSymbol*, shared_ptr<GrammarState>, GrammarSymbolLess> goto_states;
 
     const set<GrammarItem>& items = state->items();
     for ( set<GrammarItem>::const_iterator item = items.begin(); item != items.end(); ++item )
     {
-        if ( item->next_node(symbol) )
-        {
-            goto_state->add_item( item->production(), item->position() + 1 );
-        }
-    }
-
-    closure( goto_state );
-    return goto_state;
-}
-
-/**
-// Generate lookaheads from the closure of the items contained in \e state.
-//
-// Adds the lookahead symbols from each item to the items added during the
-// closure of \e state.
-//
-// @param state
-//  The state to generate lookaheads from the closure of.
-//
-// @return
-//  The number of lookahead symbols generated.
-*/
-int GrammarGenerator::lookahead_closure( GrammarState* state ) const
-{
-    LALR_ASSERT( state );
-
-    int added = 0;
-
-    const set<GrammarItem>& items = state->items();
-    for ( set<GrammarItem>::const_iterator item = items.begin(); item != items.end(); ++item )
-    {          
         const GrammarSymbol* symbol = item->production()->symbol_by_position( item->position() );
-        if ( symbol )
+        if ( symbol && symbol != end_symbol_ )
         {
-            set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols = lookahead( *item );
-            const vector<GrammarProduction*>& productions = symbol->productions();
-            for ( vector<GrammarProduction*>::const_iterator j = productions.begin(); j != productions.end(); ++j )
+            shared_ptr<GrammarState>& goto_state = goto_states[symbol];
+            if ( !goto_state )
             {
-                GrammarProduction* production = *j;
-                LALR_ASSERT( production );
-                added += state->add_lookahead_symbols( production, 0, lookahead_symbols );
+                goto_state.reset( new GrammarState() );
             }
+            goto_state->add_item( item->production(), item->position() + 1 );
         }
     }
-
-    return added;
-}
-
-/**
-// Propagate lookaheads from \e state to the states that \e state has 
-// transitions to.
-//
-// This copies the lookaheads from each item in \e state to the equivalent 
-// item in the state that is transitioned to.  The equivalent item is the 
-// item for the same production with its position advanced by the symbol 
-// that was accepted on the transition.
-//
-// @param state
-//  The state to propagate lookahead symbols from.
-//
-// @return
-//  The number of lookahead symbols propagated.
-*/
-int GrammarGenerator::lookahead_goto( GrammarState* state ) const
-{
-    LALR_ASSERT( state );
-
-    int added = 0;
-
-    const set<GrammarTransition>& transitions = state->transitions();
-    for ( set<GrammarTransition>::const_iterator transition = transitions.begin(); transition != transitions.end(); ++transition )
-    {
-        const GrammarSymbol* symbol = transition->symbol();
-        LALR_ASSERT( symbol );
-
-        const set<GrammarItem>& items = state->items();
-        for ( set<GrammarItem>::const_iterator item = items.begin(); item != items.end(); ++item )
-        {
-            int position = item->position();
-            if ( item->production()->symbol_by_position(position) == symbol )
-            {
-                GrammarState* goto_state = transition->state();
-                added += goto_state->add_lookahead_symbols( item->production(), position + 1, item->lookahead_symbols() );
-            }
-        }        
-    }
-
-    return added;
+    return goto_states;
 }
 
 /**
@@ -565,10 +456,10 @@ void GrammarGenerator::calculate_symbol_indices()
 }
 
 /**
-// Calculate the first position sets for each GrammarSymbol until no more 
-// terminals can be added to any first position sets.
+// Calculate which GrammarSymbols are nullable until no more symbols become
+// nullable.
 */
-void GrammarGenerator::calculate_first()
+void GrammarGenerator::calculate_nullable()
 {
     int added = 1;
     while ( added > 0 )
@@ -578,46 +469,27 @@ void GrammarGenerator::calculate_first()
         {
             GrammarSymbol* symbol = i->get();
             LALR_ASSERT( symbol );
-            added += symbol->calculate_first();
+            added += symbol->calculate_nullable();
         }
     }
 }
 
 /**
-// Calculate the follow position sets for each GrammarSymbol until no more 
-// terminals can be added to any follow position sets.
-*/
-void GrammarGenerator::calculate_follow()
-{
-    start_symbol_->add_symbol_to_follow( end_symbol_ );
-
-    int added = 1;
-    while ( added > 0 )
-    {
-        added = 0;
-        for ( vector<unique_ptr<GrammarSymbol>>::iterator i = symbols_.begin(); i != symbols_.end(); ++i )
-        {
-            GrammarSymbol* symbol = i->get();
-            LALR_ASSERT( symbol );
-            added += symbol->calculate_follow();
-        }
-    }
-}
-
-/**
-// Generate the states for a grammar with \e symbols starting with 
-// \e start_symbol and ending when \e end_symbol is accepted.
+// Generate the states for a grammar starting with \e start_symbol and 
+// ending when \e end_symbol is accepted.
+//
+// States are appended to the state machine in the order that they are 
+// first reached and processed in that same order so that each state's goto
+// states are generated exactly once.  Existing states are found by hashing
+// their kernel items.
 //
 // @param start_symbol
 //  The start symbol for the grammar.
 //
 // @param end_symbol
 //  The end symbol for the grammar.
-//
-// @param symbols
-//  The symbols in the grammar.
 */
-void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol, const std::vector<std::unique_ptr<GrammarSymbol>>& symbols )
+void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol )
 {
     LALR_ASSERT( start_symbol );
     LALR_ASSERT( end_symbol );
@@ -628,61 +500,37 @@ void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const
         std::shared_ptr<GrammarState> start_state( new GrammarState() );
         start_state->add_item( start_symbol->productions().front(), 0 );
         closure( start_state );
-        states_.insert( start_state );
+        states_.push_back( start_state );
         start_state_ = start_state.get();
 
-        set<const GrammarSymbol*, GrammarSymbolLess> lookahead_symbols;
-        lookahead_symbols.insert( (GrammarSymbol*) end_symbol );
-        start_state->add_lookahead_symbols( start_symbol->productions().front(), 0, lookahead_symbols );
-        
-        int added = 1;
-        while ( added > 0 )
+        unordered_set<GrammarState*, GrammarStateHash, GrammarStateEqual> states;
+        states.insert( start_state.get() );
+
+        for ( size_t index = 0; index < states_.size(); ++index )
         {
-            added = 0;
-            for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
-            {
-                const std::shared_ptr<GrammarState>& state = *i;
-                LALR_ASSERT( state );
+            shared_ptr<GrammarState> state = states_[index];
+            LALR_ASSERT( state );
 
-                if ( !state->processed() )
+            map<const GrammarSymbol*, shared_ptr<GrammarState>, GrammarSymbolLess> goto_states = goto_( state );
+            for ( map<const GrammarSymbol*, shared_ptr<GrammarState>, GrammarSymbolLess>::const_iterator i = goto_states.begin(); i != goto_states.end(); ++i )
+            {
+                const GrammarSymbol* symbol = i->first;
+                const shared_ptr<GrammarState>& goto_state = i->second;
+                pair<unordered_set<GrammarState*, GrammarStateHash, GrammarStateEqual>::iterator, bool> inserted = states.insert( goto_state.get() );
+                if ( inserted.second )
                 {
-                    state->set_processed( true );
-                    for ( vector<unique_ptr<GrammarSymbol>>::const_iterator j = symbols.begin(); j != symbols.end(); ++j )
-                    {
-                        GrammarSymbol* symbol = j->get();
-                        LALR_ASSERT( symbol );
-                        if ( symbol != end_symbol )
-                        {
-                            std::shared_ptr<GrammarState> goto_state = goto_( state, *symbol );
-                            if ( !goto_state->items().empty() )
-                            {                    
-                                std::shared_ptr<GrammarState> actual_goto_state = *states_.insert( goto_state ).first;
-                                added += goto_state == actual_goto_state ? 1 : 0;
-                                state->add_transition( symbol, actual_goto_state.get() );
-                            }
-                        }
-                    }
+                    closure( goto_state );
+                    states_.push_back( goto_state );
                 }
+                state->add_transition( symbol, *inserted.first );
             }
         }
         
         generate_indices_for_states();
-
-        added = 1;
-        while ( added > 0 )
-        {
-            added = 0;
-            for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
-            {
-                GrammarState* state = i->get();
-                LALR_ASSERT( state );
-                added += lookahead_closure( state );
-                added += lookahead_goto( state );
-            }
-        }
-        
+        generate_lookaheads();
         generate_reduce_transitions();
         generate_indices_for_transitions();
+        generate_default_reductions( start_symbol );
     }
 }
 
@@ -692,7 +540,7 @@ void GrammarGenerator::generate_states( const GrammarSymbol* start_symbol, const
 void GrammarGenerator::generate_indices_for_states()
 {
     int index = 0;
-    for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::iterator i = states_.begin(); i != states_.end(); ++i )
+    for ( std::vector<std::shared_ptr<GrammarState>>::iterator i = states_.begin(); i != states_.end(); ++i )
     {
         GrammarState* state = i->get();
         LALR_ASSERT( state );
@@ -701,12 +549,225 @@ void GrammarGenerator::generate_indices_for_states()
     }
 }
 
+/**
+// Generate the LALR(1) lookaheads for the items that reduce in each state.
+//
+// Uses the relations of DeRemer and Pennello's "Efficient Computation of 
+// LALR(1) Look-Ahead Sets" over the transitions on non-terminal symbols.
+// The direct reads of a transition (p, A) are the terminals shifted from 
+// the state that it transitions to.  The reads relation adds the reads of
+// the transitions on nullable non-terminals from that state.  The includes
+// relation adds the follow sets of (p', B) to (p, A) when B -> x A y, y is
+// nullable, and p' transitions to p on x.  The lookaheads of the item that
+// reduces A -> w in state q are then the union of the follow sets of the 
+// transitions (p, A) where p transitions to q on w (the lookback relation).
+//
+// The start production is handled by a transition on the start symbol from
+// the start state that directly reads the end symbol.
+*/
+void GrammarGenerator::generate_lookaheads()
+{
+    LALR_ASSERT( start_state_ );
+    LALR_ASSERT( start_symbol_ );
+    LALR_ASSERT( end_symbol_ );
+
+    // Index the goto state for each state and symbol and collect the 
+    // transitions on non-terminal symbols.
+    const int symbols_size = int(symbols_.size());
+    const int states_size = int(states_.size());
+    vector<GrammarState*> goto_states( states_size * symbols_size, nullptr );
+    vector<int> non_terminal_transitions_by_state_and_symbol( states_size * symbols_size, -1 );
+    vector<pair<GrammarState*, const GrammarSymbol*>> non_terminal_transitions;
+    non_terminal_transitions.push_back( make_pair(start_state_, start_symbol_) );
+    for ( vector<shared_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+    {
+        GrammarState* state = i->get();
+        LALR_ASSERT( state );
+        const set<GrammarTransition>& transitions = state->transitions();
+        for ( set<GrammarTransition>::const_iterator transition = transitions.begin(); transition != transitions.end(); ++transition )
+        {
+            const GrammarSymbol* symbol = transition->symbol();
+            LALR_ASSERT( symbol );
+            goto_states[state->index() * symbols_size + symbol->index()] = transition->state();
+            if ( symbol->symbol_type() == SYMBOL_NON_TERMINAL )
+            {
+                non_terminal_transitions_by_state_and_symbol[state->index() * symbols_size + symbol->index()] = int(non_terminal_transitions.size());
+                non_terminal_transitions.push_back( make_pair(state, symbol) );
+            }
+        }
+    }
+
+    // Calculate the direct reads and reads relation for each transition.
+    const int non_terminal_transitions_size = int(non_terminal_transitions.size());
+    vector<GrammarSymbolSet> lookaheads( non_terminal_transitions_size );
+    vector<vector<int>> reads( non_terminal_transitions_size );
+    lookaheads[0].insert( end_symbol_->index() );
+    for ( int i = 1; i < non_terminal_transitions_size; ++i )
+    {
+        const GrammarState* state = non_terminal_transitions[i].first;
+        const GrammarSymbol* symbol = non_terminal_transitions[i].second;
+        const GrammarState* goto_state = goto_states[state->index() * symbols_size + symbol->index()];
+        LALR_ASSERT( goto_state );
+        const set<GrammarTransition>& transitions = goto_state->transitions();
+        for ( set<GrammarTransition>::const_iterator transition = transitions.begin(); transition != transitions.end(); ++transition )
+        {
+            const GrammarSymbol* read_symbol = transition->symbol();
+            if ( read_symbol->symbol_type() != SYMBOL_NON_TERMINAL )
+            {
+                lookaheads[i].insert( read_symbol->index() );
+            }
+            else if ( read_symbol->nullable() )
+            {
+                reads[i].push_back( non_terminal_transitions_by_state_and_symbol[goto_state->index() * symbols_size + read_symbol->index()] );
+            }
+        }
+    }
+    digraph( reads, &lookaheads );
+
+    // Calculate the includes and lookback relations by following each 
+    // production of each transition's symbol from the transition's state.
+    vector<vector<int>> includes( non_terminal_transitions_size );
+    vector<pair<GrammarState*, GrammarProduction*>> lookback_items;
+    vector<int> lookback_transitions;
+    for ( int i = 0; i < non_terminal_transitions_size; ++i )
+    {
+        GrammarState* state = non_terminal_transitions[i].first;
+        const GrammarSymbol* symbol = non_terminal_transitions[i].second;
+        const vector<GrammarProduction*>& productions = symbol->productions();
+        for ( vector<GrammarProduction*>::const_iterator j = productions.begin(); j != productions.end(); ++j )
+        {
+            GrammarProduction* production = *j;
+            LALR_ASSERT( production );
+            const vector<GrammarSymbol*>& symbols = production->symbols();
+            int nullable_suffix = int(symbols.size());
+            while ( nullable_suffix > 0 && symbols[nullable_suffix - 1]->nullable() )
+            {
+                --nullable_suffix;
+            }
+
+            GrammarState* goto_state = state;
+            for ( int position = 0; position < int(symbols.size()); ++position )
+            {
+                const GrammarSymbol* next_symbol = symbols[position];
+                int goto_index = goto_state->index() * symbols_size + next_symbol->index();
+                if ( next_symbol->symbol_type() == SYMBOL_NON_TERMINAL && position + 1 >= nullable_suffix )
+                {
+                    int included = non_terminal_transitions_by_state_and_symbol[goto_index];
+                    LALR_ASSERT( included >= 0 );
+                    includes[included].push_back( i );
+                }
+                goto_state = goto_states[goto_index];
+                LALR_ASSERT( goto_state );
+            }
+            lookback_items.push_back( make_pair(goto_state, production) );
+            lookback_transitions.push_back( i );
+        }
+    }
+    digraph( includes, &lookaheads );
+
+    for ( size_t i = 0; i < lookback_items.size(); ++i )
+    {
+        GrammarState* state = lookback_items[i].first;
+        GrammarProduction* production = lookback_items[i].second;
+        state->add_lookahead_symbols( production, production->length(), lookaheads[lookback_transitions[i]] );
+    }
+}
+
+/**
+// Union the sets of the elements reachable through \e relation into the 
+// set of each element.
+//
+// Uses the digraph algorithm from DeRemer and Pennello so that the sets of
+// the elements in each strongly connected component are only calculated 
+// once.
+//
+// @param relation
+//  The elements related to each element.
+//
+// @param sets
+//  The sets to union (assumed not null and the same size as \e relation).
+*/
+void GrammarGenerator::digraph( const std::vector<std::vector<int>>& relation, std::vector<GrammarSymbolSet>* sets ) const
+{
+    LALR_ASSERT( sets );
+    LALR_ASSERT( sets->size() == relation.size() );
+    vector<int> depths( relation.size(), 0 );
+    vector<int> stack;
+    for ( int element = 0; element < int(relation.size()); ++element )
+    {
+        if ( depths[element] == 0 )
+        {
+            traverse( element, relation, sets, &stack, &depths );
+        }
+    }
+}
+
+/**
+// Traverse \e element in the digraph algorithm.
+//
+// @param element
+//  The element to traverse.
+//
+// @param relation
+//  The elements related to each element.
+//
+// @param sets
+//  The sets to union (assumed not null).
+//
+// @param stack
+//  The elements traversed but not yet assigned to a strongly connected 
+//  component (assumed not null).
+//
+// @param depths
+//  The depth on the stack of each element; 0 for elements that haven't 
+//  been traversed and INT_MAX for elements that are finished (assumed not
+//  null).
+*/
+void GrammarGenerator::traverse( int element, const std::vector<std::vector<int>>& relation, std::vector<GrammarSymbolSet>* sets, std::vector<int>* stack, std::vector<int>* depths ) const
+{
+    LALR_ASSERT( element >= 0 && element < int(relation.size()) );
+    LALR_ASSERT( sets );
+    LALR_ASSERT( stack );
+    LALR_ASSERT( depths );
+
+    stack->push_back( element );
+    int depth = int(stack->size());
+    (*depths)[element] = depth;
+
+    const vector<int>& related_elements = relation[element];
+    for ( vector<int>::const_iterator i = related_elements.begin(); i != related_elements.end(); ++i )
+    {
+        int related_element = *i;
+        if ( (*depths)[related_element] == 0 )
+        {
+            traverse( related_element, relation, sets, stack, depths );
+        }
+        (*depths)[element] = min( (*depths)[element], (*depths)[related_element] );
+        (*sets)[element].insert( (*sets)[related_element] );
+    }
+
+    if ( (*depths)[element] == depth )
+    {
+        int top = INT_MAX;
+        while ( top != element )
+        {
+            top = stack->back();
+            stack->pop_back();
+            (*depths)[top] = INT_MAX;
+            if ( top != element )
+            {
+                (*sets)[top] = (*sets)[element];
+            }
+        }
+    }
+}
+
 /**
 // Generate reduction transitions.
 */
 void GrammarGenerator::generate_reduce_transitions()
 {
-    for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+    for ( std::vector<std::shared_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
     {
         GrammarState* state = i->get();
         LALR_ASSERT( state );
@@ -715,11 +776,11 @@ void GrammarGenerator::generate_reduce_transitions()
         {
             if ( item->dot_at_end() )
             {
-                const set<const GrammarSymbol*, GrammarSymbolLess>& symbols = item->lookahead_symbols();
-                for ( set<const GrammarSymbol*>::const_iterator j = symbols.begin(); j != symbols.end(); ++j )
+                const GrammarSymbolSet& symbols = item->lookahead_symbols();
+                for ( int j = symbols.next(0); j != GrammarSymbolSet::INVALID_INDEX; j = symbols.next(j + 1) )
                 {
-                    const GrammarSymbol* symbol = *j;
-                    LALR_ASSERT( symbol );
+                    const GrammarSymbol* symbol = symbols_[j].get();
+                    LALR_ASSERT( symbol && symbol->index() == j );
                     generate_reduce_transition( state, symbol, item->production() );
                 }
             }                
@@ -748,7 +809,7 @@ void GrammarGenerator::generate_reduce_transition( GrammarState* state, const Gr
     GrammarTransition* transition = state->find_transition_by_symbol( symbol );
     if ( !transition )
     {
-        state->add_transition( symbol, production->symbol(), production->length(), production->precedence(), production->action_index() );
+        state->add_transition( symbol, production->symbol(), production->length(), production->precedence(), production->action_index(), production->index() );
     }
     else
     {
@@ -762,7 +823,7 @@ void GrammarGenerator::generate_reduce_transition( GrammarState* state, const Gr
                 }
                 else if ( production->precedence() > symbol->precedence() || (symbol->precedence() == production->precedence() && symbol->associativity() == ASSOCIATE_RIGHT) )
                 {
-                    transition->override_shift_to_reduce( production->symbol(), production->length(), production->precedence(), production->action_index() );
+                    transition->override_shift_to_reduce( production->symbol(), production->length(), production->precedence(), production->action_index(), production->index() );
                 }
 
                 break;
@@ -776,7 +837,7 @@ void GrammarGenerator::generate_reduce_transition( GrammarState* state, const Gr
                 }
                 else if ( production->precedence() > transition->precedence() )
                 {
-                    transition->override_reduce_to_reduce( production->symbol(), production->length(), production->precedence(), production->action_index() );
+                    transition->override_reduce_to_reduce( production->symbol(), production->length(), production->precedence(), production->action_index(), production->index() );
                 }
                 break;
             }
@@ -793,10 +854,27 @@ void GrammarGenerator::generate_reduce_transition( GrammarState* state, const Gr
 */
 void GrammarGenerator::generate_indices_for_transitions()
 {
-    for ( std::set<std::shared_ptr<GrammarState>, GrammarStateLess>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+    for ( std::vector<std::shared_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
     {
         GrammarState* state = i->get();
         LALR_ASSERT( state );
         state->generate_indices_for_transitions();        
     }
 }
+
+/**
+// Mark the states that reduce a single production on every lookahead as 
+// default reduction states.
+//
+// @param start_symbol
+//  The start symbol of the grammar.
+*/
+void GrammarGenerator::generate_default_reductions( const GrammarSymbol* start_symbol )
+{
+    for ( std::vector<std::shared_ptr<GrammarState>>::const_iterator i = states_.begin(); i != states_.end(); ++i )
+    {
+        GrammarState* state = i->get();
+        LALR_ASSERT( state );
+        state->generate_default_reduction( start_symbol );
+    }
+}
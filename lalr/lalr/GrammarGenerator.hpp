@@ -3,8 +3,9 @@
 
 #include "RegexToken.hpp"
 #include "GrammarSymbolLess.hpp"
-#include "GrammarStateLess.hpp"
+#include "GrammarSymbolSet.hpp"
 #include <memory>
+#include <map>
 #include <set>
 #include <vector>
 #include <string>
@@ -34,7 +35,7 @@ class GrammarGenerator
     std::vector<std::unique_ptr<GrammarAction>> actions_; ///< The actions in the parser.
     std::vector<std::unique_ptr<GrammarProduction>> productions_; ///< The productions in the parser.
     std::vector<std::unique_ptr<GrammarSymbol>> symbols_; ///< The symbols in the parser.
-    std::set<std::shared_ptr<GrammarState>, GrammarStateLess> states_; ///< The states in the parser's state machine.
+    std::vector<std::shared_ptr<GrammarState>> states_; ///< The states in the parser's state machine in index order.
     GrammarSymbol* start_symbol_; ///< The start symbol.
     GrammarSymbol* end_symbol_; ///< The end symbol.
     GrammarSymbol* error_symbol_; ///< The error symbol.
@@ -46,18 +47,15 @@ class GrammarGenerator
         ~GrammarGenerator();
         const std::vector<std::unique_ptr<GrammarAction>>& actions() const;
         const std::vector<std::unique_ptr<GrammarSymbol>>& symbols() const;
-        const std::set<std::shared_ptr<GrammarState>, GrammarStateLess>& states() const;
+        const std::vector<std::shared_ptr<GrammarState>>& states() const;
         const GrammarState* start_state() const;
         int generate( Grammar& grammar, ErrorPolicy* error_policy );
                 
     private:
         void fire_error( int line, int error, const char* format, ... );
         void fire_printf( const char* format, ... ) const;
-        std::set<const GrammarSymbol*, GrammarSymbolLess> lookahead( const GrammarItem& item ) const;
         void closure( const std::shared_ptr<GrammarState>& state );
-        std::shared_ptr<GrammarState> goto_( const std::shared_ptr<GrammarState>& state, const GrammarSymbol& symbol );
-        int lookahead_closure( GrammarState* state ) const;
-        int lookahead_goto( GrammarState* state ) const;
+        std::map<const GrammarSymbol*, std::shared_ptr<GrammarState>, GrammarSymbolLess> goto_( const std::shared_ptr<GrammarState>& state );
         void replace_references_to_symbol( GrammarSymbol* to_symbol, GrammarSymbol* with_symbol );
         void check_for_undefined_symbol_errors();
         void check_for_unreferenced_symbol_errors();
@@ -67,13 +65,16 @@ class GrammarGenerator
         void calculate_implicit_terminal_symbols();
         void calculate_precedence_of_productions();
         void calculate_symbol_indices();
-        void calculate_first();
-        void calculate_follow();
-        void generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol, const std::vector<std::unique_ptr<GrammarSymbol>>& symbols );
+        void calculate_nullable();
+        void generate_states( const GrammarSymbol* start_symbol, const GrammarSymbol* end_symbol );
         void generate_indices_for_states();
+        void generate_lookaheads();
+        void digraph( const std::vector<std::vector<int>>& relation, std::vector<GrammarSymbolSet>* sets ) const;
+        void traverse( int element, const std::vector<std::vector<int>>& relation, std::vector<GrammarSymbolSet>* sets, std::vector<int>* stack, std::vector<int>* depths ) const;
         void generate_reduce_transitions();
         void generate_reduce_transition( GrammarState* state, const GrammarSymbol* symbol, const GrammarProduction* production );
         void generate_indices_for_transitions();
+        void generate_default_reductions( const GrammarSymbol* start_symbol );
 };
 
 }
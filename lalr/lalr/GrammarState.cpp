@@ -5,6 +5,7 @@
 
 #include "GrammarState.hpp"
 #include "GrammarItem.hpp"
+#include "GrammarProduction.hpp"
 #include "GrammarTransition.hpp"
 #include "assert.hpp"
 #include <stdio.h>
@@ -18,7 +19,7 @@ using namespace lalr;
 GrammarState::GrammarState()
 : items_(),
   transitions_(),
-  processed_( false ),
+  default_reduction_( nullptr ),
   index_( INVALID_INDEX )
 {
 }
@@ -73,14 +74,14 @@ const std::set<GrammarTransition>& GrammarState::transitions() const
 }
 
 /**
-// Has this state been processed?
+// Get the reduction taken from this state without consulting the lookahead.
 //
 // @return
-//  True if this state has been processed otherwise false.
+//  The default reduction or null if this state has no default reduction.
 */
-bool GrammarState::processed() const
+const GrammarTransition* GrammarState::default_reduction() const
 {
-    return processed_;
+    return default_reduction_;
 }
 
 /**
@@ -95,17 +96,66 @@ int GrammarState::index() const
 }
 
 /**
-// Less than operator.
+// Hash the kernel items in this state.
+//
+// The kernel items are the items with the dot after the beginning of their
+// production.  The remaining items are added by the closure of the kernel 
+// items so states with the same kernel items are the same state and only 
+// the kernel items need to be hashed and compared.  The start state's only
+// kernel item has its dot at the beginning but no other state has an empty
+// kernel so it is still distinct.
+//
+// @return
+//  The hash of the kernel items in this state.
+*/
+size_t GrammarState::hash() const
+{
+    size_t hash = 0;
+    for ( set<GrammarItem>::const_iterator item = items_.begin(); item != items_.end(); ++item )
+    {
+        if ( !item->dot_at_beginning() )
+        {
+            hash = hash * 31 + size_t(item->production()->index()) * 131 + size_t(item->position());
+        }
+    }
+    return hash;
+}
+
+/**
+// Equality operator.
 //
 // @param state
 //  The state to compare this state with.
 //
 // @return
-//  True if the items in this state are less than the items in \e state.
+//  True if the kernel items in this state are the same as the kernel items
+//  in \e state.
 */
-bool GrammarState::operator<( const GrammarState& state ) const
+bool GrammarState::operator==( const GrammarState& state ) const
 {
-    return std::lexicographical_compare( items_.begin(), items_.end(), state.items_.begin(), state.items_.end() );
+    set<GrammarItem>::const_iterator i = items_.begin();
+    set<GrammarItem>::const_iterator j = state.items_.begin();
+    for ( ;; )
+    {
+        while ( i != items_.end() && i->dot_at_beginning() )
+        {
+            ++i;
+        }
+        while ( j != state.items_.end() && j->dot_at_beginning() )
+        {
+            ++j;
+        }
+        if ( i == items_.end() || j == state.items_.end() )
+        {
+            return i == items_.end() && j == state.items_.end();
+        }
+        if ( i->production() != j->production() || i->position() != j->position() )
+        {
+            return false;
+        }
+        ++i;
+        ++j;
+    }
 }
 
 /**
@@ -142,7 +192,7 @@ int GrammarState::add_item( GrammarProduction* production, int position )
 // @return
 //  The number of lookahead symbols added.
 */
-int GrammarState::add_lookahead_symbols( GrammarProduction* production, int position, const std::set<const GrammarSymbol*, GrammarSymbolLess>& lookahead_symbols )
+int GrammarState::add_lookahead_symbols( GrammarProduction* production, int position, const GrammarSymbolSet& lookahead_symbols )
 {
     LALR_ASSERT( production );
     std::set<GrammarItem>::iterator item = items_.find( GrammarItem(production, position) );
@@ -183,23 +233,26 @@ void GrammarState::add_transition( const GrammarSymbol* symbol, GrammarState* st
 // @param action
 //  The index of the action taken on the reduction or 
 //  `Action::INVALID_INDEX` if no action is taken.
+//
+// @param production
+//  The index of the production that is reduced.
 */
-void GrammarState::add_transition( const GrammarSymbol* symbol, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action )
+void GrammarState::add_transition( const GrammarSymbol* symbol, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action, int production )
 {
     LALR_ASSERT( symbol );
     LALR_ASSERT( reduced_symbol );
     LALR_ASSERT( reduced_length >= 0 );
     LALR_ASSERT( precedence >= 0 );
 
-    std::set<GrammarTransition>::iterator transition = transitions_.find( GrammarTransition(symbol, reduced_symbol, reduced_length, precedence, action) );
+    std::set<GrammarTransition>::iterator transition = transitions_.find( GrammarTransition(symbol, reduced_symbol, reduced_length, precedence, action, production) );
     if ( transition != transitions_.end() )
     {        
         LALR_ASSERT( transition->type() == TRANSITION_SHIFT );
-        transition->override_shift_to_reduce( reduced_symbol, reduced_length, precedence, action );
+        transition->override_shift_to_reduce( reduced_symbol, reduced_length, precedence, action, production );
     }
     else
     {
-        transition = transitions_.insert( GrammarTransition(symbol, reduced_symbol, reduced_length, precedence, action) ).first;
+        transition = transitions_.insert( GrammarTransition(symbol, reduced_symbol, reduced_length, precedence, action, production) ).first;
     }
 }
 
@@ -220,8 +273,11 @@ void GrammarState::add_transition( const GrammarSymbol* symbol, const GrammarSym
 // @param action
 //  The index of the action taken on the reduction or 
 //  `Action::INVALID_INDEX` if no action is taken.
+//
+// @param production
+//  The index of the production that is reduced.
 */
-void GrammarState::add_transition( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action )
+void GrammarState::add_transition( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action, int production )
 {
     LALR_ASSERT( reduced_symbol );
     LALR_ASSERT( reduced_length >= 0 );
@@ -230,7 +286,7 @@ void GrammarState::add_transition( const std::set<const GrammarSymbol*, GrammarS
     {
         const GrammarSymbol* symbol = *i;
         LALR_ASSERT( symbol );
-        add_transition( symbol, reduced_symbol, reduced_length, precedence, action );
+        add_transition( symbol, reduced_symbol, reduced_length, precedence, action, production );
     }
 }
 
@@ -275,14 +331,39 @@ void GrammarState::generate_indices_for_transitions()
 }
 
 /**
-// Set this state as having been processed.
+// Generate the default reduction for this state.
+//
+// A state has a default reduction when it has no shift transitions and all
+// of its transitions reduce the same production.  The parser then reduces
+// from this state on any lookahead without searching its transitions; an 
+// unexpected lookahead is still detected, as a syntax error, in the state 
+// that is reached after the reduction.  Reductions to the start symbol 
+// accept the input and are never made default reductions.
 //
-// @param processed
-//  True to mark this state as processed or false to mark it as not processed.
+// @param start_symbol
+//  The start symbol of the grammar.
 */
-void GrammarState::set_processed( bool processed )
+void GrammarState::generate_default_reduction( const GrammarSymbol* start_symbol )
 {
-    processed_ = processed;
+    default_reduction_ = nullptr;
+    for ( std::set<GrammarTransition>::const_iterator transition = transitions_.begin(); transition != transitions_.end(); ++transition )
+    {
+        if ( transition->type() != TRANSITION_REDUCE || transition->reduced_symbol() == start_symbol )
+        {
+            default_reduction_ = nullptr;
+            return;
+        }
+
+        if ( !default_reduction_ )
+        {
+            default_reduction_ = &(*transition);
+        }
+        else if ( transition->production() != default_reduction_->production() )
+        {
+            default_reduction_ = nullptr;
+            return;
+        }
+    }
 }
 
 /**
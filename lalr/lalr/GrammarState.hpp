@@ -6,6 +6,7 @@
 #include "GrammarSymbolLess.hpp"
 #include <memory>
 #include <set>
+#include <stddef.h>
 
 namespace lalr
 {
@@ -19,7 +20,7 @@ class GrammarState
 {
     std::set<GrammarItem> items_; ///< The items that define the positions within the grammar that this state represents.
     std::set<GrammarTransition> transitions_; ///< The available transitions from this state.
-    bool processed_; ///< True if this state has been processed during state machine generation otherwise false.
+    const GrammarTransition* default_reduction_; ///< The reduction taken from this state on any lookahead or null if this state has no default reduction.
     int index_; ///< The index of this state.
 
 public:
@@ -28,18 +29,19 @@ public:
     const std::set<GrammarItem>& items() const;
     const GrammarTransition* find_transition_by_symbol( const GrammarSymbol* symbol ) const;
     const std::set<GrammarTransition>& transitions() const;
-    bool processed() const;
+    const GrammarTransition* default_reduction() const;
     int index() const;
-    bool operator<( const GrammarState& state ) const;
+    size_t hash() const;
+    bool operator==( const GrammarState& state ) const;
 
     int add_item( GrammarProduction* production, int position );
-    int add_lookahead_symbols( GrammarProduction* production, int position, const std::set<const GrammarSymbol*, GrammarSymbolLess>& lookahead_symbols );
+    int add_lookahead_symbols( GrammarProduction* production, int position, const GrammarSymbolSet& lookahead_symbols );
     void add_transition( const GrammarSymbol* symbol, GrammarState* state );
-    void add_transition( const GrammarSymbol* symbol, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action );
-    void add_transition( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action );
+    void add_transition( const GrammarSymbol* symbol, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action, int production );
+    void add_transition( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action, int production );
     void generate_indices_for_transitions();
+    void generate_default_reduction( const GrammarSymbol* start_symbol );
     GrammarTransition* find_transition_by_symbol( const GrammarSymbol* symbol );
-    void set_processed( bool processed );
     void set_index( int index );
 
     static const int INVALID_INDEX = -1;
@@ -0,0 +1,17 @@
+//
+// GrammarStateEqual.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "GrammarStateEqual.hpp"
+#include "GrammarState.hpp"
+#include "assert.hpp"
+
+using namespace lalr;
+
+bool GrammarStateEqual::operator()( const GrammarState* lhs, const GrammarState* rhs ) const
+{
+    LALR_ASSERT( lhs );
+    LALR_ASSERT( rhs );
+    return *lhs == *rhs;
+}
@@ -0,0 +1,20 @@
+#ifndef LALR_GRAMMARSTATEEQUAL_HPP_INCLUDED
+#define LALR_GRAMMARSTATEEQUAL_HPP_INCLUDED
+
+namespace lalr
+{
+
+class GrammarState;
+
+/**
+// Indirectly compare the kernel items of two states through raw pointers.
+*/
+class GrammarStateEqual
+{
+public:
+    bool operator()( const GrammarState* lhs, const GrammarState* rhs ) const;
+};
+
+}
+
+#endif
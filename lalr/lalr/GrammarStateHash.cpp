@@ -0,0 +1,16 @@
+//
+// GrammarStateHash.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "GrammarStateHash.hpp"
+#include "GrammarState.hpp"
+#include "assert.hpp"
+
+using namespace lalr;
+
+size_t GrammarStateHash::operator()( const GrammarState* state ) const
+{
+    LALR_ASSERT( state );
+    return state->hash();
+}
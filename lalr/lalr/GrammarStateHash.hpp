@@ -0,0 +1,22 @@
+#ifndef LALR_GRAMMARSTATEHASH_HPP_INCLUDED
+#define LALR_GRAMMARSTATEHASH_HPP_INCLUDED
+
+#include <stddef.h>
+
+namespace lalr
+{
+
+class GrammarState;
+
+/**
+// Indirectly hash the kernel items of a state through a raw pointer.
+*/
+class GrammarStateHash
+{
+public:
+    size_t operator()( const GrammarState* state ) const;
+};
+
+}
+
+#endif
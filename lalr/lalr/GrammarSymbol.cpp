@@ -23,8 +23,6 @@ GrammarSymbol::GrammarSymbol( const std::string& lexeme )
   line_( 0 ),
   index_( -1 ),
   nullable_( false ),
-  first_(),
-  follow_(),
   productions_()
 {
 }
@@ -74,16 +72,6 @@ bool GrammarSymbol::nullable() const
     return nullable_;
 }
 
-const std::set<const GrammarSymbol*, GrammarSymbolLess>& GrammarSymbol::first() const
-{
-    return first_;
-}
-
-const std::set<const GrammarSymbol*, GrammarSymbolLess>& GrammarSymbol::follow() const
-{
-    return follow_;
-}
-
 const std::vector<GrammarProduction*>& GrammarSymbol::productions() const
 {
     return productions_;
@@ -384,154 +372,38 @@ void GrammarSymbol::replace_by_non_terminal( const GrammarSymbol* non_terminal_s
 }
 
 /**
-// Add a symbol to the first set of this symbol.
-//
-// @param symbol
-//  The symbol to add to the first set of this symbol.
-//
-// @return
-//  The number of symbols added (0 or 1).
-*/
-int GrammarSymbol::add_symbol_to_first( const GrammarSymbol* symbol )
-{
-    LALR_ASSERT( symbol );
-    return first_.insert( symbol ).second ? 1 : 0;
-}
-
-/**
-// Add one or more symbols to the first set of this symbol.
+// Calculate whether or not this symbol is nullable.
 //
-// @param symbols
-//  The symbols to add to the first set of this symbol.
+// A non-terminal symbol is nullable if any of its productions consists
+// only of nullable symbols.
 //
 // @return
-//  The number of symbols added.
+//  One if this symbol became nullable otherwise zero.
 */
-int GrammarSymbol::add_symbols_to_first( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols )
+int GrammarSymbol::calculate_nullable()
 {
-    size_t original_size = first_.size();
-    first_.insert( symbols.begin(), symbols.end() );
-    return int(first_.size() - original_size);
-}
-
-/**
-// Add a symbol to the follow set of this symbol.
-//
-// @param symbol
-//  The symbol to add to the follow set of this symbol.
-//
-// @return
-//  The number of symbols added (0 or 1).
-*/
-int GrammarSymbol::add_symbol_to_follow( const GrammarSymbol* symbol )
-{
-    LALR_ASSERT( symbol );
-    return follow_.insert( symbol ).second ? 1 : 0;
-}
-
-/**
-// Add symbols to the follow set of this symbol.
-//
-// @param symbols
-//  The symbols to add to the follow set of this symbol.
-//
-// @return
-//  The number of symbols added.
-*/
-int GrammarSymbol::add_symbols_to_follow( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols )
-{
-    size_t original_size = follow_.size();
-    follow_.insert( symbols.begin(), symbols.end() );
-    return int(follow_.size() - original_size);
-}
-
-/**
-// Calculate the first set and nullable for this symbol.
-//
-// @return
-//  The number of symbols added to the first set and plus one if nullable
-//  changed for this symbol.
-*/
-int GrammarSymbol::calculate_first()
-{
-    int added = 0;
-    if ( symbol_type_ == SYMBOL_NON_TERMINAL )
-    {
-        for ( vector<GrammarProduction*>::const_iterator i = productions_.begin(); i != productions_.end(); ++i )
-        {
-            const GrammarProduction* production = *i;
-            LALR_ASSERT( production );  
-                  
-            const vector<GrammarSymbol*>& symbols = production->symbols();
-            vector<GrammarSymbol*>::const_iterator j = symbols.begin(); 
-            while ( j != symbols.end() && (*j)->nullable() )
-            {
-                const GrammarSymbol* symbol = *j;
-                LALR_ASSERT( symbol );
-                added += add_symbols_to_first( symbol->first() );
-                ++j;
-            }
-            
-            if ( j != symbols.end() )
-            {
-                const GrammarSymbol* symbol = *j;
-                LALR_ASSERT( symbol );
-                added += add_symbols_to_first( symbol->first() );
-            }
-            else
-            {
-                added += nullable_ ? 0 : 1;
-                nullable_ = true;
-            }
-        }
-    }
-    else
+    if ( symbol_type_ != SYMBOL_NON_TERMINAL || nullable_ )
     {
-        added += add_symbol_to_first( this );
+        return 0;
     }
-    return added;
-}
 
-/**
-// Calculate the follow set for this symbol.
-//
-// @return
-//  The number of symbols added to the follow set.
-*/
-int GrammarSymbol::calculate_follow()
-{
-    int added = 0;
     for ( vector<GrammarProduction*>::const_iterator i = productions_.begin(); i != productions_.end(); ++i )
     {
         const GrammarProduction* production = *i;
         LALR_ASSERT( production );
-                    
+
         const vector<GrammarSymbol*>& symbols = production->symbols();
-        if ( !symbols.empty() )
+        vector<GrammarSymbol*>::const_iterator j = symbols.begin(); 
+        while ( j != symbols.end() && (*j)->nullable() )
         {
-            vector<GrammarSymbol*>::const_reverse_iterator j = symbols.rbegin(); 
-            GrammarSymbol* symbol = *j;
-            added += symbol->add_symbols_to_follow( follow() );
             ++j;
-        
-            while ( j != symbols.rend() && symbol->nullable() )
-            {
-                GrammarSymbol* previous_symbol = *j;
-                LALR_ASSERT( previous_symbol );
-                added += previous_symbol->add_symbols_to_follow( symbol->first() );
-                added += previous_symbol->add_symbols_to_follow( follow() );
-                symbol = previous_symbol;
-                ++j;                
-            }
-            
-            while ( j != symbols.rend() )
-            {
-                GrammarSymbol* previous_symbol = *j;
-                LALR_ASSERT( previous_symbol );
-                added += previous_symbol->add_symbols_to_follow( symbol->first() );
-                ++j;
-            }
+        }
+
+        if ( j == symbols.end() )
+        {
+            nullable_ = true;
+            return 1;
         }
     }
-    return added;
+    return 0;
 }
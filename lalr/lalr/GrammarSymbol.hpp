@@ -1,7 +1,6 @@
 #ifndef LALR_GRAMMARSYMBOL_HPP_INCLUDED
 #define LALR_GRAMMARSYMBOL_HPP_INCLUDED
 
-#include "GrammarSymbolLess.hpp"
 #include "SymbolType.hpp"
 #include "LexemeType.hpp"
 #include "Associativity.hpp"
@@ -25,8 +24,6 @@ class GrammarSymbol
     int line_;
     int index_;
     bool nullable_; ///< True if this symbol is nullable otherwise false.
-    std::set<const GrammarSymbol*, GrammarSymbolLess> first_; ///< The symbols that can start this symbol in a production or regular expression.
-    std::set<const GrammarSymbol*, GrammarSymbolLess> follow_; ///< The symbols that can follow this symbol in a production or regular expression.
     std::vector<GrammarProduction*> productions_; ///< The productions that reduce to this symbol.
 
 public:
@@ -41,8 +38,6 @@ public:
     int line() const;
     int index() const;
     bool nullable() const;
-    const std::set<const GrammarSymbol*, GrammarSymbolLess>& first() const;
-    const std::set<const GrammarSymbol*, GrammarSymbolLess>& follow() const;
     const std::vector<GrammarProduction*>& productions() const;
     GrammarSymbol* implicit_terminal() const;
     bool matches( const std::string& lexeme, SymbolType symbol_type ) const;
@@ -59,12 +54,7 @@ public:
     void append_production( GrammarProduction* production );
     void calculate_identifier();
     void replace_by_non_terminal( const GrammarSymbol* non_terminal_symbol );    
-    int add_symbol_to_first( const GrammarSymbol* symbol );
-    int add_symbols_to_first( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols );
-    int add_symbol_to_follow( const GrammarSymbol* symbol );
-    int add_symbols_to_follow( const std::set<const GrammarSymbol*, GrammarSymbolLess>& symbols );
-    int calculate_first();
-    int calculate_follow();
+    int calculate_nullable();
 };
 
 }
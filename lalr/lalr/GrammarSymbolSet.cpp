@@ -0,0 +1,137 @@
+//
+// GrammarSymbolSet.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "GrammarSymbolSet.hpp"
+#include "assert.hpp"
+#include <cstddef>
+
+using std::vector;
+using namespace lalr;
+
+namespace
+{
+
+const int BITS_PER_WORD = 64;
+
+/**
+// Count the bits that are set in \e word.
+*/
+int count_bits( uint64_t word )
+{
+    int bits = 0;
+    while ( word != 0 )
+    {
+        word &= word - 1;
+        ++bits;
+    }
+    return bits;
+}
+
+}
+
+/**
+// Constructor.
+*/
+GrammarSymbolSet::GrammarSymbolSet()
+: words_()
+{
+}
+
+/**
+// Get the index of the first symbol in this set at or after \e index.
+//
+// Iterate over the symbols in a set in index order with:
+//
+// ~~~c++
+// for ( int i = symbols.next(0); i != GrammarSymbolSet::INVALID_INDEX; i = symbols.next(i + 1) )
+// ~~~
+//
+// @param index
+//  The index to start searching from.
+//
+// @return
+//  The index of the first symbol in this set at or after \e index or 
+//  `GrammarSymbolSet::INVALID_INDEX` if there is no such symbol.
+*/
+int GrammarSymbolSet::next( int index ) const
+{
+    LALR_ASSERT( index >= 0 );
+    std::size_t word = std::size_t(index / BITS_PER_WORD);
+    if ( word < words_.size() )
+    {
+        uint64_t bits = words_[word] >> (index % BITS_PER_WORD);
+        while ( bits == 0 )
+        {
+            ++word;
+            if ( word >= words_.size() )
+            {
+                return INVALID_INDEX;
+            }
+            bits = words_[word];
+            index = int(word) * BITS_PER_WORD;
+        }
+        while ( (bits & 1) == 0 )
+        {
+            bits >>= 1;
+            ++index;
+        }
+        return index;
+    }
+    return INVALID_INDEX;
+}
+
+/**
+// Add the symbol with index \e index to this set.
+//
+// @param index
+//  The index of the symbol to add.
+//
+// @return
+//  The number of symbols added (0 or 1).
+*/
+int GrammarSymbolSet::insert( int index )
+{
+    LALR_ASSERT( index >= 0 );
+    std::size_t word = std::size_t(index / BITS_PER_WORD);
+    if ( word >= words_.size() )
+    {
+        words_.resize( word + 1, 0 );
+    }
+    uint64_t bit = uint64_t(1) << (index % BITS_PER_WORD);
+    if ( (words_[word] & bit) == 0 )
+    {
+        words_[word] |= bit;
+        return 1;
+    }
+    return 0;
+}
+
+/**
+// Add the symbols in \e symbols to this set.
+//
+// @param symbols
+//  The symbols to add.
+//
+// @return
+//  The number of symbols added.
+*/
+int GrammarSymbolSet::insert( const GrammarSymbolSet& symbols )
+{
+    if ( symbols.words_.size() > words_.size() )
+    {
+        words_.resize( symbols.words_.size(), 0 );
+    }
+    int added = 0;
+    for ( std::size_t i = 0; i < symbols.words_.size(); ++i )
+    {
+        uint64_t bits = symbols.words_[i] & ~words_[i];
+        if ( bits != 0 )
+        {
+            words_[i] |= bits;
+            added += count_bits( bits );
+        }
+    }
+    return added;
+}
@@ -0,0 +1,33 @@
+#ifndef LALR_GRAMMARSYMBOLSET_HPP_INCLUDED
+#define LALR_GRAMMARSYMBOLSET_HPP_INCLUDED
+
+#include <vector>
+#include <stdint.h>
+
+namespace lalr
+{
+
+/**
+// A set of grammar symbols stored as a bitset indexed by symbol index.
+//
+// Symbols are identified by the indices assigned to them by 
+// GrammarGenerator::calculate_symbol_indices() so that membership tests and
+// insertions are single bit operations and unions are performed a word at 
+// a time.  The set grows as needed to hold the largest index inserted.
+*/
+class GrammarSymbolSet
+{
+    std::vector<uint64_t> words_; ///< The bits for the symbols in this set; bit (i % 64) of word (i / 64) is set if the symbol with index i is in the set.
+
+public:
+    GrammarSymbolSet();
+    int next( int index ) const;
+    int insert( int index );
+    int insert( const GrammarSymbolSet& symbols );
+
+    static const int INVALID_INDEX = -1;
+};
+
+}
+
+#endif
@@ -27,20 +27,25 @@ using namespace lalr;
 // @param action
 //  The index of the action taken on this reduction or 
 //  `GrammarAction::INVALID_INDEX` if no action is taken.
+//
+// @param production
+//  The index of the production that this transition reduces.
 */
-GrammarTransition::GrammarTransition( const GrammarSymbol* symbol, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action )
+GrammarTransition::GrammarTransition( const GrammarSymbol* symbol, const GrammarSymbol* reduced_symbol, int reduced_length, int precedence, int action, int production )
 : symbol_( symbol ),
   state_( NULL ),
   reduced_symbol_( reduced_symbol ),
   reduced_length_( reduced_length ),
   precedence_( precedence ),
   action_( action ),
+  production_( production ),
   type_( TRANSITION_REDUCE ),
   index_( INVALID_INDEX )
 {
     LALR_ASSERT( reduced_symbol_ );
     LALR_ASSERT( reduced_length_ >= 0 );
     LALR_ASSERT( precedence_ >= 0 );
+    LALR_ASSERT( production_ >= 0 );
 }
 
 /**
@@ -59,6 +64,7 @@ GrammarTransition::GrammarTransition( const GrammarSymbol* symbol, GrammarState*
   reduced_length_( 0 ),
   precedence_( 0 ),
   action_( GrammarAction::INVALID_INDEX ),
+  production_( INVALID_INDEX ),
   type_( TRANSITION_SHIFT ),
   index_( INVALID_INDEX )
 {
@@ -97,6 +103,11 @@ int GrammarTransition::action() const
     return action_;
 }
 
+int GrammarTransition::production() const
+{
+    return production_;
+}
+
 /**
 // Get the type of this transition.
 //
@@ -180,13 +191,14 @@ void GrammarTransition::set_index( int index ) const
 // @param reduced_production
 //  The production to reduce by when this transition is taken.
 */
-void GrammarTransition::override_shift_to_reduce( const GrammarSymbol* symbol, int length, int precedence, int action ) const
+void GrammarTransition::override_shift_to_reduce( const GrammarSymbol* symbol, int length, int precedence, int action, int production ) const
 {
     LALR_ASSERT( type_ == TRANSITION_SHIFT );
     LALR_ASSERT( state_ );
     LALR_ASSERT( !reduced_symbol_ );
     LALR_ASSERT( length >= 0 );
     LALR_ASSERT( precedence >= 0 );
+    LALR_ASSERT( production >= 0 );
     LALR_ASSERT( symbol );    
     type_ = TRANSITION_REDUCE;
     state_ = nullptr;
@@ -194,6 +206,7 @@ void GrammarTransition::override_shift_to_reduce( const GrammarSymbol* symbol, i
     reduced_length_ = length;
     precedence_ = precedence;
     action_ = action;
+    production_ = production;
 }
 
 /**
@@ -203,16 +216,18 @@ void GrammarTransition::override_shift_to_reduce( const GrammarSymbol* symbol, i
 // @param reduced_production
 //  The production to reduce by when this transition is taken.
 */
-void GrammarTransition::override_reduce_to_reduce( const GrammarSymbol* symbol, int length, int precedence, int action ) const
+void GrammarTransition::override_reduce_to_reduce( const GrammarSymbol* symbol, int length, int precedence, int action, int production ) const
 {
     LALR_ASSERT( type_ == TRANSITION_REDUCE );
     LALR_ASSERT( reduced_symbol_ );
     LALR_ASSERT( symbol );
     LALR_ASSERT( length >= 0 );
     LALR_ASSERT( precedence >= 0 );
+    LALR_ASSERT( production >= 0 );
     LALR_ASSERT( reduced_symbol_ != symbol );
     reduced_symbol_ = symbol;
     reduced_length_ = length;
     precedence_ = precedence;
     action_ = action;
+    production_ = production;
 }
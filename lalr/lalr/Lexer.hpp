@@ -1,7 +1,10 @@
 #ifndef LALR_LEXER_HPP_INCLUDED
 #define LALR_LEXER_HPP_INCLUDED
 
+#include "ContiguousIterator.hpp"
 #include <vector>
+#include <string>
+#include <string_view>
 #include <functional>
 
 namespace lalr
@@ -20,11 +23,14 @@ template <class Iterator, class Char = typename std::iterator_traits<Iterator>::
 class Lexer
 {
     typedef std::function<void (Iterator* begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol)> LexerActionFunction;
+    typedef void (*LexerActionPointer)( void* context, Iterator* begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol );
 
     struct LexerActionHandler
     {
         const LexerAction* action_;
         LexerActionFunction function_;
+        LexerActionPointer pointer_;
+        void* context_;
         LexerActionHandler( const LexerAction* action, LexerActionFunction function );
     };
 
@@ -35,30 +41,47 @@ class Lexer
     std::vector<LexerActionHandler> action_handlers_; ///< The action handlers for this Lexer.
     Iterator position_; ///< The current position of this Lexer in its input sequence.
     Iterator end_; ///< One past the last position of the input sequence for this Lexer.
-    std::basic_string<Char, Traits, Allocator> lexeme_; ///< The most recently matched lexeme.
+    std::basic_string<Char, Traits, Allocator> lexeme_; ///< The most recently matched lexeme when it isn't a span of the input.
+    std::basic_string_view<Char, Traits> span_; ///< The most recently matched lexeme when it is a span of the input.
+    bool spanned_; ///< True when the most recently matched lexeme is a span of the input otherwise false.
     const void* symbol_; ///< The most recently matched symbol or null if no symbol has been matched.
     bool full_; ///< True when this Lexer scanned all of its input otherwise false.
+    bool streaming_; ///< True when input is fed to this Lexer in chunks otherwise false.
+    bool final_; ///< True when the input being scanned is the last of the input otherwise false.
+    const LexerStateMachine* resume_state_machine_; ///< The state machine of a match suspended at the end of a chunk or null if no match is suspended.
+    const LexerState* resume_state_; ///< The state to resume a match suspended at the end of a chunk from or null if no match is suspended.
+    const LexerAction* resume_action_; ///< The action to call again when the match is resumed or null if the match wasn't suspended by an action.
 
     public:
         Lexer( const LexerStateMachine* state_machine, const LexerStateMachine* whitespace_state_machine = nullptr, const void* end_symbol = nullptr, ErrorPolicy* error_policy = nullptr );
         void set_action_handler( const char* identifier, LexerActionFunction function );
-        const std::basic_string<Char, Traits, Allocator>& lexeme() const;
+        void set_action_handler( const char* identifier, LexerActionPointer function, void* context );
+        std::basic_string_view<Char, Traits> lexeme() const;
+        bool spanned() const;
         const void* symbol() const;
         const Iterator& position() const;
         bool full() const;
+        bool suspended() const;
         void reset( Iterator start, Iterator finish );
+        void feed( Iterator start, Iterator finish, bool final = false );
         void advance();
         
     private:
-        void skip();
-        const void* run();
+        void skip( const LexerState* resume_state, const LexerAction* resume_action );
+        const void* run( const LexerState* resume_state, const LexerAction* resume_action );
+        bool suspend( const LexerStateMachine* state_machine, const LexerState* state );
+        bool handle( const LexerStateMachine* state_machine, const LexerState* state, const LexerAction* action, const void** symbol );
         void error();
+        void skip_loop( const LexerStateMachine* state_machine, const LexerState* state, bool append );
+        void materialize( const Iterator& begin );
+        static std::basic_string_view<Char, Traits> span( const Iterator& begin, const Iterator& end );
+        static Iterator end_of_loop( const int* ranges, Iterator position, Iterator end );
         void fire_error( int line, int error, const char* format, ... ) const;
-        const LexerTransition* find_transition_by_character( const LexerState* state, int character ) const;
+        const LexerTransition* find_transition_by_character( const LexerStateMachine* state_machine, const LexerState* state, int character ) const;
 };
 
 }
 
 #include "Lexer.ipp"
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -9,6 +9,12 @@
 #include "ErrorPolicy.hpp"
 #include "ErrorCode.hpp"
 #include "assert.hpp"
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define LALR_LEXER_SSE2
+#endif
 
 namespace lalr
 {
@@ -25,7 +31,9 @@ namespace lalr
 template <class Iterator, class Char, class Traits, class Allocator>
 Lexer<Iterator, Char, Traits, Allocator>::LexerActionHandler::LexerActionHandler( const LexerAction* action, LexerActionFunction function )
 : action_( action ),
-  function_( function )
+  function_( function ),
+  pointer_( nullptr ),
+  context_( nullptr )
 {
     LALR_ASSERT( action_ );
 }
@@ -55,8 +63,15 @@ Lexer<Iterator, Char, Traits, Allocator>::Lexer( const LexerStateMachine* state_
   position_(),
   end_(),
   lexeme_(),
+  span_(),
+  spanned_( false ),
   symbol_( NULL ),
-  full_( false )
+  full_( false ),
+  streaming_( false ),
+  final_( true ),
+  resume_state_machine_( nullptr ),
+  resume_state_( nullptr ),
+  resume_action_( nullptr )
 {
     if ( state_machine_ )
     {
@@ -109,19 +124,77 @@ void Lexer<Iterator, Char, Traits, Allocator>::set_action_handler( const char* i
     if ( action_handler != action_handlers_.end() )
     {
         action_handler->function_ = function;
+        action_handler->pointer_ = nullptr;
+        action_handler->context_ = nullptr;
+    }
+}
+
+/**
+// Set the action handler for \e identifier to the plain function 
+// \e function called with \e context.
+//
+// Plain function handlers are called directly rather than through a 
+// std::function.
+//
+// @param identifier
+//  The identifier of the action to set a handler for.
+//
+// @param function
+//  The function to set as the handler.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::set_action_handler( const char* identifier, LexerActionPointer function, void* context )
+{
+    LALR_ASSERT( identifier );
+    
+    typename std::vector<LexerActionHandler>::iterator action_handler = action_handlers_.begin();
+    while ( action_handler != action_handlers_.end() && strcmp(action_handler->action_->identifier, identifier) != 0 )
+    {
+        ++action_handler;
+    }
+    
+    if ( action_handler != action_handlers_.end() )
+    {
+        action_handler->function_ = nullptr;
+        action_handler->pointer_ = function;
+        action_handler->context_ = context;
     }
 }
 
 /**
 // Get the most recently scanned lexeme.
 //
+// The lexeme refers directly into the input when it is a span of the input
+// (see Lexer::spanned()) and otherwise into a string owned by this %Lexer.
+// Either way it is only valid until the next call to Lexer::advance() or 
+// Lexer::reset().
+//
 // @return
 //  The lexeme.
 */
 template <class Iterator, class Char, class Traits, class Allocator>
-const std::basic_string<Char, Traits, Allocator>& Lexer<Iterator, Char, Traits, Allocator>::lexeme() const
+std::basic_string_view<Char, Traits> Lexer<Iterator, Char, Traits, Allocator>::lexeme() const
 {
-    return lexeme_;
+    return spanned_ ? span_ : std::basic_string_view<Char, Traits>( lexeme_ );
+}
+
+/**
+// Is the most recently scanned lexeme a span of the input?
+//
+// Lexemes are spans of the input when this %Lexer's iterator is contiguous
+// and no lexer action was taken while matching the lexeme.
+//
+// @return
+//  True if the most recently scanned lexeme refers directly into the input
+//  otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::spanned() const
+{
+    return spanned_;
 }
 
 /**
@@ -160,6 +233,19 @@ bool Lexer<Iterator, Char, Traits, Allocator>::full() const
     return full_;
 }
 
+/**
+// Is this %Lexer waiting for the next chunk of its input?
+//
+// @return
+//  True if the end of the chunk being scanned was reached before the next
+//  token could be matched otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::suspended() const
+{
+    return resume_state_machine_ != nullptr;
+}
+
 /**
 // Reset this %Lexer to scan [\e start, \e finish) starting its line count 
 // from \e line.
@@ -174,15 +260,68 @@ template <class Iterator, class Char, class Traits, class Allocator>
 void Lexer<Iterator, Char, Traits, Allocator>::reset( Iterator start, Iterator finish )
 {
     lexeme_.clear();
+    span_ = std::basic_string_view<Char, Traits>();
+    spanned_ = false;
     position_ = start;
     end_ = finish;
     symbol_ = NULL;
     full_ = false;
+    streaming_ = false;
+    final_ = true;
+    resume_state_machine_ = nullptr;
+    resume_state_ = nullptr;
+    resume_action_ = nullptr;
+}
+
+/**
+// Feed the next chunk of input, [\e start, \e finish), to this %Lexer.
+//
+// Call Lexer::reset() before feeding the first chunk of an input.  When 
+// the end of a chunk that isn't the final chunk is reached part way through 
+// matching whitespace or a token then the match is suspended and 
+// Lexer::advance() returns with Lexer::suspended() true.  The match 
+// resumes from where it left off on the next call to Lexer::advance() 
+// after the next chunk has been fed.
+//
+// Lexemes matched from chunks are always copied as chunks aren't assumed 
+// to outlive the next call to Lexer::advance().  Lexer actions only see the 
+// chunk being scanned when they are called so an action that reaches the 
+// end of the chunk before it has finished matching must consume the whole
+// chunk, keep what it needs to carry on in the lexeme, and set the symbol
+// to `&LexerAction::MORE_INPUT`.  The match is then suspended and the 
+// action is called again with the lexeme it left and the next chunk when 
+// the match resumes.  An action that still needs more input at the end of 
+// the final chunk is reported as a lexical error.
+//
+// @param start
+//  The first character in the chunk.
+//
+// @param finish
+//  One past the last character in the chunk.
+//
+// @param final
+//  True if this is the final chunk of the input otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::feed( Iterator start, Iterator finish, bool final )
+{
+    position_ = start;
+    end_ = finish;
+    streaming_ = true;
+    final_ = final;
 }
 
 /**
 // Advance one token in the input stream.
 //
+// Input matched as whitespace, either by the whitespace state machine or by
+// the whitespace symbol of a state machine that whitespace is fused into, is
+// skipped before the next token is matched.
+//
+// If the end of a chunk fed by Lexer::feed() is reached before the next 
+// token is matched then this returns with Lexer::suspended() true and a 
+// null symbol and resumes matching on the next call.
+//
 // @param data
 //  The data that defines the state machine that is used in matching 
 //  the next token.
@@ -195,43 +334,88 @@ template <class Iterator, class Char, class Traits, class Allocator>
 void Lexer<Iterator, Char, Traits, Allocator>::advance()
 {
     LALR_ASSERT( state_machine_ );
-    lexeme_.clear();
-    skip();
-    full_ = position_ == end_;
-    symbol_ = position_ != end_ ? run() : end_symbol_;
+    do
+    {
+        const LexerStateMachine* resume_state_machine = resume_state_machine_;
+        const LexerState* resume_state = resume_state_;
+        const LexerAction* resume_action = resume_action_;
+        resume_state_machine_ = nullptr;
+        resume_state_ = nullptr;
+        resume_action_ = nullptr;
+        if ( !resume_state_machine )
+        {
+            lexeme_.clear();
+            span_ = std::basic_string_view<Char, Traits>();
+            spanned_ = false;
+        }
+        if ( resume_state_machine != state_machine_ )
+        {
+            skip( resume_state, resume_action );
+            resume_state = nullptr;
+            resume_action = nullptr;
+            if ( resume_state_machine_ )
+            {
+                symbol_ = nullptr;
+                return;
+            }
+        }
+        // A match suspended at the end of the last chunk is finished, 
+        // matching the symbol of the state that it was suspended in, before
+        // the end of the input is returned.
+        full_ = position_ == end_ && final_;
+        symbol_ = position_ != end_ || !final_ || resume_state ? run( resume_state, resume_action ) : end_symbol_;
+    }
+    while ( !resume_state_machine_ && symbol_ && symbol_ == state_machine_->whitespace_symbol );
 }
 
 /**
 // Skip this %Lexer over its input using the state machine specified by 
 // \e data.
+//
+// @param resume_state
+//  The state to resume a suspended match from or null to start matching 
+//  from the start state.
+//
+// @param resume_action
+//  The action to call again before resuming a match suspended by an action
+//  that needed more input or null if there is no such action.
 */
 template <class Iterator, class Char, class Traits, class Allocator>
-void Lexer<Iterator, Char, Traits, Allocator>::skip()
+void Lexer<Iterator, Char, Traits, Allocator>::skip( const LexerState* resume_state, const LexerAction* resume_action )
 {    
     LALR_ASSERT( state_machine_ );
 
     if ( whitespace_state_machine_ )
     {
-        const LexerState* state = whitespace_state_machine_->start_state;
+        const LexerState* state = resume_state ? resume_state : whitespace_state_machine_->start_state;
         LALR_ASSERT( state );
+        const void* symbol = NULL;
+        if ( resume_action && !handle(whitespace_state_machine_, state, resume_action, &symbol) )
+        {
+            return;
+        }
         const LexerTransition* transition = nullptr;
-        while ( position_ != end_ && (transition = find_transition_by_character(state, *position_)) )
+        while ( position_ != end_ && (transition = find_transition_by_character(whitespace_state_machine_, state, Traits::to_int_type(*position_))) )
         {
+            bool looped = transition->state == state;
             state = transition->state;            
             if ( transition->action )
             {
-                int index = transition->action->index;
-                LALR_ASSERT( index >= 0 && index < (int) action_handlers_.size() );                
-                const LexerActionFunction& function = action_handlers_[index].function_;
-                LALR_ASSERT( function );
-                const void* symbol = NULL;
-                function( &position_, end_, &lexeme_, &symbol );
+                if ( !handle(whitespace_state_machine_, state, transition->action, &symbol) )
+                {
+                    return;
+                }
             }
             else
             {
                 ++position_;
+                if ( looped )
+                {
+                    skip_loop( whitespace_state_machine_, state, false );
+                }
             }
-        }        
+        }
+        suspend( whitespace_state_machine_, state );
     }
 }
 
@@ -239,47 +423,82 @@ void Lexer<Iterator, Char, Traits, Allocator>::skip()
 // Run this %Lexer over its input using the state machine specified by 
 // \e data.
 //
-// @param state
-//  The start state of the state machine to use when running this %Lexer 
-//  for this call.
+// @param resume_state
+//  The state to resume a suspended match from or null to start matching 
+//  from the start state.
+//
+// @param resume_action
+//  The action to call again before resuming a match suspended by an action
+//  that needed more input or null if there is no such action.
 //
 // @return
 //  The symbol that was matched or null if no symbol was matched from
-//  the input.
+//  the input or the match was suspended at the end of a chunk.
 */
 template <class Iterator, class Char, class Traits, class Allocator>
-const void* Lexer<Iterator, Char, Traits, Allocator>::run()
+const void* Lexer<Iterator, Char, Traits, Allocator>::run( const LexerState* resume_state, const LexerAction* resume_action )
 {    
     LALR_ASSERT( state_machine_ );
     LALR_ASSERT( state_machine_->start_state );
     
     const void* symbol = nullptr;
-    const LexerState* state = state_machine_->start_state;
+    const LexerState* state = resume_state ? resume_state : state_machine_->start_state;
     if ( state )
     {
+        Iterator begin = position_;
+        spanned_ = ContiguousIterator<Iterator>::value && !streaming_;
         symbol = state->symbol;
+        if ( resume_action && !handle(state_machine_, state, resume_action, &symbol) )
+        {
+            return nullptr;
+        }
         const LexerTransition* transition = nullptr;
-        while ( position_ != end_ && (transition = find_transition_by_character(state, *position_)) )
+        while ( position_ != end_ && (transition = find_transition_by_character(state_machine_, state, Traits::to_int_type(*position_))) )
         {
+            bool looped = transition->state == state;
             state = transition->state;
             symbol = state->symbol;
             
             if ( transition->action )
             {
-                int index = transition->action->index;
-                LALR_ASSERT( index >= 0 && index < (int) action_handlers_.size() );                
-                const LexerActionFunction& function = action_handlers_[index].function_;
-                LALR_ASSERT( function );
-                function( &position_, end_, &lexeme_, &symbol );
+                materialize( begin );
+                if ( !handle(state_machine_, state, transition->action, &symbol) )
+                {
+                    return nullptr;
+                }
             }
             else
             {
-                lexeme_ += *position_;
+                if ( !spanned_ )
+                {
+                    lexeme_ += *position_;
+                }
                 ++position_;
+                if ( looped )
+                {
+                    skip_loop( state_machine_, state, !spanned_ );
+                }
             }
         }
         
-        if ( position_ != end_ && !symbol && lexeme_.empty() )
+        if ( suspend(state_machine_, state) )
+        {
+            return nullptr;
+        }
+
+        if ( spanned_ )
+        {
+            span_ = span( begin, position_ );
+        }
+
+        // Whitespace fused into the state machine must match at least one
+        // character to be skipped.
+        if ( symbol && symbol == state_machine_->whitespace_symbol && position_ == begin && !resume_state )
+        {
+            symbol = nullptr;
+        }
+
+        if ( position_ != end_ && !symbol && lexeme().empty() )
         {
             error();
         }
@@ -288,6 +507,95 @@ const void* Lexer<Iterator, Char, Traits, Allocator>::run()
     return state ? symbol : NULL;
 }
 
+/**
+// Suspend the match in \e state if the end of a chunk that isn't the final
+// chunk has been reached and \e state might still match more input.
+//
+// @param state_machine
+//  The state machine that \e state belongs to.
+//
+// @param state
+//  The state that matching stopped in.
+//
+// @return
+//  True if the match was suspended otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::suspend( const LexerStateMachine* state_machine, const LexerState* state )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( state );
+    if ( position_ == end_ && !final_ && state->length > 0 )
+    {
+        resume_state_machine_ = state_machine;
+        resume_state_ = state;
+        return true;
+    }
+    return false;
+}
+
+/**
+// Call the handler for \e action.
+//
+// If the handler reports that it needs more input by setting the symbol to
+// `&LexerAction::MORE_INPUT` at the end of a chunk that isn't the final 
+// chunk then the match is suspended in \e state so that the handler is 
+// called again when the next chunk is fed.  Anywhere else that is a 
+// lexical error and no symbol is matched.
+//
+// @param state_machine
+//  The state machine that \e state belongs to.
+//
+// @param state
+//  The state that the transition taking \e action is to.
+//
+// @param action
+//  The action to call the handler for (assumed not null and to have a
+//  handler set).
+//
+// @param symbol
+//  The symbol matched so far that the handler may replace.
+//
+// @return
+//  False if the match was suspended for more input otherwise true.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+bool Lexer<Iterator, Char, Traits, Allocator>::handle( const LexerStateMachine* state_machine, const LexerState* state, const LexerAction* action, const void** symbol )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( state );
+    LALR_ASSERT( action );
+    LALR_ASSERT( symbol );
+    int index = action->index;
+    LALR_ASSERT( index >= 0 && index < (int) action_handlers_.size() );
+    const LexerActionHandler& action_handler = action_handlers_[index];
+    const void* matched_symbol = *symbol;
+    if ( action_handler.pointer_ )
+    {
+        action_handler.pointer_( action_handler.context_, &position_, end_, &lexeme_, symbol );
+    }
+    else
+    {
+        LALR_ASSERT( action_handler.function_ );
+        action_handler.function_( &position_, end_, &lexeme_, symbol );
+    }
+
+    if ( *symbol == &LexerAction::MORE_INPUT )
+    {
+        *symbol = matched_symbol;
+        if ( position_ == end_ && !final_ )
+        {
+            resume_state_machine_ = state_machine;
+            resume_state_ = state;
+            resume_action_ = action;
+            return false;
+        }
+        fire_error( 0, LEXER_ERROR_LEXICAL_ERROR, "Lexer action '%s' reached the end of the input before it finished matching", action->identifier );
+        *symbol = nullptr;
+    }
+    return true;
+}
+
 /**
 // Recover this %Lexer after a lexical %error to make sure that it can recognize
 // the next character.
@@ -306,12 +614,182 @@ void Lexer<Iterator, Char, Traits, Allocator>::error()
     
     const LexerTransition* transition = NULL;
     const LexerState* state = state_machine_->start_state;
-    while ( position_ != end_ && !(transition = find_transition_by_character(state, *position_)) )
+    while ( position_ != end_ && !(transition = find_transition_by_character(state_machine_, state, Traits::to_int_type(*position_))) )
     {
         ++position_;
     }
 }
 
+/**
+// Skip over the run of characters at the current position that \e state 
+// transitions back to itself on without taking an action.
+//
+// Runs are only skipped in bulk when scanning pointers to single byte 
+// characters and \e state_machine has loop ranges.  Otherwise this does 
+// nothing and the characters are matched one at a time as usual.
+//
+// @param state_machine
+//  The state machine that \e state belongs to.
+//
+// @param state
+//  The state that has just transitioned back to itself.
+//
+// @param append
+//  True to append the skipped characters to the lexeme owned by this 
+//  %Lexer otherwise false.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::skip_loop( const LexerStateMachine* state_machine, const LexerState* state, bool append )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( state );
+    if constexpr ( std::is_pointer<Iterator>::value && sizeof(Char) == 1 )
+    {
+        if ( state_machine->loop_ranges )
+        {
+            Iterator begin = position_;
+            position_ = end_of_loop( &state_machine->loop_ranges[state->index * 2 * LEXER_LOOP_RANGES], position_, end_ );
+            if ( append )
+            {
+                lexeme_.append( begin, position_ );
+            }
+        }
+    }
+}
+
+/**
+// Copy the lexeme matched so far from \e begin into the string owned by
+// this %Lexer so that lexer actions can rewrite it.
+//
+// @param begin
+//  The position that the lexeme being matched started at.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+void Lexer<Iterator, Char, Traits, Allocator>::materialize( const Iterator& begin )
+{
+    if ( spanned_ )
+    {
+        std::basic_string_view<Char, Traits> lexeme = span( begin, position_ );
+        lexeme_.assign( lexeme.data(), lexeme.size() );
+        spanned_ = false;
+    }
+}
+
+/**
+// Get the span of the input in [\e begin, \e end).
+//
+// @param begin
+//  The first character in the span.
+//
+// @param end
+//  One past the last character in the span.
+//
+// @return
+//  The span or an empty string view if the iterator isn't contiguous.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+std::basic_string_view<Char, Traits> Lexer<Iterator, Char, Traits, Allocator>::span( const Iterator& begin, const Iterator& end )
+{
+    if constexpr ( ContiguousIterator<Iterator>::value )
+    {
+        const Char* first = ContiguousIterator<Iterator>::address( begin );
+        const Char* last = ContiguousIterator<Iterator>::address( end );
+        return std::basic_string_view<Char, Traits>( first, last - first );
+    }
+    else
+    {
+        return std::basic_string_view<Char, Traits>();
+    }
+}
+
+/**
+// Find the end of the run of characters in [\e position, \e end) that are 
+// in \e ranges.
+//
+// Sixteen characters are checked at a time with SSE2 where it is available
+// with the remaining characters checked one at a time.
+//
+// @param ranges
+//  The LEXER_LOOP_RANGES [begin, end) ranges of characters in the run with
+//  empty ranges after the ranges in use.
+//
+// @param position
+//  The first character to check (assumed to point to single byte 
+//  characters).
+//
+// @param end
+//  One past the last character to check.
+//
+// @return
+//  The first character in [\e position, \e end) that isn't in \e ranges 
+//  or \e end if every character is.
+*/
+template <class Iterator, class Char, class Traits, class Allocator>
+Iterator Lexer<Iterator, Char, Traits, Allocator>::end_of_loop( const int* ranges, Iterator position, Iterator end )
+{
+    LALR_ASSERT( ranges );
+    int ranges_size = 0;
+    while ( ranges_size < LEXER_LOOP_RANGES && ranges[2 * ranges_size] < ranges[2 * ranges_size + 1] )
+    {
+        ++ranges_size;
+    }
+
+#if defined(LALR_LEXER_SSE2)
+    // A character is in the range [begin, end) when its offset from begin,
+    // wrapped to an unsigned byte, is less than end - begin.  Characters 
+    // outside [0, LEXER_LOOP_CHARACTERS) wrap to offsets outside of every
+    // range.
+    if ( ranges_size > 0 )
+    {
+        __m128i begins [LEXER_LOOP_RANGES];
+        __m128i lasts [LEXER_LOOP_RANGES];
+        for ( int i = 0; i < ranges_size; ++i )
+        {
+            begins[i] = _mm_set1_epi8( char(ranges[2 * i]) );
+            lasts[i] = _mm_set1_epi8( char(ranges[2 * i + 1] - ranges[2 * i] - 1) );
+        }
+
+        while ( end - position >= 16 )
+        {
+            __m128i characters = _mm_loadu_si128( reinterpret_cast<const __m128i*>(position) );
+            __m128i matches = _mm_setzero_si128();
+            for ( int i = 0; i < ranges_size; ++i )
+            {
+                __m128i offsets = _mm_sub_epi8( characters, begins[i] );
+                matches = _mm_or_si128( matches, _mm_cmpeq_epi8(_mm_min_epu8(offsets, lasts[i]), offsets) );
+            }
+            int mask = _mm_movemask_epi8( matches );
+            if ( mask != 0xffff )
+            {
+                while ( mask & 1 )
+                {
+                    mask >>= 1;
+                    ++position;
+                }
+                return position;
+            }
+            position += 16;
+        }
+    }
+#endif
+
+    while ( position != end )
+    {
+        int character = static_cast<unsigned char>( *position );
+        int i = 0;
+        while ( i < ranges_size && !(character >= ranges[2 * i] && character < ranges[2 * i + 1]) )
+        {
+            ++i;
+        }
+        if ( i == ranges_size )
+        {
+            break;
+        }
+        ++position;
+    }
+    return position;
+}
+
 /**
 // Report an error to the `ErrorPolicy` used by this `Lexer`.
 //
@@ -339,10 +817,43 @@ void Lexer<Iterator, Char, Traits, Allocator>::fire_error( int line, int error,
     }    
 }
 
-
+/**
+// Find the transition from \e state on \e character.
+//
+// Characters are passed as their Traits::to_int_type() values so that 
+// bytes with the high bit set are the same non-negative characters in the 
+// dense transition table and the transitions of \e state when `char` is 
+// signed.
+//
+// Characters in [0, LEXER_CLASS_CHARACTERS) are looked up in the dense 
+// transition table of \e state_machine when it has one.  Other characters
+// (and state machines without a dense table) fall back to searching the
+// transitions of \e state.
+//
+// @param state_machine
+//  The state machine that \e state belongs to.
+//
+// @param state
+//  The state to find the transition from.
+//
+// @param character
+//  The character to find the transition on.
+//
+// @return
+//  The transition or null if there is no transition from \e state on 
+//  \e character.
+*/
 template <class Iterator, class Char, class Traits, class Allocator>
-const LexerTransition* Lexer<Iterator, Char, Traits, Allocator>::find_transition_by_character( const LexerState* state, int character ) const
+const LexerTransition* Lexer<Iterator, Char, Traits, Allocator>::find_transition_by_character( const LexerStateMachine* state_machine, const LexerState* state, int character ) const
 {
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( state );
+    if ( state_machine->classes && character >= 0 && character < LEXER_CLASS_CHARACTERS )
+    {
+        int index = state_machine->class_transitions[state->index * state_machine->classes_size + state_machine->classes[character]];
+        return index >= 0 ? &state_machine->transitions[index] : nullptr;
+    }
+
     const LexerTransition* transition = state->transitions;
     const LexerTransition* transitions_end = state->transitions + state->length;
     while ( transition != transitions_end && !(character >= transition->begin && character < transition->end) )
@@ -11,6 +11,7 @@ class LexerAction
 {
 public:
     static const int INVALID_INDEX = -1;
+    static constexpr char MORE_INPUT = 0; ///< A handler sets the symbol to the address of this to report that the action needs the next chunk of input to finish matching.
     int index; ///< The index of this action.
     const char* identifier; ///< The identifier of this action.
 };
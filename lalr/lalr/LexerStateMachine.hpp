@@ -11,6 +11,27 @@ class LexerAction;
 class LexerTransition;
 class LexerState;
 
+/**
+// The number of characters, starting from zero, that are looked up through 
+// the dense transition table of a LexerStateMachine.  Transitions on other 
+// characters are found by searching the transitions of each state.
+*/
+const int LEXER_CLASS_CHARACTERS = 256;
+
+/**
+// The number of characters, starting from zero, that runs of characters 
+// that a state loops back to itself on are skipped over in bulk for.  These
+// are the characters that have the same value whether `char` is signed or 
+// unsigned.
+*/
+const int LEXER_LOOP_CHARACTERS = 128;
+
+/**
+// The maximum number of ranges of characters that a state loops back to 
+// itself on that runs of characters are skipped over in bulk for.
+*/
+const int LEXER_LOOP_RANGES = 4;
+
 /**
 // The data that defines the state machine for a lexical analyzer.
 */
@@ -24,6 +45,11 @@ public:
     const LexerTransition* transitions;
     const LexerState* states;
     const LexerState* start_state;
+    int classes_size; ///< The number of character classes in the dense transition table.
+    const int* classes; ///< The character class of each character in [0, LEXER_CLASS_CHARACTERS) or null if there is no dense transition table.
+    const int* class_transitions; ///< The index of the transition from each state on each character class or -1 if there is no transition (states_size x classes_size).
+    const int* loop_ranges; ///< The ranges of characters in [0, LEXER_LOOP_CHARACTERS) that each state transitions back to itself on without an action as [begin, end) pairs with empty ranges unused or null if no state loops (states_size x LEXER_LOOP_RANGES x 2).
+    const void* whitespace_symbol; ///< The symbol matched by whitespace that is skipped rather than returned or null if whitespace isn't matched by this state machine.
 };
 
 }
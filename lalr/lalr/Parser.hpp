@@ -3,9 +3,13 @@
 
 #include "ParserNode.hpp"
 #include "ParserUserData.hpp"
+#include "ParserTree.hpp"
+#include "ParserArena.hpp"
+#include "ParserFlatTree.hpp"
 #include "AddParserActionHandler.hpp"
 #include "AddLexerActionHandler.hpp"
 #include "Lexer.hpp"
+#include <type_traits>
 #include <vector>
 
 namespace error
@@ -28,21 +32,30 @@ class ErrorPolicy;
 
 /**
 // A %parser.
+//
+// When \e Tables is a type generated by lalrc --tables the parser looks 
+// transitions up in its constexpr tables, sizes, and strides rather than 
+// through the tables of the state machine passed at run-time (which must 
+// be the state machine that \e Tables was generated with).
 */
-template <class Iterator, class UserData = std::shared_ptr<ParserUserData<typename std::iterator_traits<Iterator>::value_type> >, class Char = typename std::iterator_traits<Iterator>::value_type, class Traits = typename std::char_traits<Char>, class Allocator = typename std::allocator<Char> >
+template <class Iterator, class UserData = std::shared_ptr<ParserUserData<typename std::iterator_traits<Iterator>::value_type> >, class Char = typename std::iterator_traits<Iterator>::value_type, class Traits = typename std::char_traits<Char>, class Allocator = typename std::allocator<Char>, class Tables = void>
 class Parser
 {
     public:
         typedef lalr::ParserNode<UserData, Char, Traits, Allocator> ParserNode;
         typedef typename std::vector<ParserNode>::const_iterator ParserNodeConstIterator;
         typedef std::function<void (Iterator* begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol)> LexerActionFunction;
-        typedef std::function<UserData (const lalr::ParserNode<UserData, Char, Traits, Allocator>* start, const lalr::ParserNode<UserData, Char, Traits, Allocator>* finish)> ParserActionFunction;
+        typedef std::function<UserData (lalr::ParserNode<UserData, Char, Traits, Allocator>* start, lalr::ParserNode<UserData, Char, Traits, Allocator>* finish)> ParserActionFunction;
+        typedef void (*LexerActionPointer)( void* context, Iterator* begin, Iterator end, std::basic_string<Char, Traits, Allocator>* lexeme, const void** symbol );
+        typedef UserData (*ParserActionPointer)( void* context, lalr::ParserNode<UserData, Char, Traits, Allocator>* start, lalr::ParserNode<UserData, Char, Traits, Allocator>* finish );
 
     private:
         struct ParserActionHandler
         {        
             const ParserAction*  action_;
             ParserActionFunction function_;
+            ParserActionPointer pointer_;
+            void* context_;
             ParserActionHandler( const ParserAction* action, ParserActionFunction function );
         };
 
@@ -52,41 +65,61 @@ class Parser
         Lexer<Iterator, Char, Traits, Allocator> lexer_; ///< The lexical analyzer used during parsing.
         std::vector<ParserActionHandler> action_handlers_; ///< The action handlers for parser actions taken during reduction.
         ParserActionFunction default_action_handler_; ///< The default action handler for reductions that don't specify any action.
+        ParserActionPointer default_action_pointer_; ///< The plain function default action handler or null if the default action handler isn't a plain function.
+        void* default_action_context_; ///< The context passed to the plain function default action handler.
+        ParserArena arena_; ///< The arena that parse trees are allocated from when the user data is a ParserTree.
+        ParserFlatTree flat_tree_; ///< The flat parse tree built when enabled.
+        const Char* input_; ///< The first character of the input being parsed when it is contiguous otherwise null.
+        bool flat_tree_enabled_; ///< True if a flat parse tree is built during parsing otherwise false.
         bool debug_enabled_; ///< True if shift and reduce operations should be printed otherwise false.
         bool accepted_; ///< True if the parser accepted its input otherwise false.
         bool full_; ///< True if the parser processed all of its input otherwise false.
+        bool done_; ///< True if the parser has accepted or rejected input fed to it in chunks otherwise false.
 
     public:
         Parser( const ParserStateMachine* state_machine, ErrorPolicy* error_policy = nullptr );
 
         void reset();
         void parse( Iterator start, Iterator finish );
-        bool parse( const void* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme );
-        bool parse( const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme );
+        bool feed( Iterator start, Iterator finish );
+        bool feed_end();
+        bool parse( const void* symbol, std::basic_string_view<Char, Traits> lexeme );
+        bool parse( const ParserSymbol* symbol, std::basic_string_view<Char, Traits> lexeme );
         bool accepted() const;
         bool full() const;
         const UserData& user_data() const;
+        UserData& user_data();
+        const ParserFlatTree& flat_tree() const;
         const Iterator& position() const;
 
-        AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator> parser_action_handlers();
+        AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables> parser_action_handlers();
         AddLexerActionHandler<Iterator, Char, Traits, Allocator> lexer_action_handlers();
         void set_default_action_handler( ParserActionFunction function );
+        void set_default_action_handler( ParserActionPointer function, void* context );
         void set_action_handler( const char* identifier, ParserActionFunction function );
+        void set_action_handler( const char* identifier, ParserActionPointer function, void* context );
+        void set_action_handler( int index, ParserActionPointer function, void* context );
         void set_lexer_action_handler( const char* identifier, LexerActionFunction function );
+        void set_lexer_action_handler( const char* identifier, LexerActionPointer function, void* context );
 
         void fire_error( int error, const char* format, ... ) const;
         void fire_printf( const char* format, ... ) const;
         
         void set_debug_enabled( bool debug_enabled );
         bool is_debug_enabled() const;
+        void set_flat_tree_enabled( bool flat_tree_enabled );
+        bool is_flat_tree_enabled() const;
         
     private:
         const ParserTransition* find_transition( const ParserSymbol* symbol, const ParserState* state ) const;
+        const ParserTransition* find_transition_or_default_reduction( const ParserSymbol* symbol, const ParserState* state ) const;
         typename std::vector<ParserNode>::iterator find_node_to_reduce_to( const ParserTransition* transition, std::vector<ParserNode>& nodes );
         void debug_shift( const ParserNode& node ) const;
         void debug_reduce( const ParserSymbol* reduced_symbol, const ParserNode* start, const ParserNode* finish ) const;
-        UserData handle( const ParserTransition* transition, const ParserNode* start, const ParserNode* finish ) const;
-        void shift( const ParserTransition* transition, const std::basic_string<Char, Traits, Allocator>& lexeme );
+        UserData handle( const ParserTransition* transition, ParserNode* start, ParserNode* finish );
+        bool parse( const ParserSymbol* symbol, std::basic_string_view<Char, Traits> lexeme, bool spanned );
+        bool feed( Iterator start, Iterator finish, bool final );
+        void shift( const ParserTransition* transition, std::basic_string_view<Char, Traits> lexeme, bool spanned );
         void reduce( const ParserTransition* transition, bool* accepted, bool* rejected );
         void error( bool* accepted, bool* rejected );
 };
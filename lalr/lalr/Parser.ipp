@@ -15,6 +15,7 @@
 #include "ErrorCode.hpp"
 #include "ParserNode.ipp"
 #include "ParserUserData.ipp"
+#include "ParserTree.ipp"
 #include "AddParserActionHandler.ipp"
 #include "Lexer.ipp"
 #include "AddLexerActionHandler.ipp"
@@ -35,10 +36,12 @@ namespace lalr
 // @param function
 //  The function to call when matching a reduction for this action handler.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-Parser<Iterator, UserData, Char, Traits, Allocator>::ParserActionHandler::ParserActionHandler( const ParserAction* action, ParserActionFunction function )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::ParserActionHandler::ParserActionHandler( const ParserAction* action, ParserActionFunction function )
 : action_( action ),
-  function_( function )
+  function_( function ),
+  pointer_( nullptr ),
+  context_( nullptr )
 {
 }
 
@@ -57,19 +60,31 @@ Parser<Iterator, UserData, Char, Traits, Allocator>::ParserActionHandler::Parser
 //  The error policy to notifiy errors from the lexer to or null to silently
 //  swallow lexical errors.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-Parser<Iterator, UserData, Char, Traits, Allocator>::Parser( const ParserStateMachine* state_machine, ErrorPolicy* error_policy )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::Parser( const ParserStateMachine* state_machine, ErrorPolicy* error_policy )
 : state_machine_( state_machine ),
   error_policy_( error_policy ),
   nodes_(),
   lexer_( state_machine_->lexer_state_machine, state_machine_->whitespace_lexer_state_machine, state_machine_->end_symbol, error_policy ),
   action_handlers_(),
   default_action_handler_( NULL ),
+  default_action_pointer_( nullptr ),
+  default_action_context_( nullptr ),
+  arena_(),
+  flat_tree_(),
+  input_( nullptr ),
+  flat_tree_enabled_( false ),
   debug_enabled_( false ),
   accepted_( false ),
-  full_( false )
+  full_( false ),
+  done_( false )
 {
     LALR_ASSERT( state_machine_ );
+    if constexpr ( !std::is_void<Tables>::value )
+    {
+        LALR_ASSERT( state_machine_->states_size == Tables::states_size );
+        LALR_ASSERT( state_machine_->symbols_size == Tables::symbols_size );
+    }
     
     action_handlers_.reserve( state_machine_->actions_size );
     const ParserAction* action = state_machine_->actions;
@@ -81,19 +96,26 @@ Parser<Iterator, UserData, Char, Traits, Allocator>::Parser( const ParserStateMa
     }
 
     nodes_.reserve( 64 );       
-    nodes_.push_back( ParserNode(state_machine_->start_state, NULL, UserData()) );
+    nodes_.emplace_back( state_machine_->start_state, nullptr, UserData() );
 }
 
 /**
 // Reset this Parser so that it can parse another sequence of input.
+//
+// Any parse tree built by a previous parse is released.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::reset()
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::reset()
 {
     accepted_ = false;
     full_ = false;
+    done_ = false;
+    lexer_.reset( Iterator(), Iterator() );
     nodes_.clear();
-    nodes_.push_back( ParserNode(state_machine_->start_state, NULL, UserData()) );
+    arena_.reset();
+    flat_tree_.reset();
+    input_ = nullptr;
+    nodes_.emplace_back( state_machine_->start_state, nullptr, UserData() );
 }
 
 /**
@@ -112,16 +134,20 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::reset()
 // @param finish
 //  One past the last character in the sequence to parse.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::parse( Iterator start, Iterator finish )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::parse( Iterator start, Iterator finish )
 {
     LALR_ASSERT( state_machine_ );
 
     reset();
+    if constexpr ( ContiguousIterator<Iterator>::value )
+    {
+        input_ = ContiguousIterator<Iterator>::address( start );
+    }
     lexer_.reset( start, finish );    
     lexer_.advance();
     const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( lexer_.symbol() );
-    while ( parse(symbol, lexer_.lexeme()) )
+    while ( parse(symbol, lexer_.lexeme(), lexer_.spanned()) )
     {
         lexer_.advance();
         symbol = reinterpret_cast<const ParserSymbol*>( lexer_.symbol() );
@@ -130,6 +156,48 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::parse( Iterator start,
     full_ = lexer_.full();
 }
 
+/**
+// Continue a parse by feeding it the next chunk of input, [\e start, 
+// \e finish).
+//
+// Call Parser::reset() before feeding the first chunk of an input and 
+// Parser::feed_end() after feeding the last chunk.  Tokens that span the
+// end of a chunk are matched when the next chunk is fed so the chunk 
+// doesn't need to outlive this call and peak memory is bounded by the 
+// parser's stack rather than the size of the input.
+//
+// @param start
+//  The first character in the chunk.
+//
+// @param finish
+//  One past the last character in the chunk.
+//
+// @return
+//  True until parsing is complete or an error occurs.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::feed( Iterator start, Iterator finish )
+{
+    return feed( start, finish, false );
+}
+
+/**
+// Complete a parse of input fed in chunks by Parser::feed().
+//
+// After this the Parser::full() and Parser::accepted() functions can be 
+// used to determine whether or not the parse was successful in the same 
+// way as after a call to Parser::parse().
+//
+// @return
+//  True until parsing is complete or an error occurs; that is always false
+//  after the end of input has been fed.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::feed_end()
+{
+    return feed( Iterator(), Iterator(), true );
+}
+
 /**
 // Continue a parse by accepting \e symbol as the next token.
 //
@@ -143,12 +211,31 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::parse( Iterator start,
 // @return
 //  True until parsing is complete or an error occurs.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const void* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::parse( const void* symbol, std::basic_string_view<Char, Traits> lexeme )
 {
     return parse( reinterpret_cast<const ParserSymbol*>(symbol), lexeme );
 }
 
+/**
+// Continue a parse by accepting \e symbol as the next token.
+//
+// @param symbol
+//  The next token from the lexical analyzer in the current parse.
+//
+// @param lexeme
+//  The lexeme of the next token from the lexical analyzer (copied into the
+//  parser's stack if the token is shifted).
+//
+// @return
+//  True until parsing is complete or an error occurs.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::parse( const ParserSymbol* symbol, std::basic_string_view<Char, Traits> lexeme )
+{
+    return parse( symbol, lexeme, false );
+}
+
 /**
 // Continue a parse by accepting \e symbol as the next token.
 //
@@ -158,25 +245,29 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const void* sym
 // @param lexeme
 //  The lexeme of the next token from the lexical analyzer.
 //
+// @param spanned
+//  True if \e lexeme is a span of the input that outlives the parse and
+//  can be referred to by the parser's stack rather than copied.
+//
 // @return
 //  True until parsing is complete or an error occurs.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::parse( const ParserSymbol* symbol, std::basic_string_view<Char, Traits> lexeme, bool spanned )
 {
     bool accepted = false;
     bool rejected = false;
     
-    const ParserTransition* transition = find_transition( symbol, nodes_.back().state() );
+    const ParserTransition* transition = find_transition_or_default_reduction( symbol, nodes_.back().state() );
     while ( !accepted && !rejected && transition && transition->type == TRANSITION_REDUCE )
     {
         reduce( transition, &accepted, &rejected );
-        transition = find_transition( symbol, nodes_.back().state() );
+        transition = find_transition_or_default_reduction( symbol, nodes_.back().state() );
     }
     
     if ( transition && transition->type == TRANSITION_SHIFT )
     {
-        shift( transition, lexeme );
+        shift( transition, lexeme, spanned );
     }
     else
     {
@@ -187,14 +278,48 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::parse( const ParserSym
     return !accepted_ && !rejected;
 }
 
+/**
+// Continue a parse by feeding it the chunk of input [\e start, \e finish).
+//
+// @param start
+//  The first character in the chunk.
+//
+// @param finish
+//  One past the last character in the chunk.
+//
+// @param final
+//  True if this is the final chunk of the input otherwise false.
+//
+// @return
+//  True until parsing is complete or an error occurs.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::feed( Iterator start, Iterator finish, bool final )
+{
+    LALR_ASSERT( state_machine_ );
+
+    if ( !done_ )
+    {
+        lexer_.feed( start, finish, final );
+        lexer_.advance();
+        while ( !lexer_.suspended() && parse(reinterpret_cast<const ParserSymbol*>(lexer_.symbol()), lexer_.lexeme(), lexer_.spanned()) )
+        {
+            lexer_.advance();
+        }
+        done_ = !lexer_.suspended();
+        full_ = lexer_.full();
+    }
+    return !done_;
+}
+
 /**
 // Did the most recent parse accept input successfully?
 //
 // @return
 //  True if the input was parsed successfully otherwise false.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-bool Parser<Iterator, UserData, Char, Traits, Allocator>::accepted() const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::accepted() const
 {
     return accepted_;
 }
@@ -205,8 +330,8 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::accepted() const
 // @return
 //  True if all of the input was consumed otherwise false.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-bool Parser<Iterator, UserData, Char, Traits, Allocator>::full() const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::full() const
 {
     return full_;
 }
@@ -220,22 +345,56 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::full() const
 // @return
 //  The user data.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-const UserData& Parser<Iterator, UserData, Char, Traits, Allocator>::user_data() const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const UserData& Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::user_data() const
+{
+    LALR_ASSERT( accepted() );
+    LALR_ASSERT( nodes_.size() == 1 );
+    return nodes_.front().user_data();
+}
+
+/**
+// Get the user data that resulted from the most recent call to 
+// Parser::parser() on this %Parser.
+//
+// The user data can be moved out of this %Parser (e.g. to take ownership of
+// a move-only parse tree).  Assumes that the most recent parse was accepted.
+//
+// @return
+//  The user data.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+UserData& Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::user_data()
 {
     LALR_ASSERT( accepted() );
     LALR_ASSERT( nodes_.size() == 1 );
     return nodes_.front().user_data();
 }
 
+/**
+// Get the flat parse tree built by the most recent call to Parser::parse()
+// on this %Parser.
+//
+// The flat parse tree is only built when enabled by 
+// Parser::set_flat_tree_enabled().
+//
+// @return
+//  The flat parse tree.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const ParserFlatTree& Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::flat_tree() const
+{
+    return flat_tree_;
+}
+
 /**
 // Get the position that this %Parser is up to.
 //
 // @return
 //  The iterator at the position that this %Parser is up to.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-const Iterator& Parser<Iterator, UserData, Char, Traits, Allocator>::position() const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const Iterator& Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::position() const
 {
     return lexer_.position();
 }
@@ -247,10 +406,10 @@ const Iterator& Parser<Iterator, UserData, Char, Traits, Allocator>::position()
 //  An %AddParserActionHandler helper that provides a convenient syntax for adding
 //  action handlers to this %Parser.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator> Parser<Iterator, UserData, Char, Traits, Allocator>::parser_action_handlers()
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables> Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::parser_action_handlers()
 {
-    return AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator>( this );
+    return AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator, Tables>( this );
 }
 
 /**
@@ -260,8 +419,8 @@ AddParserActionHandler<Iterator, UserData, Char, Traits, Allocator> Parser<Itera
 //  An %AddLexerActionHandler helper that provides a convenient syntax for
 //  adding action handlers to the %Lexer.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-AddLexerActionHandler<Iterator, Char, Traits, Allocator> Parser<Iterator, UserData, Char, Traits, Allocator>::lexer_action_handlers()
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+AddLexerActionHandler<Iterator, Char, Traits, Allocator> Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::lexer_action_handlers()
 {
     return AddLexerActionHandler<Iterator, Char, Traits, Allocator>( &lexer_ );
 }
@@ -273,10 +432,34 @@ AddLexerActionHandler<Iterator, Char, Traits, Allocator> Parser<Iterator, UserDa
 //  The function to set the default action handler for this %Parser to or
 //  null to set this %Parser to have no default action handler.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::set_default_action_handler( ParserActionFunction function )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_default_action_handler( ParserActionFunction function )
 {
     default_action_handler_ = function;
+    default_action_pointer_ = nullptr;
+    default_action_context_ = nullptr;
+}
+
+/**
+// Set the default action handler for this %Parser to the plain function
+// \e function called with \e context.
+//
+// Plain function handlers are called directly rather than through a
+// std::function.
+//
+// @param function
+//  The function to set the default action handler for this %Parser to or
+//  null to set this %Parser to have no default action handler.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_default_action_handler( ParserActionPointer function, void* context )
+{
+    default_action_handler_ = nullptr;
+    default_action_pointer_ = function;
+    default_action_context_ = context;
 }
 
 /**
@@ -289,8 +472,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::set_default_action_han
 //  The function to set the action handler to or null to set the action 
 //  handler to have no function.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::set_action_handler( const char* identifier, ParserActionFunction function )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_action_handler( const char* identifier, ParserActionFunction function )
 {
     LALR_ASSERT( identifier );
     
@@ -303,9 +486,73 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::set_action_handler( co
     if ( action_handler != action_handlers_.end() )
     {
         action_handler->function_ = function;
+        action_handler->pointer_ = nullptr;
+        action_handler->context_ = nullptr;
+    }
+}
+
+/**
+// Set the action handler for \e identifier to the plain function 
+// \e function called with \e context.
+//
+// Plain function handlers are called directly rather than through a
+// std::function.
+//
+// @param identifier
+//  The identifier of the action handler to set the function for.
+//
+// @param function
+//  The function to set the action handler to or null to set the action 
+//  handler to have no function.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_action_handler( const char* identifier, ParserActionPointer function, void* context )
+{
+    LALR_ASSERT( identifier );
+    
+    typename std::vector<ParserActionHandler>::iterator action_handler = action_handlers_.begin();
+    while ( action_handler != action_handlers_.end() && strcmp(action_handler->action_->identifier, identifier) != 0 )
+    {
+        ++action_handler;
+    }
+    
+    if ( action_handler != action_handlers_.end() )
+    {
+        set_action_handler( action_handler->action_->index, function, context );
     }
 }
 
+/**
+// Set the action handler for the action at \e index to the plain function 
+// \e function called with \e context.
+//
+// Indices are those of the actions in the state machine used by this 
+// %Parser; lalrc generates constants for them along with a function to 
+// bind the methods of a handler object to them (see lalrc --actions).
+//
+// @param index
+//  The index of the action to set the handler for.
+//
+// @param function
+//  The function to set the action handler to or null to set the action 
+//  handler to have no function.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_action_handler( int index, ParserActionPointer function, void* context )
+{
+    LALR_ASSERT( index >= 0 && index < static_cast<int>(action_handlers_.size()) );
+    ParserActionHandler& action_handler = action_handlers_[index];
+    action_handler.function_ = nullptr;
+    action_handler.pointer_ = function;
+    action_handler.context_ = context;
+}
+
 /**
 // Set the lexer action handler for \e identifier to \e function.
 //
@@ -316,13 +563,34 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::set_action_handler( co
 //  The function to set the action handler to or null to set the action 
 //  handler to have no function.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::set_lexer_action_handler( const char* identifier, LexerActionFunction function )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_lexer_action_handler( const char* identifier, LexerActionFunction function )
 {
     LALR_ASSERT( identifier );
     lexer_.set_action_handler( identifier, function );
 }
 
+/**
+// Set the lexer action handler for \e identifier to the plain function
+// \e function called with \e context.
+//
+// @param identifier
+//  The identifier of the action handler to set the function for.
+//
+// @param function
+//  The function to set the action handler to or null to set the action 
+//  handler to have no function.
+//
+// @param context
+//  The pointer to pass as the first argument to \e function.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_lexer_action_handler( const char* identifier, LexerActionPointer function, void* context )
+{
+    LALR_ASSERT( identifier );
+    lexer_.set_action_handler( identifier, function, context );
+}
+
 /**
 // Fire an %error event.
 //
@@ -333,8 +601,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::set_lexer_action_handl
 // @param error
 //  The %Error that describes the %error that has occured.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::fire_error( int error, const char* format, ... ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::fire_error( int error, const char* format, ... ) const
 {
     if ( error_policy_ )
     {
@@ -354,8 +622,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::fire_error( int error,
 // @param ...
 //  Parameters to fill in the message as specified by \e format.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::fire_printf( const char* format, ... ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::fire_printf( const char* format, ... ) const
 {
     if ( error_policy_ )
     {
@@ -374,6 +642,33 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::fire_printf( const cha
     }
 }
 
+/**
+// Set whether or not a flat parse tree is built during parsing.
+//
+// The flat parse tree is built alongside any user data and is available 
+// from Parser::flat_tree() after a parse.
+//
+// @param flat_tree_enabled
+//  True to build a flat parse tree or false to suppress this behaviour.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_flat_tree_enabled( bool flat_tree_enabled )
+{
+    flat_tree_enabled_ = flat_tree_enabled;
+}
+
+/**
+// Is a flat parse tree built during parsing?
+//
+// @return
+//  True if a flat parse tree is built otherwise false.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::is_flat_tree_enabled() const
+{
+    return flat_tree_enabled_;
+}
+
 /**
 // Set whether or not shift operations are printed.
 //
@@ -381,8 +676,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::fire_printf( const cha
 //  True to cause any shift or reduce operations to be printed or false to 
 //  suppress this behaviour.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::set_debug_enabled( bool debug_enabled )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::set_debug_enabled( bool debug_enabled )
 {
     debug_enabled_ = debug_enabled;
 }
@@ -393,8 +688,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::set_debug_enabled( boo
 // @return
 //  True if shift and reduce operations are printed otherwise false.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_debug_enabled() const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+bool Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::is_debug_enabled() const
 {
     return debug_enabled_;
 }
@@ -402,6 +697,14 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_debug_enabled() con
 /**
 // Find the Transition for \e symbol in \e state.
 //
+// Uses the constexpr tables of \e Tables when there are any or the dense 
+// or compressed transition table of the state machine when there is one 
+// and otherwise searches the transitions of \e state.  The 
+// compressed table returns the default transition for \e state, if any, 
+// when \e symbol has no entry so reductions may be made before an error is
+// detected.  Default transitions are never taken on the error symbol so 
+// that error recovery only reduces where the grammar explicitly allows it.
+//
 // @param symbol
 //  The symbol to find the transition for.
 //
@@ -412,11 +715,52 @@ bool Parser<Iterator, UserData, Char, Traits, Allocator>::is_debug_enabled() con
 //  The transition to take on \e symbol or null if there was no such transition from
 //  \e state.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator>::find_transition( const ParserSymbol* symbol, const ParserState* state ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::find_transition( const ParserSymbol* symbol, const ParserState* state ) const
 {
     LALR_ASSERT( state );
     LALR_ASSERT( state_machine_ );
+    if constexpr ( !std::is_void<Tables>::value )
+    {
+        if ( !symbol )
+        {
+            return nullptr;
+        }
+        LALR_ASSERT( state->index >= 0 && state->index < Tables::states_size );
+        LALR_ASSERT( symbol->index >= 0 && symbol->index < Tables::symbols_size );
+        int index = Tables::transition_table[state->index * Tables::symbols_size + symbol->index];
+        return index >= 0 ? &state_machine_->transitions[index] : nullptr;
+    }
+
+    if ( state_machine_->transition_table )
+    {
+        if ( !symbol )
+        {
+            return nullptr;
+        }
+        int index = state_machine_->transition_table[state->index * state_machine_->symbols_size + symbol->index];
+        return index >= 0 ? &state_machine_->transitions[index] : nullptr;
+    }
+
+    if ( state_machine_->compressed_base )
+    {
+        if ( !symbol )
+        {
+            return nullptr;
+        }
+        int entry = state_machine_->compressed_base[state->index] + symbol->index;
+        int index = -1;
+        if ( entry < state_machine_->compressed_size && state_machine_->compressed_check[entry] == state->index )
+        {
+            index = state_machine_->compressed_next[entry];
+        }
+        else if ( symbol != state_machine_->error_symbol )
+        {
+            index = state_machine_->default_transitions[state->index];
+        }
+        return index >= 0 ? &state_machine_->transitions[index] : nullptr;
+    }
+
     const ParserTransition* transition = state->transitions;
     const ParserTransition* transitions_end = state->transitions + state->length;
     while ( transition != transitions_end && transition->symbol != symbol )
@@ -426,6 +770,31 @@ const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator>::fin
     return transition != transitions_end ? transition : nullptr;
 }
 
+/**
+// @internal
+//
+// Find the transition to take from \e state on the lookahead \e symbol.
+//
+// States that reduce a single production on every lookahead are reduced
+// without consulting the lookahead or the transition tables.
+//
+// @param symbol
+//  The lookahead symbol to find the transition for.
+//
+// @param state
+//  The state to find the transition from (assumed not null).
+//
+// @return
+//  The default reduction from \e state, the transition to take on 
+//  \e symbol, or null if there was no such transition from \e state.
+*/
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::find_transition_or_default_reduction( const ParserSymbol* symbol, const ParserState* state ) const
+{
+    LALR_ASSERT( state );
+    return state->default_reduction ? state->default_reduction : find_transition( symbol, state );
+}
+
 /**
 // @internal
 //
@@ -441,8 +810,8 @@ const ParserTransition* Parser<Iterator, UserData, Char, Traits, Allocator>::fin
 //  The iterator to the Node to reduce to or the end iterator for \e nodes
 //  if no Node to reduce to could be found.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-typename std::vector<ParserNode<UserData, Char, Traits, Allocator> >::iterator Parser<Iterator, UserData, Char, Traits, Allocator>::find_node_to_reduce_to( const ParserTransition* transition, std::vector<ParserNode>& nodes )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+typename std::vector<ParserNode<UserData, Char, Traits, Allocator> >::iterator Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::find_node_to_reduce_to( const ParserTransition* transition, std::vector<ParserNode>& nodes )
 {
     LALR_ASSERT( transition );
     LALR_ASSERT( transition->reduced_length < int(nodes.size()) );
@@ -456,14 +825,14 @@ typename std::vector<ParserNode<UserData, Char, Traits, Allocator> >::iterator P
 // @param node
 //  The ParserNode that has been shifted onto the stack.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_shift( const ParserNode& node ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::debug_shift( const ParserNode& node ) const
 {
     if ( debug_enabled_ )
     {
         const ParserSymbol* symbol = node.symbol();
-        const std::string& lexeme = node.lexeme();
-        fire_printf( "SHIFT: (%s %s)\n", symbol ? symbol->identifier : "", lexeme.c_str() );
+        std::basic_string_view<Char, Traits> lexeme = node.lexeme();
+        fire_printf( "SHIFT: (%s %.*s)\n", symbol ? symbol->identifier : "", int(lexeme.size()), lexeme.data() );
     }
 }
 
@@ -479,8 +848,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_shift( const Par
 // @param finish
 //  One past the last ParserNode in the stack that will be reduced.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_reduce( const ParserSymbol* reduced_symbol, const ParserNode* start, const ParserNode* finish ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::debug_reduce( const ParserSymbol* reduced_symbol, const ParserNode* start, const ParserNode* finish ) const
 {
     LALR_ASSERT( start );
     LALR_ASSERT( finish );
@@ -495,16 +864,16 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_reduce( const Pa
         if ( node != finish )
         {
             const ParserSymbol* symbol = node->symbol();
-            const std::string& lexeme = node->lexeme();
-            fire_printf( "(%s %s)", symbol ? symbol->identifier : "", lexeme.c_str() );
+            std::basic_string_view<Char, Traits> lexeme = node->lexeme();
+            fire_printf( "(%s %.*s)", symbol ? symbol->identifier : "", int(lexeme.size()), lexeme.data() );
             ++node;
         }
         
         while ( node != finish )
         {
             const ParserSymbol* symbol = node->symbol();
-            const std::string& lexeme = node->lexeme();
-            fire_printf( " (%s %s)", symbol ? symbol->identifier : "", lexeme.c_str() );
+            std::basic_string_view<Char, Traits> lexeme = node->lexeme();
+            fire_printf( " (%s %.*s)", symbol ? symbol->identifier : "", int(lexeme.size()), lexeme.data() );
             ++node;
         }
         
@@ -516,11 +885,15 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_reduce( const Pa
 // Handle any parser action that needs to be taken when \e reduced_production
 // is reduced.
 //
+// Reductions without an action handler or default action handler build a 
+// ParserTree node when the user data is a pointer to a ParserTree.
+//
 // @param reduced_producion
 //  The production that has been reduced.
 //
 // @param start
-//  The first ParserNode in the stack that will be reduced.
+//  The first ParserNode in the stack that will be reduced (action handlers
+//  may move user data out of the nodes being reduced).
 //
 // @param finish
 //  One past the last ParserNode in the stack that will be reduced.
@@ -528,8 +901,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::debug_reduce( const Pa
 // @return
 //  The user data that results from the reduction.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const ParserTransition* transition, const ParserNode* start, const ParserNode* finish ) const
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+UserData Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::handle( const ParserTransition* transition, ParserNode* start, ParserNode* finish )
 {
     LALR_ASSERT( start );
     LALR_ASSERT( finish );
@@ -540,13 +913,35 @@ UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const Pars
     if ( action != ParserAction::INVALID_INDEX )
     {
         LALR_ASSERT( action >= 0 && action < static_cast<int>(action_handlers_.size()) );            
-        if ( action_handlers_[action].function_ )
+        const ParserActionHandler& action_handler = action_handlers_[action];
+        if ( action_handler.pointer_ )
         {
-            return action_handlers_[action].function_( start, finish );
+            return action_handler.pointer_( action_handler.context_, start, finish );
         }
+        if ( action_handler.function_ )
+        {
+            return action_handler.function_( start, finish );
+        }
+    }
+
+    if ( default_action_pointer_ )
+    {
+        return default_action_pointer_( default_action_context_, start, finish );
+    }
+
+    if ( default_action_handler_ )
+    {
+        return default_action_handler_( start, finish );
     }
 
-    return default_action_handler_ ? default_action_handler_( start, finish ) : UserData();
+    if constexpr ( std::is_same<UserData, const ParserTree<Char, Traits>*>::value )
+    {
+        return ParserTree<Char, Traits>::create( &arena_, transition->reduced_symbol, start, finish );
+    }
+    else
+    {
+        return UserData();
+    }
 }
 
 /**
@@ -556,15 +951,34 @@ UserData Parser<Iterator, UserData, Char, Traits, Allocator>::handle( const Pars
 //  The shift transition that specifies the state that will be transitioned
 //  into after the shift and the productions that were potentially started
 //  at this point.
+//
+// @param lexeme
+//  The lexeme of the token being shifted.
+//
+// @param spanned
+//  True if \e lexeme is a span of the input that the shifted node can refer
+//  to or false to copy \e lexeme into the shifted node.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::shift( const ParserTransition* transition, const std::basic_string<Char, Traits, Allocator>& lexeme )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::shift( const ParserTransition* transition, std::basic_string_view<Char, Traits> lexeme, bool spanned )
 {
     LALR_ASSERT( state_machine_ );
     LALR_ASSERT( transition );    
-    ParserNode node( transition->state, transition->symbol, lexeme );
-    debug_shift( node );
-    nodes_.push_back( node );
+    if ( spanned )
+    {
+        nodes_.emplace_back( transition->state, transition->symbol, lexeme );
+    }
+    else
+    {
+        nodes_.emplace_back( transition->state, transition->symbol, std::basic_string<Char, Traits, Allocator>(lexeme) );
+    }
+    debug_shift( nodes_.back() );
+
+    if ( flat_tree_enabled_ )
+    {
+        std::ptrdiff_t begin = spanned && input_ && lexeme.data() ? lexeme.data() - input_ : -1;
+        flat_tree_.shift( transition->symbol->index, begin, begin >= 0 ? begin + std::ptrdiff_t(lexeme.size()) : -1 );
+    }
 }
 
 /**
@@ -579,8 +993,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::shift( const ParserTra
 // @param rejected
 //  A variable to receive whether or not this Parser has rejected its input.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::reduce( const ParserTransition* transition, bool* accepted, bool* /*rejected*/ )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::reduce( const ParserTransition* transition, bool* accepted, bool* /*rejected*/ )
 {
     LALR_ASSERT( state_machine_ );
     LALR_ASSERT( transition );
@@ -590,16 +1004,19 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::reduce( const ParserTr
     if ( symbol != state_machine_->start_symbol )
     {
         typename std::vector<ParserNode>::iterator i = find_node_to_reduce_to( transition, nodes_ );
-        const ParserNode* start = i != nodes_.end() ? &(*i) : &nodes_.back() + 1;
-        const ParserNode* finish = &nodes_.back() + 1;
+        ParserNode* start = i != nodes_.end() ? &(*i) : &nodes_.back() + 1;
+        ParserNode* finish = &nodes_.back() + 1;
 
         debug_reduce( transition->reduced_symbol, start, finish );
         UserData user_data = handle( transition, start, finish );
+        if ( flat_tree_enabled_ )
+        {
+            flat_tree_.reduce( symbol->index, transition->production, transition->action, int(finish - start) );
+        }
         nodes_.erase( i, nodes_.end() );
         const ParserTransition* transition = find_transition( symbol, nodes_.back().state() );
         LALR_ASSERT( transition );
-        ParserNode node( transition->state, symbol, user_data );
-        nodes_.push_back( node );
+        nodes_.emplace_back( transition->state, symbol, std::move(user_data) );
     }
     else
     {    
@@ -622,8 +1039,8 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::reduce( const ParserTr
 // @param rejected
 //  A variable to receive whether or not this Parser has rejected its input.
 */
-template <class Iterator, class UserData, class Char, class Traits, class Allocator>
-void Parser<Iterator, UserData, Char, Traits, Allocator>::error( bool* accepted, bool* rejected )
+template <class Iterator, class UserData, class Char, class Traits, class Allocator, class Tables>
+void Parser<Iterator, UserData, Char, Traits, Allocator, Tables>::error( bool* accepted, bool* rejected )
 {
     LALR_ASSERT( state_machine_ );
     LALR_ASSERT( !nodes_.empty() );
@@ -639,7 +1056,7 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::error( bool* accepted,
             switch ( transition->type )
             {
                 case TRANSITION_SHIFT:
-                    shift( transition, std::basic_string<Char, Traits, Allocator>() );
+                    shift( transition, std::basic_string_view<Char, Traits>(), false );
                     handled = true;
                     break;
 
@@ -656,6 +1073,10 @@ void Parser<Iterator, UserData, Char, Traits, Allocator>::error( bool* accepted,
         }
         else
         {
+            if ( flat_tree_enabled_ && nodes_.size() > 1 )
+            {
+                flat_tree_.pop();
+            }
             nodes_.pop_back();
         }
     }
@@ -0,0 +1,78 @@
+//
+// ParserArena.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "ParserArena.hpp"
+#include "assert.hpp"
+#include <algorithm>
+#include <stdint.h>
+
+using std::max;
+using namespace lalr;
+
+ParserArena::ParserArena( size_t block_size )
+: blocks_(),
+  block_size_( block_size ),
+  block_( 0 ),
+  position_( 0 )
+{
+    LALR_ASSERT( block_size_ > 0 );
+}
+
+void* ParserArena::allocate( size_t size, size_t alignment )
+{
+    LALR_ASSERT( alignment > 0 && (alignment & (alignment - 1)) == 0 );
+    if ( block_ < blocks_.size() )
+    {
+        Block& block = blocks_[block_];
+        size_t position = position_ + padding( block.data_.get() + position_, alignment );
+        if ( position + size <= block.size_ )
+        {
+            position_ = position + size;
+            return block.data_.get() + position;
+        }
+    }
+    return allocate_from_next_block( size, alignment );
+}
+
+void ParserArena::reset()
+{
+    block_ = 0;
+    position_ = 0;
+}
+
+size_t ParserArena::capacity() const
+{
+    size_t capacity = 0;
+    for ( const Block& block : blocks_ )
+    {
+        capacity += block.size_;
+    }
+    return capacity;
+}
+
+void* ParserArena::allocate_from_next_block( size_t size, size_t alignment )
+{
+    size_t required = size + alignment - 1;
+    size_t next_block = blocks_.empty() ? 0 : block_ + 1;
+    if ( next_block >= blocks_.size() || blocks_[next_block].size_ < required )
+    {
+        Block block;
+        block.size_ = max( block_size_, required );
+        block.data_.reset( new char [block.size_] );
+        blocks_.insert( blocks_.begin() + next_block, std::move(block) );
+    }
+
+    block_ = next_block;
+    Block& block = blocks_[block_];
+    size_t position = padding( block.data_.get(), alignment );
+    LALR_ASSERT( position + size <= block.size_ );
+    position_ = position + size;
+    return block.data_.get() + position;
+}
+
+size_t ParserArena::padding( const char* address, size_t alignment )
+{
+    return (alignment - (reinterpret_cast<uintptr_t>(address) & (alignment - 1))) & (alignment - 1);
+}
@@ -0,0 +1,63 @@
+#ifndef LALR_PARSERARENA_HPP_INCLUDED
+#define LALR_PARSERARENA_HPP_INCLUDED
+
+#include <memory>
+#include <vector>
+#include <stddef.h>
+
+namespace lalr
+{
+
+/**
+// A bump allocator that provides memory for the nodes of a parse tree.
+//
+// Memory is allocated from large blocks by advancing a position and is 
+// only ever released all at once by ParserArena::reset().  Blocks are 
+// retained across resets so that repeated parses reuse the same memory.  
+// Objects constructed in arena memory are never destroyed and so must be 
+// trivially destructible.
+*/
+class ParserArena
+{
+    struct Block
+    {
+        std::unique_ptr<char[]> data_; ///< The memory in this block.
+        size_t size_; ///< The size of this block in bytes.
+    };
+
+    std::vector<Block> blocks_; ///< The blocks of memory allocated from.
+    size_t block_size_; ///< The minimum size of each block in bytes.
+    size_t block_; ///< The index of the block currently being allocated from.
+    size_t position_; ///< The offset of the next free byte in the current block.
+
+    public:
+        ParserArena( size_t block_size = 64 * 1024 );
+        void* allocate( size_t size, size_t alignment );
+        void reset();
+        size_t capacity() const;
+
+        template <class Type> Type* allocate( size_t size );
+
+    private:
+        void* allocate_from_next_block( size_t size, size_t alignment );
+        static size_t padding( const char* address, size_t alignment );
+};
+
+/**
+// Allocate uninitialized memory for an array of objects.
+//
+// @param size
+//  The number of objects to allocate memory for.
+//
+// @return
+//  The allocated memory.
+*/
+template <class Type>
+Type* ParserArena::allocate( size_t size )
+{
+    return static_cast<Type*>( allocate(sizeof(Type) * size, alignof(Type)) );
+}
+
+}
+
+#endif
@@ -0,0 +1,204 @@
+//
+// ParserFlatTree.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "ParserFlatTree.hpp"
+#include "ParserAction.hpp"
+#include "assert.hpp"
+
+using namespace lalr;
+
+ParserFlatTree::ParserFlatTree()
+: symbols_(),
+  productions_(),
+  actions_(),
+  sizes_(),
+  begins_(),
+  ends_(),
+  subtrees_()
+{
+}
+
+void ParserFlatTree::reset()
+{
+    symbols_.clear();
+    productions_.clear();
+    actions_.clear();
+    sizes_.clear();
+    begins_.clear();
+    ends_.clear();
+    subtrees_.clear();
+}
+
+int ParserFlatTree::size() const
+{
+    return int(symbols_.size());
+}
+
+int ParserFlatTree::symbol( int node ) const
+{
+    LALR_ASSERT( node >= 0 && node < size() );
+    return symbols_[node];
+}
+
+int ParserFlatTree::production( int node ) const
+{
+    LALR_ASSERT( node >= 0 && node < size() );
+    return productions_[node];
+}
+
+int ParserFlatTree::action( int node ) const
+{
+    LALR_ASSERT( node >= 0 && node < size() );
+    return actions_[node];
+}
+
+int ParserFlatTree::children( int node ) const
+{
+    LALR_ASSERT( node >= 0 && node < size() );
+    return sizes_[node];
+}
+
+std::ptrdiff_t ParserFlatTree::begin( int node ) const
+{
+    LALR_ASSERT( node >= 0 && node < size() );
+    return begins_[node];
+}
+
+std::ptrdiff_t ParserFlatTree::end( int node ) const
+{
+    LALR_ASSERT( node >= 0 && node < size() );
+    return ends_[node];
+}
+
+const std::vector<int>& ParserFlatTree::symbols() const
+{
+    return symbols_;
+}
+
+const std::vector<int>& ParserFlatTree::productions() const
+{
+    return productions_;
+}
+
+const std::vector<int>& ParserFlatTree::actions() const
+{
+    return actions_;
+}
+
+const std::vector<int>& ParserFlatTree::sizes() const
+{
+    return sizes_;
+}
+
+const std::vector<std::ptrdiff_t>& ParserFlatTree::begins() const
+{
+    return begins_;
+}
+
+const std::vector<std::ptrdiff_t>& ParserFlatTree::ends() const
+{
+    return ends_;
+}
+
+/**
+// Append a terminal node.
+//
+// @param symbol
+//  The index of the symbol shifted.
+//
+// @param begin
+//  The offset of the first character of the shifted lexeme or -1 if unknown.
+//
+// @param end
+//  The offset of one past the last character of the shifted lexeme or -1 if
+//  unknown.
+*/
+void ParserFlatTree::shift( int symbol, std::ptrdiff_t begin, std::ptrdiff_t end )
+{
+    subtrees_.push_back( size() );
+    symbols_.push_back( symbol );
+    productions_.push_back( -1 );
+    actions_.push_back( int(ParserAction::INVALID_INDEX) );
+    sizes_.push_back( 0 );
+    begins_.push_back( begin );
+    ends_.push_back( end );
+}
+
+/**
+// Append a non-terminal node whose children are the subtrees of the top 
+// \e length nodes on the parser's stack.
+//
+// The node spans from the first known beginning to the last known end of 
+// its children.  Nodes without children are given an empty span at the 
+// end of the node before them.
+//
+// @param symbol
+//  The index of the symbol reduced to.
+//
+// @param production
+//  The index of the production reduced by.
+//
+// @param action
+//  The index of the action taken on the reduction or 
+//  ParserAction::INVALID_INDEX if there is no action.
+//
+// @param length
+//  The number of symbols on the right-hand side of the reduced production.
+*/
+void ParserFlatTree::reduce( int symbol, int production, int action, int length )
+{
+    LALR_ASSERT( length >= 0 && length <= int(subtrees_.size()) );
+
+    int first = int(subtrees_.size()) - length;
+    std::ptrdiff_t begin = -1;
+    std::ptrdiff_t end = -1;
+    if ( length > 0 )
+    {
+        for ( int i = first; i < int(subtrees_.size()) && begin == -1; ++i )
+        {
+            int child = i + 1 < int(subtrees_.size()) ? subtrees_[i + 1] - 1 : size() - 1;
+            begin = begins_[child];
+        }
+        for ( int i = int(subtrees_.size()) - 1; i >= first && end == -1; --i )
+        {
+            int child = i + 1 < int(subtrees_.size()) ? subtrees_[i + 1] - 1 : size() - 1;
+            end = ends_[child];
+        }
+    }
+    else if ( !ends_.empty() )
+    {
+        begin = ends_.back();
+        end = ends_.back();
+    }
+
+    int subtree = length > 0 ? subtrees_[first] : size();
+    subtrees_.resize( first );
+    subtrees_.push_back( subtree );
+    symbols_.push_back( symbol );
+    productions_.push_back( production );
+    actions_.push_back( action );
+    sizes_.push_back( length );
+    begins_.push_back( begin );
+    ends_.push_back( end );
+}
+
+/**
+// Discard the subtree of the node on top of the parser's stack.
+//
+// Used during error recovery when nodes are popped from the parser's stack
+// without being reduced.
+*/
+void ParserFlatTree::pop()
+{
+    LALR_ASSERT( !subtrees_.empty() );
+    int subtree = subtrees_.back();
+    subtrees_.pop_back();
+    symbols_.resize( subtree );
+    productions_.resize( subtree );
+    actions_.resize( subtree );
+    sizes_.resize( subtree );
+    begins_.resize( subtree );
+    ends_.resize( subtree );
+}
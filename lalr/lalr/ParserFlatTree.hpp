@@ -0,0 +1,59 @@
+#ifndef LALR_PARSERFLATTREE_HPP_INCLUDED
+#define LALR_PARSERFLATTREE_HPP_INCLUDED
+
+#include <vector>
+#include <cstddef>
+
+namespace lalr
+{
+
+/**
+// A parse tree stored as flat arrays of nodes in postorder.
+//
+// Each node is described by the index of its symbol, the index of the 
+// production it was reduced by (-1 for terminals), the index of the action 
+// taken when it was reduced (ParserAction::INVALID_INDEX for terminals and 
+// reductions without actions), its number of children, and the span of 
+// input, as character offsets, that it covers.  A node's 
+// children are the subtrees immediately preceding it so a tree can be 
+// walked, written out, or mapped back in without chasing any pointers.
+//
+// The arrays form a forest with one tree per node on the parser's stack; 
+// after a successful parse this is the single tree rooted at the last node.
+// Spans are only known for lexemes that are spans of contiguous input, 
+// otherwise the offsets are -1.
+*/
+class ParserFlatTree
+{
+    std::vector<int> symbols_; ///< The index of the symbol at each node.
+    std::vector<int> productions_; ///< The index of the production reduced to form each node or -1 for terminals.
+    std::vector<int> actions_; ///< The index of the action taken to reduce each node.
+    std::vector<int> sizes_; ///< The number of children of each node.
+    std::vector<std::ptrdiff_t> begins_; ///< The offset of the first character covered by each node or -1 if unknown.
+    std::vector<std::ptrdiff_t> ends_; ///< The offset of one past the last character covered by each node or -1 if unknown.
+    std::vector<int> subtrees_; ///< The index of the first node in the subtree of each node on the parser's stack.
+
+    public:
+        ParserFlatTree();
+        void reset();
+        int size() const;
+        int symbol( int node ) const;
+        int production( int node ) const;
+        int action( int node ) const;
+        int children( int node ) const;
+        std::ptrdiff_t begin( int node ) const;
+        std::ptrdiff_t end( int node ) const;
+        const std::vector<int>& symbols() const;
+        const std::vector<int>& productions() const;
+        const std::vector<int>& actions() const;
+        const std::vector<int>& sizes() const;
+        const std::vector<std::ptrdiff_t>& begins() const;
+        const std::vector<std::ptrdiff_t>& ends() const;
+        void shift( int symbol, std::ptrdiff_t begin, std::ptrdiff_t end );
+        void reduce( int symbol, int production, int action, int length );
+        void pop();
+};
+
+}
+
+#endif
@@ -4,6 +4,7 @@
 #include "ParserUserData.hpp"
 #include <memory>
 #include <string>
+#include <string_view>
 #include <set>
 
 namespace lalr
@@ -21,17 +22,21 @@ class ParserNode
     const ParserState* state_; ///< The state at this node.
     const ParserSymbol* symbol_; ///< The symbol at this node.
     int line_; ///< The line that generated this node or -1 if this node is unrelated to a line of source.
-    std::basic_string<Char, Traits, Allocator> lexeme_; ///< The lexeme at this node (empty if this node's symbol is a non-terminal).
+    std::basic_string_view<Char, Traits> span_; ///< The lexeme at this node when it is a span of the input.
+    std::basic_string<Char, Traits, Allocator> lexeme_; ///< The lexeme at this node when it is owned by this node (empty if this node's symbol is a non-terminal).
     UserData user_data_; ///< The user data at this node.
 
     public:
-        ParserNode( const ParserState* state, const ParserSymbol* symbol, const UserData& user_data );
-        ParserNode( const ParserState* state, const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme );
+        ParserNode( const ParserState* state, const ParserSymbol* symbol, UserData&& user_data );
+        ParserNode( const ParserState* state, const ParserSymbol* symbol, std::basic_string<Char, Traits, Allocator>&& lexeme );
+        ParserNode( const ParserState* state, const ParserSymbol* symbol, std::basic_string_view<Char, Traits> span );
         const ParserState* state() const;
         const ParserSymbol* symbol() const;
         int line() const;
-        const std::basic_string<Char, Traits, Allocator>& lexeme() const;
+        std::basic_string_view<Char, Traits> lexeme() const;
+        bool spanned() const;
         const UserData& user_data() const;
+        UserData& user_data();
 };
 
 }
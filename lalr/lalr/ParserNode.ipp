@@ -3,6 +3,7 @@
 
 #include "ParserNode.hpp"
 #include "assert.hpp"
+#include <utility>
 
 namespace lalr
 {
@@ -23,12 +24,13 @@ namespace lalr
 //  The user data that stores application specific data at this node.
 */
 template <class UserData, class Char, class Traits, class Allocator>
-ParserNode<UserData, Char, Traits, Allocator>::ParserNode( const ParserState* state, const ParserSymbol* symbol, const UserData& user_data )
+ParserNode<UserData, Char, Traits, Allocator>::ParserNode( const ParserState* state, const ParserSymbol* symbol, UserData&& user_data )
 : state_( state ),
   symbol_( symbol ),
   line_( -1 ),
+  span_(),
   lexeme_(),
-  user_data_( user_data )
+  user_data_( std::move(user_data) )
 {
     LALR_ASSERT( state );
 }
@@ -49,16 +51,43 @@ ParserNode<UserData, Char, Traits, Allocator>::ParserNode( const ParserState* st
 //  The lexeme at this node.
 */
 template <class UserData, class Char, class Traits, class Allocator>
-ParserNode<UserData, Char, Traits, Allocator>::ParserNode( const ParserState* state, const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme )
+ParserNode<UserData, Char, Traits, Allocator>::ParserNode( const ParserState* state, const ParserSymbol* symbol, std::basic_string<Char, Traits, Allocator>&& lexeme )
 : state_( state ),
   symbol_( symbol ),
   line_( -1 ),
-  lexeme_( lexeme ),
+  span_(),
+  lexeme_( std::move(lexeme) ),
   user_data_()
 {
     LALR_ASSERT( state );
 }
 
+/**
+// Constructor.
+//
+// @param state
+//  The state at this node.
+//
+// @param symbol
+//  The symbol at this node.
+//
+// @param span
+//  The lexeme at this node as a span of the input that remains valid for 
+//  the lifetime of this node (assumed not to have a null data pointer).
+*/
+template <class UserData, class Char, class Traits, class Allocator>
+ParserNode<UserData, Char, Traits, Allocator>::ParserNode( const ParserState* state, const ParserSymbol* symbol, std::basic_string_view<Char, Traits> span )
+: state_( state ),
+  symbol_( symbol ),
+  line_( -1 ),
+  span_( span ),
+  lexeme_(),
+  user_data_()
+{
+    LALR_ASSERT( state );
+    LALR_ASSERT( span.data() );
+}
+
 /**
 // Get the state at this node.
 //
@@ -103,9 +132,22 @@ int ParserNode<UserData, Char, Traits, Allocator>::line() const
 //  The lexeme.
 */
 template <class UserData, class Char, class Traits, class Allocator>
-const std::basic_string<Char, Traits, Allocator>& ParserNode<UserData, Char, Traits, Allocator>::lexeme() const
+std::basic_string_view<Char, Traits> ParserNode<UserData, Char, Traits, Allocator>::lexeme() const
 {
-    return lexeme_;
+    return span_.data() ? span_ : std::basic_string_view<Char, Traits>( lexeme_ );
+}
+
+/**
+// Is the lexeme at this node a span of the input?
+//
+// @return
+//  True if the lexeme at this node refers directly into the input or false
+//  if it is owned by this node.
+*/
+template <class UserData, class Char, class Traits, class Allocator>
+bool ParserNode<UserData, Char, Traits, Allocator>::spanned() const
+{
+    return span_.data() != nullptr;
 }
 
 /**
@@ -120,6 +162,21 @@ const UserData& ParserNode<UserData, Char, Traits, Allocator>::user_data() const
     return user_data_;
 }
 
+/**
+// Get the user data at this state.
+//
+// Action handlers can move user data out of the nodes that they reduce 
+// (e.g. to build trees of move-only types).
+//
+// @return
+//  The user data.
+*/
+template <class UserData, class Char, class Traits, class Allocator>
+UserData& ParserNode<UserData, Char, Traits, Allocator>::user_data()
+{
+    return user_data_;
+}
+
 }
 
 #endif
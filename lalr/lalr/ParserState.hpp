@@ -16,6 +16,7 @@ public:
     int index; ///< The index of this state.
     int length; ///< The number of transitions in this state.
     const ParserTransition* transitions; ///< The available transitions from this state.
+    const ParserTransition* default_reduction; ///< The reduction taken from this state without consulting the lookahead or null if this state has no default reduction.
 };
 
 }
@@ -38,6 +38,12 @@ public:
     const ParserState* start_state; ///< The start state.
     const LexerStateMachine* lexer_state_machine; ///< The state machine used by the lexer to match tokens
     const LexerStateMachine* whitespace_lexer_state_machine; ///< The state machine used by the lexer to skip whitespace
+    const int* transition_table; ///< The index of the transition from each state on each symbol (actions on terminals and gotos on non-terminals) or -1 if there is no transition (states_size x symbols_size) or null if there is no dense table.
+    int compressed_size; ///< The number of entries in the compressed transition table.
+    const int* compressed_base; ///< The offset of each state's row in the compressed transition table or null if there is no compressed table.
+    const int* compressed_check; ///< The index of the state that owns each entry in the compressed transition table or -1 if the entry is unused.
+    const int* compressed_next; ///< The index of the transition for each entry in the compressed transition table.
+    const int* default_transitions; ///< The index of the transition taken from each state on symbols that aren't in the compressed transition table or -1 if there is none.
 };
 
 }
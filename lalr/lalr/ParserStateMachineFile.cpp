@@ -0,0 +1,881 @@
+//
+// ParserStateMachineFile.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "ParserStateMachineFile.hpp"
+#include "ParserStateMachine.hpp"
+#include "ParserAction.hpp"
+#include "ParserSymbol.hpp"
+#include "ParserTransition.hpp"
+#include "ParserState.hpp"
+#include "LexerStateMachine.hpp"
+#include "LexerAction.hpp"
+#include "LexerTransition.hpp"
+#include "LexerState.hpp"
+#include "ErrorPolicy.hpp"
+#include "ErrorCode.hpp"
+#include "assert.hpp"
+#include <string.h>
+#include <stdio.h>
+#include <errno.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using std::vector;
+using std::unique_ptr;
+using namespace lalr;
+
+namespace
+{
+
+const int MAGIC = 0x524c414c; ///< Identifies compiled state machine files ("LALR" in little endian byte order).
+
+/**
+// The ints at the start of a compiled state machine file.
+//
+// Offsets to sections are in ints from the start of the file or zero for
+// sections that are not present.  References to other records are by index
+// or -1 for null and references to strings are byte offsets into the
+// strings section at the end of the file or -1 for null.
+*/
+enum Header
+{
+    HEADER_MAGIC,
+    HEADER_VERSION,
+    HEADER_SIZE, ///< The size of the file in bytes.
+    HEADER_STRINGS, ///< The offset of the strings section.
+    HEADER_IDENTIFIER,
+    HEADER_ACTIONS_SIZE,
+    HEADER_SYMBOLS_SIZE,
+    HEADER_TRANSITIONS_SIZE,
+    HEADER_STATES_SIZE,
+    HEADER_ACTIONS,
+    HEADER_SYMBOLS,
+    HEADER_TRANSITIONS,
+    HEADER_STATES,
+    HEADER_START_SYMBOL,
+    HEADER_END_SYMBOL,
+    HEADER_ERROR_SYMBOL,
+    HEADER_START_STATE,
+    HEADER_TRANSITION_TABLE,
+    HEADER_COMPRESSED_SIZE,
+    HEADER_COMPRESSED_BASE,
+    HEADER_COMPRESSED_CHECK,
+    HEADER_COMPRESSED_NEXT,
+    HEADER_DEFAULT_TRANSITIONS,
+    HEADER_LEXER,
+    HEADER_WHITESPACE_LEXER,
+    HEADER_KEY, ///< The string that identifies what the state machine was compiled from.
+    HEADER_INTS
+};
+
+/**
+// The ints at the start of each lexer state machine section.
+*/
+enum LexerHeader
+{
+    LEXER_ACTIONS_SIZE,
+    LEXER_TRANSITIONS_SIZE,
+    LEXER_STATES_SIZE,
+    LEXER_START_STATE,
+    LEXER_CLASSES_SIZE,
+    LEXER_ACTIONS,
+    LEXER_TRANSITIONS,
+    LEXER_STATES,
+    LEXER_CLASSES,
+    LEXER_CLASS_TRANSITIONS,
+    LEXER_LOOP_RANGES_OFFSET,
+    LEXER_WHITESPACE_SYMBOL,
+    LEXER_INTS
+};
+
+const int ACTION_INTS = 2; ///< index, identifier
+const int SYMBOL_INTS = 4; ///< index, identifier, lexeme, type
+const int TRANSITION_INTS = 9; ///< symbol, state, reduced symbol, reduced length, precedence, action, production, type, index
+const int STATE_INTS = 4; ///< index, length, first transition, default reduction
+const int LEXER_ACTION_INTS = 2; ///< index, identifier
+const int LEXER_TRANSITION_INTS = 4; ///< begin, end, state, action
+const int LEXER_STATE_INTS = 4; ///< index, length, first transition, symbol
+
+template <class Type>
+int index_of( const Type* element, const Type* elements )
+{
+    return element ? int(element - elements) : -1;
+}
+
+template <class Type>
+const Type* element_at( int index, const Type* elements, int size, bool* valid )
+{
+    LALR_ASSERT( valid );
+    if ( index < -1 || index >= size )
+    {
+        *valid = false;
+        return nullptr;
+    }
+    return index >= 0 ? &elements[index] : nullptr;
+}
+
+/**
+// Get the symbol matched by a lexer state from its index.
+//
+// The index one past the last symbol is the whitespace symbol of a lexer 
+// that whitespace is fused into and is only valid when \e fused is true.
+*/
+const ParserSymbol* symbol_at( int index, const ParserSymbol* symbols, int size, bool fused, bool* valid )
+{
+    return fused && index == size ? symbols + size : element_at( index, symbols, size, valid );
+}
+
+/**
+// Check that the \e size ints in \e values are all in [\e lower, \e upper).
+*/
+bool values_within( const int* values, int size, int lower, int upper )
+{
+    LALR_ASSERT( values || size == 0 );
+    for ( int i = 0; i < size; ++i )
+    {
+        if ( values[i] < lower || values[i] >= upper )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <class Type>
+const Type* transitions_at( int index, int length, const Type* transitions, int size, bool* valid )
+{
+    LALR_ASSERT( valid );
+    if ( index < -1 || index > size || length < 0 || (length > 0 && (index < 0 || length > size - index)) )
+    {
+        *valid = false;
+        return nullptr;
+    }
+    return index >= 0 ? transitions + index : nullptr;
+}
+
+}
+
+ParserStateMachineFile::ParserStateMachineFile()
+: image_( nullptr ),
+  size_( 0 ),
+  mapped_( false ),
+  buffer_(),
+  actions_(),
+  symbols_(),
+  transitions_(),
+  states_(),
+  lexer_(),
+  whitespace_lexer_(),
+  parser_state_machine_(),
+  error_policy_( nullptr )
+{
+    memset( &parser_state_machine_, 0, sizeof(parser_state_machine_) );
+}
+
+ParserStateMachineFile::~ParserStateMachineFile()
+{
+    unload();
+}
+
+/**
+// Get the loaded state machine.
+//
+// @return
+//  The loaded state machine or null if no file is loaded.
+*/
+const ParserStateMachine* ParserStateMachineFile::parser_state_machine() const
+{
+    return image_ ? &parser_state_machine_ : nullptr;
+}
+
+/**
+// Get the key that the loaded file was saved with.
+//
+// @return
+//  The key or null if no file is loaded or the file was saved without a key.
+*/
+const char* ParserStateMachineFile::key() const
+{
+    return image_ ? find_string( image_[HEADER_KEY] ) : nullptr;
+}
+
+/**
+// Load a compiled state machine file.
+//
+// The file is mapped into memory where that is supported and otherwise
+// read into memory.  Any previously loaded file is unloaded first.
+//
+// @param filename
+//  The name of the file to load.
+//
+// @param error_policy
+//  The error policy to report errors to or null to silently swallow errors.
+//
+// @return
+//  True if the file was loaded successfully otherwise false.
+*/
+bool ParserStateMachineFile::load( const char* filename, ErrorPolicy* error_policy )
+{
+    LALR_ASSERT( filename );
+    unload();
+    error_policy_ = error_policy;
+    if ( !read(filename) )
+    {
+        return false;
+    }
+    if ( !populate() )
+    {
+        fire_error( error_policy_, PARSER_ERROR_INVALID_FILE, "Invalid compiled state machine file '%s'", filename );
+        unload();
+        return false;
+    }
+    return true;
+}
+
+/**
+// Unload the currently loaded file, if any.
+//
+// Invalidates the state machine returned by
+// ParserStateMachineFile::parser_state_machine().
+*/
+void ParserStateMachineFile::unload()
+{
+#if !defined(_WIN32)
+    if ( mapped_ && image_ )
+    {
+        munmap( const_cast<int*>(image_), size_ );
+    }
+#endif
+    image_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    buffer_.reset();
+    actions_.reset();
+    symbols_.reset();
+    transitions_.reset();
+    states_.reset();
+    lexer_ = LexerAllocations();
+    whitespace_lexer_ = LexerAllocations();
+    memset( &parser_state_machine_, 0, sizeof(parser_state_machine_) );
+}
+
+/**
+// Write a state machine to a compiled state machine file.
+//
+// @param state_machine
+//  The state machine to write (assumed not null).
+//
+// @param filename
+//  The name of the file to write.
+//
+// @param error_policy
+//  The error policy to report errors to or null to silently swallow errors.
+//
+// @param key
+//  A string that identifies what the state machine was compiled from (e.g.
+//  the grammar) to store in the file or null to store no key.
+//
+// @return
+//  True if the file was written successfully otherwise false.
+*/
+bool ParserStateMachineFile::save( const ParserStateMachine* state_machine, const char* filename, ErrorPolicy* error_policy, const char* key )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( filename );
+
+    vector<char> image;
+    write( state_machine, &image, key );
+
+    FILE* file = fopen( filename, "wb" );
+    if ( !file )
+    {
+        fire_error( error_policy, PARSER_ERROR_OPENING_FILE_FAILED, "Opening '%s' to write failed - errno=%d", filename, errno );
+        return false;
+    }
+
+    size_t written = fwrite( &image[0], sizeof(char), image.size(), file );
+    int result = fclose( file );
+    if ( written != image.size() || result != 0 )
+    {
+        fire_error( error_policy, PARSER_ERROR_WRITING_FILE_FAILED, "Writing '%s' failed - errno=%d", filename, errno );
+        return false;
+    }
+    return true;
+}
+
+/**
+// Write a state machine into the format of a compiled state machine file.
+//
+// @param state_machine
+//  The state machine to write (assumed not null).
+//
+// @param image
+//  The vector to receive the contents of the file (assumed not null).
+//
+// @param key
+//  A string that identifies what the state machine was compiled from to 
+//  store in the file or null to store no key.
+*/
+void ParserStateMachineFile::write( const ParserStateMachine* state_machine, vector<char>* image, const char* key )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( image );
+
+    vector<int> ints( HEADER_INTS, 0 );
+    std::string strings;
+    ints[HEADER_MAGIC] = MAGIC;
+    ints[HEADER_VERSION] = VERSION;
+    ints[HEADER_IDENTIFIER] = write_string( state_machine->identifier, &strings );
+    ints[HEADER_KEY] = write_string( key, &strings );
+    ints[HEADER_ACTIONS_SIZE] = state_machine->actions_size;
+    ints[HEADER_SYMBOLS_SIZE] = state_machine->symbols_size;
+    ints[HEADER_TRANSITIONS_SIZE] = state_machine->transitions_size;
+    ints[HEADER_STATES_SIZE] = state_machine->states_size;
+
+    const ParserSymbol* symbols = state_machine->symbols;
+    const ParserState* states = state_machine->states;
+    const ParserTransition* transitions = state_machine->transitions;
+
+    ints[HEADER_ACTIONS] = int(ints.size());
+    for ( int i = 0; i < state_machine->actions_size; ++i )
+    {
+        const ParserAction* action = &state_machine->actions[i];
+        ints.push_back( action->index );
+        ints.push_back( write_string(action->identifier, &strings) );
+    }
+
+    ints[HEADER_SYMBOLS] = int(ints.size());
+    for ( int i = 0; i < state_machine->symbols_size; ++i )
+    {
+        const ParserSymbol* symbol = &symbols[i];
+        ints.push_back( symbol->index );
+        ints.push_back( write_string(symbol->identifier, &strings) );
+        ints.push_back( write_string(symbol->lexeme, &strings) );
+        ints.push_back( int(symbol->type) );
+    }
+
+    ints[HEADER_TRANSITIONS] = int(ints.size());
+    for ( int i = 0; i < state_machine->transitions_size; ++i )
+    {
+        const ParserTransition* transition = &transitions[i];
+        ints.push_back( index_of(transition->symbol, symbols) );
+        ints.push_back( index_of(transition->state, states) );
+        ints.push_back( index_of(transition->reduced_symbol, symbols) );
+        ints.push_back( transition->reduced_length );
+        ints.push_back( transition->precedence );
+        ints.push_back( transition->action );
+        ints.push_back( transition->production );
+        ints.push_back( int(transition->type) );
+        ints.push_back( transition->index );
+    }
+
+    ints[HEADER_STATES] = int(ints.size());
+    for ( int i = 0; i < state_machine->states_size; ++i )
+    {
+        const ParserState* state = &states[i];
+        ints.push_back( state->index );
+        ints.push_back( state->length );
+        ints.push_back( index_of(state->transitions, transitions) );
+        ints.push_back( index_of(state->default_reduction, transitions) );
+    }
+
+    ints[HEADER_START_SYMBOL] = index_of( state_machine->start_symbol, symbols );
+    ints[HEADER_END_SYMBOL] = index_of( state_machine->end_symbol, symbols );
+    ints[HEADER_ERROR_SYMBOL] = index_of( state_machine->error_symbol, symbols );
+    ints[HEADER_START_STATE] = index_of( state_machine->start_state, states );
+
+    int states_size = state_machine->states_size;
+    ints[HEADER_TRANSITION_TABLE] = write_ints( state_machine->transition_table, states_size * state_machine->symbols_size, &ints );
+    if ( state_machine->compressed_base )
+    {
+        int compressed_size = state_machine->compressed_size;
+        ints[HEADER_COMPRESSED_SIZE] = compressed_size;
+        ints[HEADER_COMPRESSED_BASE] = write_ints( state_machine->compressed_base, states_size, &ints );
+        ints[HEADER_COMPRESSED_CHECK] = write_ints( state_machine->compressed_check, compressed_size, &ints );
+        ints[HEADER_COMPRESSED_NEXT] = write_ints( state_machine->compressed_next, compressed_size, &ints );
+        ints[HEADER_DEFAULT_TRANSITIONS] = write_ints( state_machine->default_transitions, states_size, &ints );
+    }
+
+    if ( state_machine->lexer_state_machine )
+    {
+        ints[HEADER_LEXER] = int(ints.size());
+        write_lexer_state_machine( state_machine->lexer_state_machine, state_machine, &ints, &strings );
+    }
+
+    if ( state_machine->whitespace_lexer_state_machine )
+    {
+        ints[HEADER_WHITESPACE_LEXER] = int(ints.size());
+        write_lexer_state_machine( state_machine->whitespace_lexer_state_machine, state_machine, &ints, &strings );
+    }
+
+    ints[HEADER_STRINGS] = int(ints.size());
+    ints[HEADER_SIZE] = int(ints.size() * sizeof(int) + strings.size());
+
+    image->resize( ints.size() * sizeof(int) + strings.size() );
+    memcpy( &(*image)[0], &ints[0], ints.size() * sizeof(int) );
+    if ( !strings.empty() )
+    {
+        memcpy( &(*image)[ints.size() * sizeof(int)], &strings[0], strings.size() );
+    }
+}
+
+bool ParserStateMachineFile::read( const char* filename )
+{
+    LALR_ASSERT( filename );
+
+#if defined(_WIN32)
+    FILE* file = fopen( filename, "rb" );
+    if ( !file )
+    {
+        fire_error( error_policy_, PARSER_ERROR_OPENING_FILE_FAILED, "Opening '%s' to read failed - errno=%d", filename, errno );
+        return false;
+    }
+
+    fseek( file, 0, SEEK_END );
+    long size = ftell( file );
+    fseek( file, 0, SEEK_SET );
+    if ( size > 0 )
+    {
+        buffer_.reset( new int [(size + sizeof(int) - 1) / sizeof(int)] );
+    }
+    size_t read = size > 0 ? fread( buffer_.get(), sizeof(char), size_t(size), file ) : 0;
+    fclose( file );
+    if ( size <= 0 || read != size_t(size) )
+    {
+        fire_error( error_policy_, PARSER_ERROR_OPENING_FILE_FAILED, "Reading '%s' failed", filename );
+        buffer_.reset();
+        return false;
+    }
+    image_ = buffer_.get();
+    size_ = size_t(size);
+    mapped_ = false;
+#else
+    int file = open( filename, O_RDONLY );
+    if ( file < 0 )
+    {
+        fire_error( error_policy_, PARSER_ERROR_OPENING_FILE_FAILED, "Opening '%s' to read failed - errno=%d", filename, errno );
+        return false;
+    }
+
+    struct stat stat;
+    void* data = MAP_FAILED;
+    if ( fstat(file, &stat) == 0 && stat.st_size > 0 )
+    {
+        data = mmap( nullptr, size_t(stat.st_size), PROT_READ, MAP_SHARED, file, 0 );
+    }
+    close( file );
+    if ( data == MAP_FAILED )
+    {
+        fire_error( error_policy_, PARSER_ERROR_OPENING_FILE_FAILED, "Mapping '%s' failed - errno=%d", filename, errno );
+        return false;
+    }
+    image_ = static_cast<const int*>( data );
+    size_ = size_t(stat.st_size);
+    mapped_ = true;
+#endif
+
+    return true;
+}
+
+bool ParserStateMachineFile::populate()
+{
+    LALR_ASSERT( image_ );
+
+    if ( size_ < HEADER_INTS * sizeof(int) ||
+        image_[HEADER_MAGIC] != MAGIC ||
+        image_[HEADER_VERSION] != VERSION ||
+        size_t(image_[HEADER_SIZE]) != size_ ||
+        image_[HEADER_STRINGS] < HEADER_INTS ||
+        size_t(image_[HEADER_STRINGS]) * sizeof(int) > size_ )
+    {
+        return false;
+    }
+
+    // The strings section is a sequence of null terminated strings so it
+    // must be empty or end with a null terminator for every string offset
+    // that is in range to be safe to use.
+    const char* image_end = reinterpret_cast<const char*>( image_ ) + size_;
+    if ( size_t(image_[HEADER_STRINGS]) * sizeof(int) < size_ && image_end[-1] != 0 )
+    {
+        return false;
+    }
+
+    int actions_size = image_[HEADER_ACTIONS_SIZE];
+    int symbols_size = image_[HEADER_SYMBOLS_SIZE];
+    int transitions_size = image_[HEADER_TRANSITIONS_SIZE];
+    int states_size = image_[HEADER_STATES_SIZE];
+    const int* actions = section( image_[HEADER_ACTIONS], actions_size, ACTION_INTS );
+    const int* symbols = section( image_[HEADER_SYMBOLS], symbols_size, SYMBOL_INTS );
+    const int* transitions = section( image_[HEADER_TRANSITIONS], transitions_size, TRANSITION_INTS );
+    const int* states = section( image_[HEADER_STATES], states_size, STATE_INTS );
+    if ( actions_size < 0 || symbols_size < 0 || transitions_size < 0 || states_size <= 0 || !actions || !symbols || !transitions || !states )
+    {
+        return false;
+    }
+
+    bool valid = true;
+    actions_.reset( new ParserAction [actions_size] );
+    for ( int i = 0; i < actions_size; ++i, actions += ACTION_INTS )
+    {
+        ParserAction* action = &actions_[i];
+        action->index = actions[0];
+        action->identifier = find_string( actions[1] );
+        valid = valid && action->identifier;
+    }
+
+    symbols_.reset( new ParserSymbol [symbols_size] );
+    for ( int i = 0; i < symbols_size; ++i, symbols += SYMBOL_INTS )
+    {
+        ParserSymbol* symbol = &symbols_[i];
+        symbol->index = symbols[0];
+        symbol->identifier = find_string( symbols[1] );
+        symbol->lexeme = find_string( symbols[2] );
+        symbol->type = SymbolType( symbols[3] );
+        valid = valid && symbol->index == i && symbol->identifier && symbol->lexeme;
+    }
+
+    states_.reset( new ParserState [states_size] );
+    transitions_.reset( new ParserTransition [transitions_size] );
+    for ( int i = 0; i < transitions_size; ++i, transitions += TRANSITION_INTS )
+    {
+        ParserTransition* transition = &transitions_[i];
+        transition->symbol = element_at( transitions[0], symbols_.get(), symbols_size, &valid );
+        transition->state = element_at( transitions[1], states_.get(), states_size, &valid );
+        transition->reduced_symbol = element_at( transitions[2], symbols_.get(), symbols_size, &valid );
+        transition->reduced_length = transitions[3];
+        transition->precedence = transitions[4];
+        transition->action = transitions[5];
+        transition->production = transitions[6];
+        transition->type = TransitionType( transitions[7] );
+        transition->index = transitions[8];
+        valid = valid &&
+            transition->symbol &&
+            ((transition->type == TRANSITION_SHIFT && transition->state) || (transition->type == TRANSITION_REDUCE && transition->reduced_symbol && transition->reduced_length >= 0 && transition->production >= 0)) &&
+            transition->action >= -1 && transition->action < actions_size &&
+            transition->index == i
+        ;
+    }
+
+    for ( int i = 0; i < states_size; ++i, states += STATE_INTS )
+    {
+        ParserState* state = &states_[i];
+        state->index = states[0];
+        state->length = states[1];
+        state->transitions = transitions_at( states[2], state->length, transitions_.get(), transitions_size, &valid );
+        state->default_reduction = element_at( states[3], transitions_.get(), transitions_size, &valid );
+        valid = valid && state->index == i && (!state->default_reduction || state->default_reduction->type == TRANSITION_REDUCE);
+    }
+
+    if ( !valid )
+    {
+        return false;
+    }
+
+    ParserStateMachine* state_machine = &parser_state_machine_;
+    state_machine->identifier = find_string( image_[HEADER_IDENTIFIER] );
+    state_machine->actions_size = actions_size;
+    state_machine->symbols_size = symbols_size;
+    state_machine->transitions_size = transitions_size;
+    state_machine->states_size = states_size;
+    state_machine->actions = actions_.get();
+    state_machine->symbols = symbols_.get();
+    state_machine->transitions = transitions_.get();
+    state_machine->states = states_.get();
+    state_machine->start_symbol = element_at( image_[HEADER_START_SYMBOL], symbols_.get(), symbols_size, &valid );
+    state_machine->end_symbol = element_at( image_[HEADER_END_SYMBOL], symbols_.get(), symbols_size, &valid );
+    state_machine->error_symbol = element_at( image_[HEADER_ERROR_SYMBOL], symbols_.get(), symbols_size, &valid );
+    state_machine->start_state = element_at( image_[HEADER_START_STATE], states_.get(), states_size, &valid );
+    if ( !valid || !state_machine->identifier || !state_machine->start_state )
+    {
+        return false;
+    }
+
+    if ( image_[HEADER_TRANSITION_TABLE] != 0 )
+    {
+        state_machine->transition_table = section( image_[HEADER_TRANSITION_TABLE], states_size, symbols_size );
+        valid = valid && state_machine->transition_table && 
+            values_within( state_machine->transition_table, states_size * symbols_size, -1, transitions_size )
+        ;
+    }
+
+    if ( image_[HEADER_COMPRESSED_BASE] != 0 )
+    {
+        int compressed_size = image_[HEADER_COMPRESSED_SIZE];
+        state_machine->compressed_size = compressed_size;
+        state_machine->compressed_base = section( image_[HEADER_COMPRESSED_BASE], states_size );
+        state_machine->compressed_check = section( image_[HEADER_COMPRESSED_CHECK], compressed_size );
+        state_machine->compressed_next = section( image_[HEADER_COMPRESSED_NEXT], compressed_size );
+        state_machine->default_transitions = section( image_[HEADER_DEFAULT_TRANSITIONS], states_size );
+        // Entries are found at the base of each state offset by the index
+        // of the symbol and then checked against the size of the table so
+        // bases only need to be non-negative to keep lookups in range.
+        valid = valid && compressed_size >= 0 && 
+            state_machine->compressed_base && state_machine->compressed_check && state_machine->compressed_next && state_machine->default_transitions &&
+            values_within( state_machine->compressed_base, states_size, 0, compressed_size + 1 ) &&
+            values_within( state_machine->compressed_next, compressed_size, -1, transitions_size ) &&
+            values_within( state_machine->default_transitions, states_size, -1, transitions_size )
+        ;
+    }
+
+    if ( image_[HEADER_LEXER] != 0 )
+    {
+        valid = valid && populate_lexer_state_machine( image_[HEADER_LEXER], &lexer_ );
+        state_machine->lexer_state_machine = &lexer_.state_machine_;
+    }
+
+    if ( image_[HEADER_WHITESPACE_LEXER] != 0 )
+    {
+        valid = valid && populate_lexer_state_machine( image_[HEADER_WHITESPACE_LEXER], &whitespace_lexer_ );
+        state_machine->whitespace_lexer_state_machine = &whitespace_lexer_.state_machine_;
+    }
+
+    return valid;
+}
+
+bool ParserStateMachineFile::populate_lexer_state_machine( int offset, LexerAllocations* lexer )
+{
+    LALR_ASSERT( lexer );
+
+    const int* header = section( offset, LEXER_INTS );
+    if ( !header )
+    {
+        return false;
+    }
+
+    int actions_size = header[LEXER_ACTIONS_SIZE];
+    int transitions_size = header[LEXER_TRANSITIONS_SIZE];
+    int states_size = header[LEXER_STATES_SIZE];
+    int classes_size = header[LEXER_CLASSES_SIZE];
+    const int* actions = section( header[LEXER_ACTIONS], actions_size, LEXER_ACTION_INTS );
+    const int* transitions = section( header[LEXER_TRANSITIONS], transitions_size, LEXER_TRANSITION_INTS );
+    const int* states = section( header[LEXER_STATES], states_size, LEXER_STATE_INTS );
+    if ( actions_size < 0 || transitions_size < 0 || states_size <= 0 || classes_size < 0 || !actions || !transitions || !states )
+    {
+        return false;
+    }
+
+    // The whitespace symbol of a lexer that whitespace is fused into is 
+    // always written as the index one past the last symbol.
+    bool fused = header[LEXER_WHITESPACE_SYMBOL] != -1;
+    bool valid = !fused || header[LEXER_WHITESPACE_SYMBOL] == parser_state_machine_.symbols_size;
+    lexer->actions_.reset( new LexerAction [actions_size] );
+    for ( int i = 0; i < actions_size; ++i, actions += LEXER_ACTION_INTS )
+    {
+        LexerAction* action = &lexer->actions_[i];
+        action->index = actions[0];
+        action->identifier = find_string( actions[1] );
+        valid = valid && action->index == i && action->identifier;
+    }
+
+    lexer->states_.reset( new LexerState [states_size] );
+    lexer->transitions_.reset( new LexerTransition [transitions_size] );
+    for ( int i = 0; i < transitions_size; ++i, transitions += LEXER_TRANSITION_INTS )
+    {
+        LexerTransition* transition = &lexer->transitions_[i];
+        transition->begin = transitions[0];
+        transition->end = transitions[1];
+        transition->state = element_at( transitions[2], lexer->states_.get(), states_size, &valid );
+        transition->action = element_at( transitions[3], lexer->actions_.get(), actions_size, &valid );
+        valid = valid && transition->state;
+    }
+
+    for ( int i = 0; i < states_size; ++i, states += LEXER_STATE_INTS )
+    {
+        LexerState* state = &lexer->states_[i];
+        state->index = states[0];
+        state->length = states[1];
+        state->transitions = transitions_at( states[2], state->length, lexer->transitions_.get(), transitions_size, &valid );
+        state->symbol = symbol_at( states[3], symbols_.get(), parser_state_machine_.symbols_size, fused, &valid );
+        valid = valid && state->index == i;
+    }
+
+    LexerStateMachine* state_machine = &lexer->state_machine_;
+    state_machine->actions_size = actions_size;
+    state_machine->transitions_size = transitions_size;
+    state_machine->states_size = states_size;
+    state_machine->actions = lexer->actions_.get();
+    state_machine->transitions = lexer->transitions_.get();
+    state_machine->states = lexer->states_.get();
+    state_machine->start_state = element_at( header[LEXER_START_STATE], lexer->states_.get(), states_size, &valid );
+    state_machine->classes_size = classes_size;
+    state_machine->classes = nullptr;
+    state_machine->class_transitions = nullptr;
+    state_machine->loop_ranges = nullptr;
+    state_machine->whitespace_symbol = nullptr;
+    if ( fused )
+    {
+        state_machine->whitespace_symbol = symbols_.get() + parser_state_machine_.symbols_size;
+    }
+    if ( header[LEXER_CLASSES] != 0 )
+    {
+        state_machine->classes = section( header[LEXER_CLASSES], LEXER_CLASS_CHARACTERS );
+        state_machine->class_transitions = section( header[LEXER_CLASS_TRANSITIONS], states_size, classes_size );
+        valid = valid && state_machine->classes && state_machine->class_transitions &&
+            values_within( state_machine->classes, LEXER_CLASS_CHARACTERS, 0, classes_size ) &&
+            values_within( state_machine->class_transitions, states_size * classes_size, -1, transitions_size )
+        ;
+    }
+    if ( header[LEXER_LOOP_RANGES_OFFSET] != 0 )
+    {
+        state_machine->loop_ranges = section( header[LEXER_LOOP_RANGES_OFFSET], states_size, LEXER_LOOP_RANGES * 2 );
+        valid = valid && state_machine->loop_ranges &&
+            values_within( state_machine->loop_ranges, states_size * LEXER_LOOP_RANGES * 2, 0, LEXER_LOOP_CHARACTERS + 1 )
+        ;
+    }
+    return valid && state_machine->start_state;
+}
+
+/**
+// Get a section of ints in the loaded file.
+//
+// The size of the section is checked by dividing the ints remaining in the
+// file by \e width rather than multiplying \e count by \e width so that
+// corrupt counts can't overflow into a small size that passes the check
+// and counts are known to be in range before anything is allocated for 
+// them.
+//
+// @param offset
+//  The offset of the section in ints from the start of the file.
+//
+// @param count
+//  The number of entries in the section.
+//
+// @param width
+//  The number of ints in each entry.
+//
+// @return
+//  The section or null if the section isn't entirely within the ints at
+//  the start of the file.
+*/
+const int* ParserStateMachineFile::section( int offset, int count, int width ) const
+{
+    LALR_ASSERT( image_ );
+    LALR_ASSERT( width >= 0 );
+    int ints = image_[HEADER_STRINGS];
+    if ( offset < HEADER_INTS || count < 0 || offset > ints || (width > 0 && count > (ints - offset) / width) )
+    {
+        return nullptr;
+    }
+    return image_ + offset;
+}
+
+/**
+// Get a string in the loaded file.
+//
+// @param offset
+//  The offset of the string in bytes from the start of the strings section
+//  or -1 for a null string.
+//
+// @return
+//  The string or null if \e offset is -1 or outside of the strings section.
+*/
+const char* ParserStateMachineFile::find_string( int offset ) const
+{
+    LALR_ASSERT( image_ );
+    size_t strings_offset = size_t(image_[HEADER_STRINGS]) * sizeof(int);
+    if ( offset < 0 || size_t(offset) >= size_ - strings_offset )
+    {
+        return nullptr;
+    }
+    return reinterpret_cast<const char*>( image_ ) + strings_offset + offset;
+}
+
+void ParserStateMachineFile::fire_error( ErrorPolicy* error_policy, int error, const char* format, ... )
+{
+    if ( error_policy )
+    {
+        va_list args;
+        va_start( args, format );
+        error_policy->lalr_error( 0, error, format, args );
+        va_end( args );
+    }
+}
+
+void ParserStateMachineFile::write_lexer_state_machine( const LexerStateMachine* state_machine, const ParserStateMachine* parser_state_machine, vector<int>* image, std::string* strings )
+{
+    LALR_ASSERT( state_machine );
+    LALR_ASSERT( parser_state_machine );
+    LALR_ASSERT( image );
+    LALR_ASSERT( strings );
+
+    vector<int>& ints = *image;
+    int header = int(ints.size());
+    ints.resize( header + LEXER_INTS, 0 );
+    ints[header + LEXER_ACTIONS_SIZE] = state_machine->actions_size;
+    ints[header + LEXER_TRANSITIONS_SIZE] = state_machine->transitions_size;
+    ints[header + LEXER_STATES_SIZE] = state_machine->states_size;
+    ints[header + LEXER_START_STATE] = index_of( state_machine->start_state, state_machine->states );
+    ints[header + LEXER_CLASSES_SIZE] = state_machine->classes_size;
+    ints[header + LEXER_WHITESPACE_SYMBOL] = index_of( reinterpret_cast<const ParserSymbol*>(state_machine->whitespace_symbol), parser_state_machine->symbols );
+
+    ints[header + LEXER_ACTIONS] = int(ints.size());
+    for ( int i = 0; i < state_machine->actions_size; ++i )
+    {
+        const LexerAction* action = &state_machine->actions[i];
+        ints.push_back( action->index );
+        ints.push_back( write_string(action->identifier, strings) );
+    }
+
+    ints[header + LEXER_TRANSITIONS] = int(ints.size());
+    for ( int i = 0; i < state_machine->transitions_size; ++i )
+    {
+        const LexerTransition* transition = &state_machine->transitions[i];
+        ints.push_back( transition->begin );
+        ints.push_back( transition->end );
+        ints.push_back( index_of(transition->state, state_machine->states) );
+        ints.push_back( index_of(transition->action, state_machine->actions) );
+    }
+
+    // The symbols recognized by the lexers of a parser state machine are
+    // always the parser's symbols so they are written as indices into the
+    // parser's symbols (or one past the last symbol for the whitespace 
+    // symbol of a lexer that whitespace is fused into).
+    ints[header + LEXER_STATES] = int(ints.size());
+    for ( int i = 0; i < state_machine->states_size; ++i )
+    {
+        const LexerState* state = &state_machine->states[i];
+        const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( state->symbol );
+        ints.push_back( state->index );
+        ints.push_back( state->length );
+        ints.push_back( index_of(state->transitions, state_machine->transitions) );
+        ints.push_back( index_of(symbol, parser_state_machine->symbols) );
+    }
+
+    if ( state_machine->classes )
+    {
+        ints[header + LEXER_CLASSES] = write_ints( state_machine->classes, LEXER_CLASS_CHARACTERS, image );
+        ints[header + LEXER_CLASS_TRANSITIONS] = write_ints( state_machine->class_transitions, state_machine->states_size * state_machine->classes_size, image );
+    }
+    ints[header + LEXER_LOOP_RANGES_OFFSET] = write_ints( state_machine->loop_ranges, state_machine->states_size * LEXER_LOOP_RANGES * 2, image );
+}
+
+int ParserStateMachineFile::write_ints( const int* values, int size, vector<int>* image )
+{
+    LALR_ASSERT( image );
+    if ( !values )
+    {
+        return 0;
+    }
+    int offset = int(image->size());
+    image->insert( image->end(), values, values + size );
+    return offset;
+}
+
+int ParserStateMachineFile::write_string( const char* value, std::string* strings )
+{
+    LALR_ASSERT( strings );
+    if ( !value )
+    {
+        return -1;
+    }
+    int offset = int(strings->size());
+    strings->append( value );
+    strings->push_back( 0 );
+    return offset;
+}
@@ -0,0 +1,97 @@
+#ifndef LALR_PARSERSTATEMACHINEFILE_HPP_INCLUDED
+#define LALR_PARSERSTATEMACHINEFILE_HPP_INCLUDED
+
+#include "ParserStateMachine.hpp"
+#include "LexerStateMachine.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdarg.h>
+#include <stddef.h>
+
+namespace lalr
+{
+
+class ErrorPolicy;
+class ParserAction;
+class ParserSymbol;
+class ParserTransition;
+class ParserState;
+class LexerAction;
+class LexerTransition;
+class LexerState;
+
+/**
+// A compiled parser state machine stored in a relocatable binary file.
+//
+// The file refers to states, symbols, actions, and transitions by index
+// and to strings by offset rather than by pointer so that it can be written
+// once (e.g. by *lalrc*) and loaded by mapping it into memory.  The dense
+// and compressed transition tables, character class tables, and strings
+// are used in place from the mapped file and are shared between processes
+// that load the same file; only the small arrays of states, symbols,
+// actions, and transitions are rebuilt with pointers when the file is
+// loaded.
+//
+// Files are written in native byte order with native sized ints and are
+// only loadable by the version of the library that wrote them.
+//
+// Loading checks that every reference in the file, including each entry in
+// the transition and character class tables, is within the table that it 
+// refers to so that a corrupt or stale file is rejected rather than read 
+// out of bounds.  Files aren't checked to describe a parser that a grammar
+// could generate (e.g. reduction lengths are trusted) so only load files
+// from trusted sources.
+*/
+class ParserStateMachineFile
+{
+public:
+    static const int VERSION = 6; ///< The version of the file format written and loaded by this library.
+
+private:
+    struct LexerAllocations
+    {
+        std::unique_ptr<LexerAction[]> actions_; ///< The actions for this lexer.
+        std::unique_ptr<LexerTransition[]> transitions_; ///< The transitions for this lexer.
+        std::unique_ptr<LexerState[]> states_; ///< The states for this lexer.
+        LexerStateMachine state_machine_; ///< The state machine for this lexer.
+    };
+
+    const int* image_; ///< The loaded file or null if no file is loaded.
+    size_t size_; ///< The size of the loaded file in bytes.
+    bool mapped_; ///< True if the loaded file is mapped into memory otherwise false.
+    std::unique_ptr<int[]> buffer_; ///< The loaded file when it has been read into memory rather than mapped.
+    std::unique_ptr<ParserAction[]> actions_; ///< The parser actions for the loaded state machine.
+    std::unique_ptr<ParserSymbol[]> symbols_; ///< The symbols for the loaded state machine.
+    std::unique_ptr<ParserTransition[]> transitions_; ///< The transitions for the loaded state machine.
+    std::unique_ptr<ParserState[]> states_; ///< The states for the loaded state machine.
+    LexerAllocations lexer_; ///< The lexer for the loaded state machine.
+    LexerAllocations whitespace_lexer_; ///< The whitespace lexer for the loaded state machine.
+    ParserStateMachine parser_state_machine_; ///< The loaded state machine.
+    ErrorPolicy* error_policy_; ///< The error policy to report errors to or null to silently swallow errors.
+
+    public:
+        ParserStateMachineFile();
+        ~ParserStateMachineFile();
+        const ParserStateMachine* parser_state_machine() const;
+        const char* key() const;
+        bool load( const char* filename, ErrorPolicy* error_policy = nullptr );
+        void unload();
+        static bool save( const ParserStateMachine* state_machine, const char* filename, ErrorPolicy* error_policy = nullptr, const char* key = nullptr );
+        static void write( const ParserStateMachine* state_machine, std::vector<char>* image, const char* key = nullptr );
+
+    private:
+        bool read( const char* filename );
+        bool populate();
+        bool populate_lexer_state_machine( int offset, LexerAllocations* lexer );
+        const int* section( int offset, int count, int width = 1 ) const;
+        const char* find_string( int offset ) const;
+        static void fire_error( ErrorPolicy* error_policy, int error, const char* format, ... );
+        static void write_lexer_state_machine( const LexerStateMachine* state_machine, const ParserStateMachine* parser_state_machine, std::vector<int>* image, std::string* strings );
+        static int write_ints( const int* values, int size, std::vector<int>* image );
+        static int write_string( const char* value, std::string* strings );
+};
+
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef LALR_PARSERTREE_HPP_INCLUDED
+#define LALR_PARSERTREE_HPP_INCLUDED
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace lalr
+{
+
+class ParserArena;
+class ParserSymbol;
+template <class UserData, class Char, class Traits, class Allocator> class ParserNode;
+
+/**
+// A node in a parse tree allocated from a ParserArena.
+//
+// Using `const ParserTree<Char, Traits>*` as the user data of a Parser 
+// builds a parse tree without any action handlers.  Nodes, the arrays of
+// pointers to their children, and lexemes that can't refer directly to the
+// input are all allocated from an arena owned by the Parser that is 
+// released in one shot when the Parser is reset.  The tree is valid until 
+// the next parse (and, for lexemes that are spans of the input, for as long 
+// as the input is).
+*/
+template <class Char, class Traits = typename std::char_traits<Char> >
+class ParserTree
+{
+    const ParserSymbol* symbol_; ///< The symbol at this node.
+    std::basic_string_view<Char, Traits> lexeme_; ///< The lexeme at this node (empty if this node's symbol is a non-terminal).
+    const ParserTree* const* children_; ///< The children of this node.
+    int size_; ///< The number of children of this node.
+
+    public:
+        ParserTree( const ParserSymbol* symbol, std::basic_string_view<Char, Traits> lexeme, const ParserTree* const* children, int size );
+        const ParserSymbol* symbol() const;
+        std::basic_string_view<Char, Traits> lexeme() const;
+        int size() const;
+        const ParserTree* child( int index ) const;
+        const ParserTree* const* begin() const;
+        const ParserTree* const* end() const;
+
+        template <class UserData, class Allocator> 
+        static const ParserTree* create( ParserArena* arena, const ParserSymbol* symbol, const ParserNode<UserData, Char, Traits, Allocator>* start, const ParserNode<UserData, Char, Traits, Allocator>* finish );
+
+        template <class UserData, class Allocator> 
+        static const ParserTree* create( ParserArena* arena, const ParserNode<UserData, Char, Traits, Allocator>* node );
+};
+
+}
+
+#endif
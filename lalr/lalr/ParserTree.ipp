@@ -0,0 +1,191 @@
+#ifndef LALR_PARSERTREE_IPP_INCLUDED
+#define LALR_PARSERTREE_IPP_INCLUDED
+
+#include "ParserTree.hpp"
+#include "ParserNode.hpp"
+#include "ParserArena.hpp"
+#include "assert.hpp"
+#include <new>
+#include <type_traits>
+
+namespace lalr
+{
+
+/**
+// Constructor.
+//
+// @param symbol
+//  The symbol at this node (assumed not null).
+//
+// @param lexeme
+//  The lexeme at this node (assumed to remain valid for the lifetime of 
+//  this node).
+//
+// @param children
+//  The children of this node (assumed to remain valid for the lifetime of 
+//  this node).
+//
+// @param size
+//  The number of children of this node.
+*/
+template <class Char, class Traits>
+ParserTree<Char, Traits>::ParserTree( const ParserSymbol* symbol, std::basic_string_view<Char, Traits> lexeme, const ParserTree* const* children, int size )
+: symbol_( symbol ),
+  lexeme_( lexeme ),
+  children_( children ),
+  size_( size )
+{
+    LALR_ASSERT( symbol_ );
+    LALR_ASSERT( children_ || size_ == 0 );
+}
+
+/**
+// Get the symbol at this node.
+//
+// @return
+//  The symbol.
+*/
+template <class Char, class Traits>
+const ParserSymbol* ParserTree<Char, Traits>::symbol() const
+{
+    return symbol_;
+}
+
+/**
+// Get the lexeme at this node.
+//
+// @return
+//  The lexeme.
+*/
+template <class Char, class Traits>
+std::basic_string_view<Char, Traits> ParserTree<Char, Traits>::lexeme() const
+{
+    return lexeme_;
+}
+
+/**
+// Get the number of children of this node.
+//
+// @return
+//  The number of children.
+*/
+template <class Char, class Traits>
+int ParserTree<Char, Traits>::size() const
+{
+    return size_;
+}
+
+/**
+// Get a child of this node.
+//
+// @param index
+//  The index of the child to get (assumed to be within [0, size())).
+//
+// @return
+//  The child.
+*/
+template <class Char, class Traits>
+const ParserTree<Char, Traits>* ParserTree<Char, Traits>::child( int index ) const
+{
+    LALR_ASSERT( index >= 0 && index < size_ );
+    return children_[index];
+}
+
+/**
+// Get an iterator to the first child of this node.
+//
+// @return
+//  The iterator.
+*/
+template <class Char, class Traits>
+const ParserTree<Char, Traits>* const* ParserTree<Char, Traits>::begin() const
+{
+    return children_;
+}
+
+/**
+// Get an iterator to one past the last child of this node.
+//
+// @return
+//  The iterator.
+*/
+template <class Char, class Traits>
+const ParserTree<Char, Traits>* const* ParserTree<Char, Traits>::end() const
+{
+    return children_ + size_;
+}
+
+/**
+// Create an interior node from the nodes being reduced on a parser's stack.
+//
+// Nodes being reduced that don't already have a tree (terminals) are given
+// leaf nodes.
+//
+// @param arena
+//  The arena to allocate the node and its children from (assumed not null).
+//
+// @param symbol
+//  The symbol being reduced to.
+//
+// @param start
+//  The first node being reduced.
+//
+// @param finish
+//  One past the last node being reduced.
+//
+// @return
+//  The created node.
+*/
+template <class Char, class Traits>
+template <class UserData, class Allocator>
+const ParserTree<Char, Traits>* ParserTree<Char, Traits>::create( ParserArena* arena, const ParserSymbol* symbol, const ParserNode<UserData, Char, Traits, Allocator>* start, const ParserNode<UserData, Char, Traits, Allocator>* finish )
+{
+    static_assert( std::is_trivially_destructible<ParserTree>::value, "ParserTree must be trivially destructible to be allocated from a ParserArena" );
+    LALR_ASSERT( arena );
+    LALR_ASSERT( start <= finish );
+
+    int size = int(finish - start);
+    const ParserTree** children = size > 0 ? arena->allocate<const ParserTree*>( size ) : nullptr;
+    for ( int i = 0; i < size; ++i )
+    {
+        const ParserNode<UserData, Char, Traits, Allocator>* node = start + i;
+        children[i] = node->user_data() ? node->user_data() : create( arena, node );
+    }
+    return new (arena->allocate<ParserTree>(1)) ParserTree( symbol, std::basic_string_view<Char, Traits>(), children, size );
+}
+
+/**
+// Create a leaf node from a node on a parser's stack.
+//
+// The leaf refers directly to the node's lexeme when it is a span of the 
+// input otherwise the lexeme is copied into \e arena.
+//
+// @param arena
+//  The arena to allocate the node and its lexeme from (assumed not null).
+//
+// @param node
+//  The node to create a leaf for.
+//
+// @return
+//  The created node.
+*/
+template <class Char, class Traits>
+template <class UserData, class Allocator>
+const ParserTree<Char, Traits>* ParserTree<Char, Traits>::create( ParserArena* arena, const ParserNode<UserData, Char, Traits, Allocator>* node )
+{
+    LALR_ASSERT( arena );
+    LALR_ASSERT( node );
+
+    std::basic_string_view<Char, Traits> lexeme = node->lexeme();
+    if ( !node->spanned() && !lexeme.empty() )
+    {
+        Char* characters = arena->allocate<Char>( lexeme.size() );
+        Traits::copy( characters, lexeme.data(), lexeme.size() );
+        lexeme = std::basic_string_view<Char, Traits>( characters, lexeme.size() );
+    }
+    return new (arena->allocate<ParserTree>(1)) ParserTree( node->symbol(), lexeme, nullptr, 0 );
+}
+
+}
+
+#endif
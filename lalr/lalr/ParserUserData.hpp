@@ -27,6 +27,7 @@ class ParserUserData
         ParserUserData( const ParserSymbol* symbol, const std::basic_string<Char, Traits, Allocator>& lexeme );  
         ParserUserData( const ParserSymbol* symbol, size_t user_datas );
         ParserUserData( const ParserSymbol* symbol, const ParserNode* start, const ParserNode* finish );
+        ParserUserData( const ParserSymbol* symbol, ParserNode* start, ParserNode* finish );
         const ParserSymbol* symbol() const;
         const std::basic_string<Char, Traits, Allocator>& lexeme() const;        
         void append_user_data( std::shared_ptr<ParserUserData> user_data );
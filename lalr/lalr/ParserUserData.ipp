@@ -76,12 +76,53 @@ ParserUserData<Char, Traits, Allocator>::ParserUserData( const ParserSymbol* sym
         }
         else
         {
-            std::shared_ptr<ParserUserData<char> > user_data( new ParserUserData(node->symbol(), node->lexeme()) );
+            std::shared_ptr<ParserUserData<char> > user_data( new ParserUserData(node->symbol(), std::basic_string<Char, Traits, Allocator>(node->lexeme())) );
             user_datas_.push_back( user_data );
         }
     }
 }
 
+/**
+// Constructor.
+//
+// Moves user data out of the nodes being reduced rather than copying it so
+// that children are taken without touching their reference counts.
+//
+// @param symbol
+//  The symbol at this user data.
+//
+// @param start
+//  The first node to take user data from to add as a child of this user data.
+//
+// @param finish
+//  One past the last node to take user data from to add as a child of this 
+//  user data.
+*/
+template <class Char, class Traits, class Allocator>
+ParserUserData<Char, Traits, Allocator>::ParserUserData( const ParserSymbol* symbol, ParserNode* start, ParserNode* finish )
+: symbol_( symbol ),
+  lexeme_(),
+  user_datas_()
+{
+    LALR_ASSERT( start );
+    LALR_ASSERT( finish );
+    LALR_ASSERT( start <= finish );
+    LALR_ASSERT( symbol_ );
+    
+    user_datas_.reserve( finish - start );
+    for ( ParserNode* node = start; node != finish; ++node )
+    {
+        if ( node->user_data() )
+        {
+            user_datas_.push_back( std::move(node->user_data()) );
+        }
+        else
+        {
+            user_datas_.push_back( std::make_shared<ParserUserData>(node->symbol(), std::basic_string<Char, Traits, Allocator>(node->lexeme())) );
+        }
+    }
+}
+
 /**
 // Get the symbol at this user data.
 //
@@ -93,6 +93,12 @@ class PositionIterator
         }
         
         
+        const Iterator& base() const
+        {
+            return position_;
+        }
+        
+        
         bool operator!=( const PositionIterator& iterator ) const
         {
             return ended_ || iterator.ended_ ? ended_ != iterator.ended_ : position_ != iterator.position_;
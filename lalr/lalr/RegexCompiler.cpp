@@ -9,9 +9,14 @@
 #include "LexerTransition.hpp"
 #include "LexerAction.hpp"
 #include "assert.hpp"
+#include <map>
+#include <algorithm>
 
 using std::set;
+using std::map;
 using std::vector;
+using std::min;
+using std::max;
 using std::unique_ptr;
 using namespace lalr;
 
@@ -20,6 +25,9 @@ RegexCompiler::RegexCompiler()
   actions_(),
   transitions_(),
   states_(),
+  classes_(),
+  class_transitions_(),
+  loop_ranges_(),
   state_machine_() 
 {
     state_machine_.reset( new LexerStateMachine );
@@ -35,7 +43,7 @@ const LexerStateMachine* RegexCompiler::state_machine() const
     return state_machine_.get();
 }
 
-void RegexCompiler::compile( const std::string& regular_expression, void* symbol, ErrorPolicy* error_policy )
+int RegexCompiler::compile( const std::string& regular_expression, void* symbol, ErrorPolicy* error_policy )
 {
     RegexGenerator generator;
     int errors = generator.generate( regular_expression, symbol, error_policy );
@@ -43,9 +51,10 @@ void RegexCompiler::compile( const std::string& regular_expression, void* symbol
     {
         populate_lexer_state_machine( generator );
     }
+    return errors;
 }
 
-void RegexCompiler::compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy )
+int RegexCompiler::compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy )
 {
     RegexGenerator generator;
     int errors = generator.generate( tokens, error_policy );
@@ -53,6 +62,7 @@ void RegexCompiler::compile( const std::vector<RegexToken>& tokens, ErrorPolicy*
     {
         populate_lexer_state_machine( generator );
     }
+    return errors;
 }
 
 const char* RegexCompiler::add_string( const std::string& string )
@@ -83,10 +93,42 @@ void RegexCompiler::set_states( std::unique_ptr<LexerState[]>& states, int state
     state_machine_->start_state = start_state;
 }
 
+void RegexCompiler::set_classes( std::unique_ptr<int[]>& classes, int classes_size, std::unique_ptr<int[]>& class_transitions )
+{
+    classes_ = move( classes );
+    class_transitions_ = move( class_transitions );
+    state_machine_->classes_size = classes_size;
+    state_machine_->classes = classes_.get();
+    state_machine_->class_transitions = class_transitions_.get();
+}
+
+void RegexCompiler::set_loop_ranges( std::unique_ptr<int[]>& loop_ranges )
+{
+    loop_ranges_ = move( loop_ranges );
+    state_machine_->loop_ranges = loop_ranges_.get();
+}
+
+/**
+// Set the symbol that whitespace tokens compiled into this state machine
+// match.
+//
+// A Lexer skips over input that matches \e whitespace_symbol in the same
+// way that it skips over input matched by a separate whitespace state 
+// machine rather than returning it as a token.
+//
+// @param whitespace_symbol
+//  The symbol of the whitespace tokens or null if this state machine 
+//  doesn't match whitespace.
+*/
+void RegexCompiler::set_whitespace_symbol( const void* whitespace_symbol )
+{
+    state_machine_->whitespace_symbol = whitespace_symbol;
+}
+
 void RegexCompiler::populate_lexer_state_machine( const RegexGenerator& generator )
 {
     const vector<unique_ptr<RegexAction>>& source_actions = generator.actions();
-    const set<unique_ptr<RegexState>, RegexStateLess>& source_states = generator.states();
+    const vector<unique_ptr<RegexState>>& source_states = generator.states();
 
     size_t transitions_size = 0;
     for ( auto i = source_states.begin(); i != source_states.end(); ++i )
@@ -146,4 +188,128 @@ void RegexCompiler::populate_lexer_state_machine( const RegexGenerator& generato
     set_actions( actions, int(source_actions.size()) );
     set_transitions( transitions, int(transitions_size) );
     set_states( states, int(source_states.size()), start_state );
+    populate_class_transitions();
+    populate_loop_ranges();
+}
+
+/**
+// Populate the character classes and dense transition table for the 
+// characters in [0, LEXER_CLASS_CHARACTERS).
+//
+// Characters are grouped into the same class when every state transitions 
+// to the same state, with the same action, on each of them.  Each state 
+// then has one row in the dense table that stores the index of the 
+// transition taken on each class (or -1 if there is no transition).
+*/
+void RegexCompiler::populate_class_transitions()
+{
+    LALR_ASSERT( state_machine_ );
+    const int states_size = state_machine_->states_size;
+    const LexerTransition* transitions = state_machine_->transitions;
+
+    // Find the transition taken from each state on each character.
+    vector<int> character_transitions( LEXER_CLASS_CHARACTERS * states_size, -1 );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const LexerState* state = &state_machine_->states[i];
+        for ( int j = 0; j < state->length; ++j )
+        {
+            const LexerTransition* transition = &state->transitions[j];
+            int begin = max( transition->begin, 0 );
+            int end = min( transition->end, LEXER_CLASS_CHARACTERS );
+            for ( int character = begin; character < end; ++character )
+            {
+                character_transitions[character * states_size + state->index] = int(transition - transitions);
+            }
+        }
+    }
+
+    // Group characters with the same destination states and actions from 
+    // every state into classes, remembering the first character in each 
+    // class to fill in the dense table from.
+    unique_ptr<int[]> classes( new int [LEXER_CLASS_CHARACTERS] );
+    vector<int> class_characters;
+    map<vector<int>, int> classes_by_destinations;
+    vector<int> destinations( 2 * states_size );
+    for ( int character = 0; character < LEXER_CLASS_CHARACTERS; ++character )
+    {
+        for ( int i = 0; i < states_size; ++i )
+        {
+            int index = character_transitions[character * states_size + i];
+            const LexerTransition* transition = index >= 0 ? &transitions[index] : nullptr;
+            destinations[2 * i] = transition ? transition->state->index : -1;
+            destinations[2 * i + 1] = transition && transition->action ? transition->action->index : -1;
+        }
+        auto inserted = classes_by_destinations.insert( make_pair(destinations, int(class_characters.size())) );
+        if ( inserted.second )
+        {
+            class_characters.push_back( character );
+        }
+        classes[character] = inserted.first->second;
+    }
+
+    int classes_size = int(class_characters.size());
+    unique_ptr<int[]> class_transitions( new int [states_size * classes_size] );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        for ( int j = 0; j < classes_size; ++j )
+        {
+            class_transitions[i * classes_size + j] = character_transitions[class_characters[j] * states_size + i];
+        }
+    }
+
+    set_classes( classes, classes_size, class_transitions );
+}
+
+/**
+// Populate the ranges of characters in [0, LEXER_LOOP_CHARACTERS) that each
+// state transitions back to itself on without taking an action.
+//
+// A Lexer consumes runs of these characters in bulk (e.g. runs of 
+// whitespace and the bodies of identifiers, numbers, and strings) rather 
+// than making one transition per character.  Only the first 
+// LEXER_LOOP_RANGES ranges of each state are kept; characters in any other
+// ranges are still matched one at a time.
+*/
+void RegexCompiler::populate_loop_ranges()
+{
+    LALR_ASSERT( state_machine_ );
+    const int states_size = state_machine_->states_size;
+    const int RANGE_INTS = 2 * LEXER_LOOP_RANGES;
+    unique_ptr<int[]> loop_ranges( new int [states_size * RANGE_INTS] );
+    std::fill( loop_ranges.get(), loop_ranges.get() + states_size * RANGE_INTS, 0 );
+
+    bool loops = false;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const LexerState* state = &state_machine_->states[i];
+        int* ranges = &loop_ranges[state->index * RANGE_INTS];
+        int ranges_size = 0;
+        for ( int j = 0; j < state->length; ++j )
+        {
+            const LexerTransition* transition = &state->transitions[j];
+            int begin = max( transition->begin, 0 );
+            int end = min( transition->end, LEXER_LOOP_CHARACTERS );
+            if ( transition->state == state && !transition->action && begin < end )
+            {
+                if ( ranges_size > 0 && ranges[2 * ranges_size - 1] == begin )
+                {
+                    ranges[2 * ranges_size - 1] = end;
+                }
+                else if ( ranges_size < LEXER_LOOP_RANGES )
+                {
+                    ranges[2 * ranges_size] = begin;
+                    ranges[2 * ranges_size + 1] = end;
+                    ++ranges_size;
+                }
+            }
+        }
+        loops = loops || ranges_size > 0;
+    }
+
+    if ( !loops )
+    {
+        loop_ranges.reset();
+    }
+    set_loop_ranges( loop_ranges );
 }
@@ -26,19 +26,27 @@ class RegexCompiler
     std::unique_ptr<LexerAction[]> actions_;
     std::unique_ptr<LexerTransition[]> transitions_;
     std::unique_ptr<LexerState[]> states_;
+    std::unique_ptr<int[]> classes_;
+    std::unique_ptr<int[]> class_transitions_;
+    std::unique_ptr<int[]> loop_ranges_;
     std::unique_ptr<LexerStateMachine> state_machine_; 
 
 public:
     RegexCompiler();
     ~RegexCompiler();
     const LexerStateMachine* state_machine() const;
-    void compile( const std::string& regular_expression, void* symbol, ErrorPolicy* error_policy = nullptr );
-    void compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy = nullptr );
+    int compile( const std::string& regular_expression, void* symbol, ErrorPolicy* error_policy = nullptr );
+    int compile( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy = nullptr );
     const char* add_string( const std::string& string );
     void set_actions( std::unique_ptr<LexerAction[]>& actions, int actions_size );
     void set_transitions( std::unique_ptr<LexerTransition[]>& transitions, int transitions_size );
     void set_states( std::unique_ptr<LexerState[]>& states, int states_size, const LexerState* start_state );
+    void set_classes( std::unique_ptr<int[]>& classes, int classes_size, std::unique_ptr<int[]>& class_transitions );
+    void set_loop_ranges( std::unique_ptr<int[]>& loop_ranges );
+    void set_whitespace_symbol( const void* whitespace_symbol );
     void populate_lexer_state_machine( const RegexGenerator& generator );
+    void populate_class_transitions();
+    void populate_loop_ranges();
 };
 
 }
@@ -12,17 +12,24 @@
 #include "LexerAction.hpp"
 #include "RegexItem.hpp"
 #include "RegexState.hpp"
+#include "RegexStateHash.hpp"
+#include "RegexStateEqual.hpp"
 #include "RegexAction.hpp"
 #include "RegexNode.hpp"
+#include "RegexNodeSet.hpp"
 #include "RegexSyntaxTree.hpp"
 #include "RegexParser.hpp"
 #include "ErrorPolicy.hpp"
 #include "assert.hpp"
+#include <unordered_set>
+#include <unordered_map>
+#include <algorithm>
 #include <limits.h>
 
 using std::set;
 using std::pair;
 using std::vector;
+using std::unordered_set;
 using std::make_pair;
 using std::unique_ptr;
 using namespace lalr;
@@ -48,7 +55,7 @@ const std::vector<std::unique_ptr<RegexAction>>& RegexGenerator::actions() const
     return actions_;
 }
 
-const std::set<std::unique_ptr<RegexState>, RegexStateLess>& RegexGenerator::states() const
+const std::vector<std::unique_ptr<RegexState>>& RegexGenerator::states() const
 {
     return states_;
 }
@@ -151,8 +158,32 @@ int RegexGenerator::generate( const std::vector<RegexToken>& tokens, ErrorPolicy
     states_.clear();
     start_state_ = nullptr;
     ranges_.clear();
+
+    // Literals are matched by a trie that is merged with the states 
+    // generated for the regular expressions rather than being added to the
+    // syntax tree as a concatenation of single character positions.
+    vector<RegexToken> regular_expressions;
+    vector<const RegexToken*> literals;
+    for ( vector<RegexToken>::const_iterator token = tokens.begin(); token != tokens.end(); ++token )
+    {
+        if ( token->type() == TOKEN_LITERAL )
+        {
+            literals.push_back( &(*token) );
+        }
+        else
+        {
+            regular_expressions.push_back( *token );
+        }
+    }
  
-    generate_states( RegexSyntaxTree(tokens, this), &states_, &start_state_ );
+    RegexSyntaxTree syntax_tree( regular_expressions, this );
+    generate_states( syntax_tree, &states_, &start_state_ );
+    if ( !literals.empty() && syntax_tree.errors() == 0 )
+    {
+        generate_literal_states( literals, &states_, &start_state_ );
+    }
+    minimize_states( &states_ );
+    generate_indices_for_states();
     error_policy_ = nullptr;
     return 0;
 }
@@ -167,6 +198,8 @@ int RegexGenerator::generate( const std::string& regular_expression, void* symbo
 
     RegexToken token( TOKEN_REGULAR_EXPRESSION, 0, symbol, regular_expression );
     generate_states( RegexSyntaxTree(token, this), &states_, &start_state_ );
+    minimize_states( &states_ );
+    generate_indices_for_states();
     error_policy_ = nullptr;
     return 0;
 }
@@ -184,10 +217,13 @@ int RegexGenerator::generate( const std::string& regular_expression, void* symbo
 // @param end
 //  The end character in the range to accept to generate the goto state.
 //
+// @param syntax_tree
+//  The syntax tree that the nodes in the items of \e state belong to.
+//
 // @return
 //  The state generated when accepting [\e begin, \e end) from \e state.
 */
-std::unique_ptr<RegexState> RegexGenerator::goto_( const RegexState* state, int begin, int end )
+std::unique_ptr<RegexState> RegexGenerator::goto_( const RegexState* state, int begin, int end, const RegexSyntaxTree& syntax_tree )
 {
     LALR_ASSERT( state );
     LALR_ASSERT( begin != INVALID_BEGIN_CHARACTER && begin != INVALID_END_CHARACTER );
@@ -197,7 +233,7 @@ std::unique_ptr<RegexState> RegexGenerator::goto_( const RegexState* state, int
     const std::set<RegexItem>& items = state->get_items();
     for ( std::set<RegexItem>::const_iterator item = items.begin(); item != items.end(); ++item )
     {
-        std::set<RegexNode*, RegexNodeLess> next_nodes = item->next_nodes( begin, end );
+        RegexNodeSet next_nodes = item->next_nodes( begin, end, syntax_tree );
         if ( !next_nodes.empty() )
         {
             goto_state->add_item( next_nodes );
@@ -209,19 +245,23 @@ std::unique_ptr<RegexState> RegexGenerator::goto_( const RegexState* state, int
 /**
 // Generate the states for a LexerStateMachine from \e syntax_tree.
 //
+// States are appended in the order that they are first reached and 
+// processed in that same order so that each state's transitions are 
+// generated exactly once.  Existing states are found by hashing their items.
+//
 // @param syntax_tree
 //  The RegexSyntaxTree to get the RegexNodes from that are then used to generate 
 //  states.
 //
 // @param states
-//  The set of states to populate from the output of the RegexSyntaxTree (assumed
+//  The states to populate from the output of the RegexSyntaxTree (assumed
 //  not null).
 //
 // @param start_state
 //  A variable to receive the starting state for the lexical analyzer
 //  (assumed not null).
 */
-void RegexGenerator::generate_states( const RegexSyntaxTree& syntax_tree, std::set<std::unique_ptr<RegexState>, RegexStateLess>* states, const RegexState** start_state )
+void RegexGenerator::generate_states( const RegexSyntaxTree& syntax_tree, std::vector<std::unique_ptr<RegexState>>* states, const RegexState** start_state )
 {
     LALR_ASSERT( states );
     LALR_ASSERT( states->empty() );
@@ -232,80 +272,460 @@ void RegexGenerator::generate_states( const RegexSyntaxTree& syntax_tree, std::s
     {
         std::unique_ptr<RegexState> state( new RegexState() );    
         state->add_item( syntax_tree.node()->get_first_positions() );
-        generate_symbol_for_state( state.get() );
+        generate_symbol_for_state( state.get(), syntax_tree );
         *start_state = state.get();
-        states->insert( move(state) );
 
-        int added = 1;
-        while ( added > 0 )
+        unordered_set<RegexState*, RegexStateHash, RegexStateEqual> existing_states;
+        existing_states.insert( state.get() );
+        states->push_back( move(state) );
+
+        for ( size_t index = 0; index < states->size(); ++index )
         {
-            added = 0;
-            for ( std::set<std::unique_ptr<RegexState>, RegexStateLess>::const_iterator i = states->begin(); i != states->end(); ++i )
+            RegexState* state = (*states)[index].get();
+            LALR_ASSERT( state );
+
+            // Create the distinct ranges of characters that can be 
+            // transitioned on from the current state.
+            clear();                
+            const std::set<RegexItem>& items = state->get_items();
+            for ( std::set<RegexItem>::const_iterator item = items.begin(); item != items.end(); ++item )
             {
-                RegexState* state = i->get();
-                LALR_ASSERT( state );
+                const RegexNodeSet& next_nodes = item->next_nodes();
+                for ( int j = next_nodes.next(0); j != RegexNodeSet::INVALID_INDEX; j = next_nodes.next(j + 1) )
+                {
+                    const RegexNode* next_node = syntax_tree.node_by_index( j );
+                    LALR_ASSERT( next_node );
+                    if ( !next_node->is_end() )
+                    {
+                        insert( next_node->get_begin_character(), next_node->get_end_character() );
+                    }
+                }
+            }
+            
+            // Create a goto state and a transition from the current 
+            // state for each distinct range.
+            vector<pair<int, bool> >::const_iterator j = ranges_.begin();
+            while ( j != ranges_.end() )
+            {               
+                int begin = (j + 0)->first;
+                int end = (j + 1)->first;
+                LALR_ASSERT( begin < end );
+                
+                std::unique_ptr<RegexState> goto_state = goto_( state, begin, end, syntax_tree );
+                if ( !goto_state->get_items().empty() )
+                {
+                    auto existing_goto_state = existing_states.find( goto_state.get() );
+                    if ( existing_goto_state == existing_states.end() )
+                    {
+                        state->add_transition( begin, end, goto_state.get(), syntax_tree );
+                        generate_symbol_for_state( goto_state.get(), syntax_tree );
+                        existing_states.insert( goto_state.get() );
+                        states->push_back( move(goto_state) );
+                    }
+                    else
+                    {
+                        state->add_transition( begin, end, *existing_goto_state, syntax_tree );
+                    }
+                }                    
 
-                if ( !state->is_processed() )
+                ++j;
+                if ( !j->second )
                 {
-                    state->set_processed( true );
+                    ++j;
+                    LALR_ASSERT( j == ranges_.end() || j->second );
+                }
+            }
+        }
+    }
+}
+
+/**
+// Merge the states that match \e literals into \e states.
+//
+// The literals are inserted into a trie whose nodes are the states of a
+// deterministic automaton that matches just the literals.  That automaton
+// is then combined with the states generated for the regular expressions
+// by generating the states reachable from the pair of their start states
+// so that the time taken grows with the total length of the literals 
+// rather than with the number of literals that share each state.
+//
+// A literal takes priority over any regular expression that matches the
+// same input (as for literals in the syntax tree).  Characters that 
+// continue a literal don't take the action of a regular expression that 
+// transitions on the same character.
+//
+// @param literals
+//  The literal tokens to merge in (assumed not empty).
+//
+// @param states
+//  The states generated for the regular expressions that are replaced by 
+//  the merged states (assumed not null).
+//
+// @param start_state
+//  A variable to receive the merged starting state (assumed not null).
+*/
+void RegexGenerator::generate_literal_states( const std::vector<const RegexToken*>& literals, std::vector<std::unique_ptr<RegexState>>* states, const RegexState** start_state ) const
+{
+    LALR_ASSERT( !literals.empty() );
+    LALR_ASSERT( states );
+    LALR_ASSERT( start_state );
+    LALR_ASSERT( states->empty() || (*states)[0].get() == *start_state );
+    LALR_ASSERT( TOKEN_LITERAL > TOKEN_REGULAR_EXPRESSION );
+
+    // Build the trie.  Each node stores its children as (character, node)
+    // pairs sorted by character and the literal that ends at it, if any.
+    vector<vector<pair<int, int>>> children( 1 );
+    vector<const RegexToken*> tokens( 1, nullptr );
+    for ( vector<const RegexToken*>::const_iterator literal = literals.begin(); literal != literals.end(); ++literal )
+    {
+        const RegexToken* token = *literal;
+        LALR_ASSERT( token && token->type() == TOKEN_LITERAL );
+        LALR_ASSERT( !token->lexeme().empty() );
+        const std::string& lexeme = token->lexeme();
+        int node = 0;
+        std::string::const_iterator i = lexeme.begin();
+        while ( i != lexeme.end() )
+        {
+            int character = RegexSyntaxTree::escape( i, lexeme.end(), &i );
+            vector<pair<int, int>>::iterator child = std::lower_bound( children[node].begin(), children[node].end(), make_pair(character, 0) );
+            if ( child == children[node].end() || child->first != character )
+            {
+                int new_node = int(children.size());
+                children[node].insert( child, make_pair(character, new_node) );
+                children.push_back( vector<pair<int, int>>() );
+                tokens.push_back( nullptr );
+                node = new_node;
+            }
+            else
+            {
+                node = child->second;
+            }
+            ++i;
+        }
 
-                    // Create the distinct ranges of characters that can be 
-                    // transitioned on from the current state.
-                    clear();                
-                    const std::set<RegexItem>& items = state->get_items();
-                    for ( std::set<RegexItem>::const_iterator item = items.begin(); item != items.end(); ++item )
+        const RegexToken* other_token = tokens[node];
+        if ( !other_token || token->line() < other_token->line() )
+        {
+            tokens[node] = token;
+        }
+        else if ( token->line() == other_token->line() )
+        {
+            fire_error( other_token->line(), LEXER_ERROR_SYMBOL_CONFLICT, "0x%08x and 0x%08x conflict but are both defined on the same line", other_token, token );
+        }
+    }
+
+    // Generate the states reachable from the pair of start states.  Each 
+    // merged state is identified by its (trie node, regular expression 
+    // state) pair where -1 stands for no node or state.
+    vector<unique_ptr<RegexState>> regular_expression_states;
+    regular_expression_states.swap( *states );
+    const long long regular_expression_states_size = (long long) regular_expression_states.size();
+    for ( long long i = 0; i < regular_expression_states_size; ++i )
+    {
+        regular_expression_states[i]->set_index( int(i) );
+    }
+
+    vector<pair<int, int>> pairs;
+    std::unordered_map<long long, RegexState*> states_by_pair;
+    vector<int> boundaries;
+    {
+        unique_ptr<RegexState> state( new RegexState() );
+        int start_regular_expression_state = regular_expression_states.empty() ? -1 : 0;
+        states_by_pair.insert( make_pair(1 * (regular_expression_states_size + 1) + start_regular_expression_state + 1, state.get()) );
+        pairs.push_back( make_pair(0, start_regular_expression_state) );
+        states->push_back( move(state) );
+    }
+
+    for ( size_t index = 0; index < pairs.size(); ++index )
+    {
+        int node = pairs[index].first;
+        const RegexState* regular_expression_state = pairs[index].second >= 0 ? regular_expression_states[pairs[index].second].get() : nullptr;
+        RegexState* state = (*states)[index].get();
+
+        const RegexToken* token = node >= 0 ? tokens[node] : nullptr;
+        const void* symbol = token ? token->symbol() : regular_expression_state ? regular_expression_state->get_symbol() : nullptr;
+        if ( symbol )
+        {
+            state->set_symbol( symbol );
+        }
+
+        // Transition on each of the distinct ranges of characters that 
+        // either the trie node or the regular expression state has 
+        // transitions on.
+        const vector<pair<int, int>> no_children;
+        const vector<pair<int, int>>& node_children = node >= 0 ? children[node] : no_children;
+        const std::set<RegexTransition> no_transitions;
+        const std::set<RegexTransition>& transitions = regular_expression_state ? regular_expression_state->get_transitions() : no_transitions;
+        boundaries.clear();
+        for ( vector<pair<int, int>>::const_iterator child = node_children.begin(); child != node_children.end(); ++child )
+        {
+            boundaries.push_back( child->first );
+            boundaries.push_back( child->first + 1 );
+        }
+        for ( std::set<RegexTransition>::const_iterator transition = transitions.begin(); transition != transitions.end(); ++transition )
+        {
+            boundaries.push_back( transition->begin() );
+            boundaries.push_back( transition->end() );
+        }
+        std::sort( boundaries.begin(), boundaries.end() );
+        boundaries.erase( std::unique(boundaries.begin(), boundaries.end()), boundaries.end() );
+
+        vector<pair<int, int>>::const_iterator child = node_children.begin();
+        std::set<RegexTransition>::const_iterator transition = transitions.begin();
+        for ( size_t i = 0; i + 1 < boundaries.size(); ++i )
+        {
+            int begin = boundaries[i];
+            int end = boundaries[i + 1];
+            while ( child != node_children.end() && child->first < begin )
+            {
+                ++child;
+            }
+            while ( transition != transitions.end() && transition->end() <= begin )
+            {
+                ++transition;
+            }
+            int goto_node = child != node_children.end() && child->first == begin ? child->second : -1;
+            int goto_regular_expression_state = transition != transitions.end() && transition->begin() <= begin ? transition->state()->get_index() : -1;
+            if ( goto_node >= 0 || goto_regular_expression_state >= 0 )
+            {
+                long long key = (goto_node + 1) * (regular_expression_states_size + 1) + goto_regular_expression_state + 1;
+                std::unordered_map<long long, RegexState*>::const_iterator existing_goto_state = states_by_pair.find( key );
+                RegexState* goto_state = nullptr;
+                if ( existing_goto_state == states_by_pair.end() )
+                {
+                    unique_ptr<RegexState> new_state( new RegexState() );
+                    goto_state = new_state.get();
+                    states_by_pair.insert( make_pair(key, goto_state) );
+                    states->push_back( move(new_state) );
+                    pairs.push_back( make_pair(goto_node, goto_regular_expression_state) );
+                }
+                else
+                {
+                    goto_state = existing_goto_state->second;
+                }
+                const RegexAction* action = goto_node < 0 ? transition->action() : nullptr;
+                state->add_transition( begin, end, goto_state, action );
+            }
+        }
+    }
+
+    *start_state = (*states)[0].get();
+}
+
+/**
+// Merge equivalent states using Hopcroft's partition refinement.
+//
+// States start out partitioned by the symbol that they match.  The input
+// alphabet is the set of elementary character intervals between the 
+// boundaries of all transitions paired with the action taken on that 
+// interval so that states are only merged when they take the same actions
+// as well as transition to equivalent states.  Missing transitions aren't 
+// completed with a dead state; instead every initial block is used as a 
+// splitter (after Valmari and Lehtinen) which is enough to keep states 
+// with and without a transition on some input apart.
+//
+// Each block is replaced by its lowest indexed state so the start state 
+// stays first and the remaining states keep the order that they were 
+// generated in.  Adjacent transitions to the same state with the same
+// action are merged whether or not any states are.
+//
+// @param states
+//  The states to minimize (assumed not null and to contain the start state
+//  first).
+*/
+void RegexGenerator::minimize_states( std::vector<std::unique_ptr<RegexState>>* states ) const
+{
+    LALR_ASSERT( states );
+    const int states_size = int(states->size());
+    for ( int i = 0; i < states_size; ++i )
+    {
+        (*states)[i]->set_index( i );
+    }
+
+    // Find the boundaries of the elementary intervals of characters that 
+    // every transition can be split into.
+    vector<int> boundaries;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const std::set<RegexTransition>& transitions = (*states)[i]->get_transitions();
+        for ( std::set<RegexTransition>::const_iterator transition = transitions.begin(); transition != transitions.end(); ++transition )
+        {
+            boundaries.push_back( transition->begin() );
+            boundaries.push_back( transition->end() );
+        }
+    }
+    std::sort( boundaries.begin(), boundaries.end() );
+    boundaries.erase( std::unique(boundaries.begin(), boundaries.end()), boundaries.end() );
+
+    // Build the inverse transitions into each state as (letter, source 
+    // state) pairs where each letter is an elementary interval paired with
+    // the action taken on it.
+    const int letters_per_interval = int(actions_.size()) + 1;
+    vector<vector<pair<int, int>>> sources_by_state( states_size );
+    for ( int i = 0; i < states_size; ++i )
+    {
+        const std::set<RegexTransition>& transitions = (*states)[i]->get_transitions();
+        for ( std::set<RegexTransition>::const_iterator transition = transitions.begin(); transition != transitions.end(); ++transition )
+        {
+            int action = transition->action() ? transition->action()->index() + 1 : 0;
+            int begin = int(std::lower_bound(boundaries.begin(), boundaries.end(), transition->begin()) - boundaries.begin());
+            int end = int(std::lower_bound(boundaries.begin(), boundaries.end(), transition->end()) - boundaries.begin());
+            for ( int interval = begin; interval < end; ++interval )
+            {
+                sources_by_state[transition->state()->get_index()].push_back( make_pair(interval * letters_per_interval + action, i) );
+            }
+        }
+    }
+
+    // Partition states by the symbol that they match.  The states in each
+    // block are stored contiguously in *elements* in [first, end) with any
+    // states marked while splitting moved to the front of their block.
+    vector<int> elements( states_size );
+    vector<int> locations( states_size );
+    vector<int> block_by_state( states_size );
+    vector<int> firsts;
+    vector<int> ends;
+    vector<int> marked;
+    {
+        vector<pair<const void*, int>> states_by_symbol( states_size );
+        for ( int i = 0; i < states_size; ++i )
+        {
+            states_by_symbol[i] = make_pair( (*states)[i]->get_symbol(), i );
+        }
+        std::sort( states_by_symbol.begin(), states_by_symbol.end() );
+        for ( int i = 0; i < states_size; ++i )
+        {
+            if ( i == 0 || states_by_symbol[i].first != states_by_symbol[i - 1].first )
+            {
+                firsts.push_back( i );
+                ends.push_back( i );
+                marked.push_back( 0 );
+            }
+            int state = states_by_symbol[i].second;
+            elements[i] = state;
+            locations[state] = i;
+            block_by_state[state] = int(firsts.size()) - 1;
+            ++ends.back();
+        }
+    }
+
+    vector<int> splitters;
+    vector<bool> splitting( firsts.size(), true );
+    for ( int block = int(firsts.size()) - 1; block >= 0; --block )
+    {
+        splitters.push_back( block );
+    }
+
+    vector<pair<int, int>> sources;
+    vector<int> touched_blocks;
+    while ( !splitters.empty() )
+    {
+        int splitter = splitters.back();
+        splitters.pop_back();
+        splitting[splitter] = false;
+
+        sources.clear();
+        for ( int i = firsts[splitter]; i < ends[splitter]; ++i )
+        {
+            const vector<pair<int, int>>& state_sources = sources_by_state[elements[i]];
+            sources.insert( sources.end(), state_sources.begin(), state_sources.end() );
+        }
+        std::sort( sources.begin(), sources.end() );
+
+        vector<pair<int, int>>::const_iterator source = sources.begin();
+        while ( source != sources.end() )
+        {
+            // Mark the states that transition into the splitter on this 
+            // letter by moving them to the front of their blocks.
+            int letter = source->first;
+            while ( source != sources.end() && source->first == letter )
+            {
+                int state = source->second;
+                int block = block_by_state[state];
+                int location = firsts[block] + marked[block];
+                if ( locations[state] >= location )
+                {
+                    if ( marked[block] == 0 )
+                    {
+                        touched_blocks.push_back( block );
+                    }
+                    int other_state = elements[location];
+                    elements[locations[state]] = other_state;
+                    locations[other_state] = locations[state];
+                    elements[location] = state;
+                    locations[state] = location;
+                    ++marked[block];
+                }
+                ++source;
+            }
+
+            // Split each block that only some states were marked in by
+            // moving its marked states into a new block.
+            for ( vector<int>::const_iterator i = touched_blocks.begin(); i != touched_blocks.end(); ++i )
+            {
+                int block = *i;
+                int marked_end = firsts[block] + marked[block];
+                marked[block] = 0;
+                if ( marked_end < ends[block] )
+                {
+                    int new_block = int(firsts.size());
+                    firsts.push_back( firsts[block] );
+                    ends.push_back( marked_end );
+                    marked.push_back( 0 );
+                    firsts[block] = marked_end;
+                    for ( int j = firsts[new_block]; j < ends[new_block]; ++j )
                     {
-                        const std::set<RegexNode*, RegexNodeLess>& next_nodes = item->next_nodes();
-                        for ( std::set<RegexNode*, RegexNodeLess>::const_iterator j = next_nodes.begin(); j != next_nodes.end(); ++j )
-                        {
-                            const RegexNode* next_node = *j;
-                            LALR_ASSERT( next_node );
-                            if ( !next_node->is_end() )
-                            {
-                                insert( next_node->get_begin_character(), next_node->get_end_character() );
-                            }
-                        }
+                        block_by_state[elements[j]] = new_block;
                     }
-                    
-                    // Create a goto state and a transition from the current 
-                    // state for each distinct range.
-                    vector<pair<int, bool> >::const_iterator j = ranges_.begin();
-                    while ( j != ranges_.end() )
-                    {               
-                        int begin = (j + 0)->first;
-                        int end = (j + 1)->first;
-                        LALR_ASSERT( begin < end );
-                        
-                        std::unique_ptr<RegexState> goto_state = goto_( state, begin, end );
-                        if ( !goto_state->get_items().empty() )
-                        {
-                            auto existing_goto_state = states->find( goto_state );
-                            if ( existing_goto_state == states->end() )
-                            {
-                                state->add_transition( begin, end, goto_state.get() );
-                                generate_symbol_for_state( goto_state.get() );
-                                states->insert( move(goto_state) );
-                                added += 1;
-                            }
-                            else
-                            {
-                                state->add_transition( begin, end, existing_goto_state->get() );
-                            }
-                        }                    
-
-                        ++j;
-                        if ( !j->second )
-                        {
-                            ++j;
-                            LALR_ASSERT( j == ranges_.end() || j->second );
-                        }
+
+                    if ( splitting[block] || ends[new_block] - firsts[new_block] <= ends[block] - firsts[block] )
+                    {
+                        splitting.push_back( true );
+                        splitters.push_back( new_block );
+                    }
+                    else
+                    {
+                        splitting.push_back( false );
+                        splitting[block] = true;
+                        splitters.push_back( block );
                     }
                 }
             }
+            touched_blocks.clear();
         }
     }
 
-    generate_indices_for_states();
+    // Replace each block by its lowest indexed state, merge the adjacent 
+    // transitions that then go to the same state, and remove the other 
+    // states.
+    vector<const RegexState*> states_by_index( states_size, nullptr );
+    for ( size_t block = 0; block < firsts.size(); ++block )
+    {
+        int representative = *std::min_element( elements.begin() + firsts[block], elements.begin() + ends[block] );
+        for ( int i = firsts[block]; i < ends[block]; ++i )
+        {
+            states_by_index[elements[i]] = (*states)[representative].get();
+        }
+    }
+
+    for ( int i = 0; i < states_size; ++i )
+    {
+        if ( states_by_index[i] == (*states)[i].get() )
+        {
+            (*states)[i]->replace_transition_states( states_by_index );
+        }
+    }
+
+    int index = 0;
+    for ( int i = 0; i < states_size; ++i )
+    {
+        if ( states_by_index[i] == (*states)[i].get() )
+        {
+            (*states)[index] = move( (*states)[i] );
+            ++index;
+        }
+    }
+    states->resize( index );
 }
 
 /**
@@ -329,8 +749,11 @@ void RegexGenerator::generate_indices_for_states()
 //
 // @param state
 //  The state to generate a matching symbol for.
+//
+// @param syntax_tree
+//  The syntax tree that the nodes in the items of \e state belong to.
 */
-void RegexGenerator::generate_symbol_for_state( RegexState* state ) const
+void RegexGenerator::generate_symbol_for_state( RegexState* state, const RegexSyntaxTree& syntax_tree ) const
 {
     LALR_ASSERT( state );
 
@@ -341,10 +764,10 @@ void RegexGenerator::generate_symbol_for_state( RegexState* state ) const
     const std::set<RegexItem>& items = state->get_items();
     for ( std::set<RegexItem>::const_iterator item = items.begin(); item != items.end(); ++item )
     {
-        std::set<RegexNode*, RegexNodeLess>::const_iterator i = item->next_nodes().begin();
-        while ( i != item->next_nodes().end() )
+        const RegexNodeSet& next_nodes = item->next_nodes();
+        for ( int i = next_nodes.next(0); i != RegexNodeSet::INVALID_INDEX; i = next_nodes.next(i + 1) )
         {
-            const RegexNode* node = *i;
+            const RegexNode* node = syntax_tree.node_by_index( i );
             LALR_ASSERT( node );
 
             if ( node->is_end() && node->get_token() )
@@ -369,8 +792,6 @@ void RegexGenerator::generate_symbol_for_state( RegexState* state ) const
                     fire_error( token->line(), LEXER_ERROR_SYMBOL_CONFLICT, "0x%08x and 0x%08x conflict but are both defined on the same line", token, node->get_token() );
                 }
             }
-            
-            ++i;
         }
     }    
 
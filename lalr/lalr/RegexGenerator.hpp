@@ -2,7 +2,6 @@
 #define LALR_LEXERGENERATOR_HPP_INCLUDED
 
 #include "RegexToken.hpp"
-#include "RegexStateLess.hpp"
 #include <memory>
 #include <vector>
 #include <set>
@@ -31,7 +30,7 @@ class RegexGenerator
 {
     ErrorPolicy* error_policy_; ///< The error policy to report errors and debug information to or null to ignore errors and debug information.
     std::vector<std::unique_ptr<RegexAction>> actions_; ///< The lexical analyzer actions.
-    std::set<std::unique_ptr<RegexState>, RegexStateLess> states_; ///< The states generated for the lexical analyzer.
+    std::vector<std::unique_ptr<RegexState>> states_; ///< The states generated for the lexical analyzer in index order.
     const RegexState* start_state_; ///< The starting state for the lexical analyzer.
     std::vector<std::pair<int, bool>> ranges_; ///< Ranges generated for the current transition while generating.
 
@@ -39,7 +38,7 @@ class RegexGenerator
         RegexGenerator();
         ~RegexGenerator();
         const std::vector<std::unique_ptr<RegexAction>>& actions() const;
-        const std::set<std::unique_ptr<RegexState>, RegexStateLess>& states() const;
+        const std::vector<std::unique_ptr<RegexState>>& states() const;
         const RegexState* start_state() const;
         void fire_error( int line, int error, const char* format, ... ) const;
         void fire_printf( const char* format, ... ) const;
@@ -48,10 +47,12 @@ class RegexGenerator
         int generate( const std::vector<RegexToken>& tokens, ErrorPolicy* error_policy = nullptr );
 
     private:
-        std::unique_ptr<RegexState> goto_( const RegexState* state, int begin, int end );
-        void generate_states( const RegexSyntaxTree& syntax_tree, std::set<std::unique_ptr<RegexState>, RegexStateLess>* states, const RegexState** start_state );
+        std::unique_ptr<RegexState> goto_( const RegexState* state, int begin, int end, const RegexSyntaxTree& syntax_tree );
+        void generate_states( const RegexSyntaxTree& syntax_tree, std::vector<std::unique_ptr<RegexState>>* states, const RegexState** start_state );
+        void generate_literal_states( const std::vector<const RegexToken*>& literals, std::vector<std::unique_ptr<RegexState>>* states, const RegexState** start_state ) const;
+        void minimize_states( std::vector<std::unique_ptr<RegexState>>* states ) const;
         void generate_indices_for_states();
-        void generate_symbol_for_state( RegexState* state ) const;
+        void generate_symbol_for_state( RegexState* state, const RegexSyntaxTree& syntax_tree ) const;
         void clear();
         void insert( int begin, int end );
 };
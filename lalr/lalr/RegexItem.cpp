@@ -5,6 +5,7 @@
 
 #include "RegexItem.hpp"
 #include "RegexNode.hpp"
+#include "RegexSyntaxTree.hpp"
 #include "assert.hpp"
 #include <string>
 
@@ -24,7 +25,7 @@ RegexItem::RegexItem()
 // @param next_nodes
 //  The nodes that appear after the dot in this item.
 */
-RegexItem::RegexItem( const std::set<RegexNode*, RegexNodeLess>& next_nodes )
+RegexItem::RegexItem( const RegexNodeSet& next_nodes )
 : next_nodes_( next_nodes )
 {
 }
@@ -35,7 +36,7 @@ RegexItem::RegexItem( const std::set<RegexNode*, RegexNodeLess>& next_nodes )
 // @return
 //  The next nodes.
 */
-const std::set<RegexNode*, RegexNodeLess>& RegexItem::next_nodes() const
+const RegexNodeSet& RegexItem::next_nodes() const
 {
     return next_nodes_;
 }
@@ -50,9 +51,8 @@ const std::set<RegexNode*, RegexNodeLess>& RegexItem::next_nodes() const
 //
 // Action nodes are special in that they are only able to be transitioned on
 // if no other nodes can be visited after [\e begin, \e end) is transitioned
-// on.  Nodes are ordered by type and then index and the action type 
-// (LEXER_NODE_ACTION) is the highest so that action nodes sort to the end
-// of the nodes in an item.
+// on.  The non-action nodes are visited first and then the action nodes are
+// only visited if none of the non-action nodes match.
 //
 // @param begin
 //  The begin character of the interval to calculate the next nodes for.
@@ -60,50 +60,49 @@ const std::set<RegexNode*, RegexNodeLess>& RegexItem::next_nodes() const
 // @param end
 //  The end character of the interval to calculate the next nodes for.
 //
+// @param syntax_tree
+//  The syntax tree that the nodes in this item belong to.
+//
 // @return
 //  The next nodes after [\e begin, \e end) is transitioned on from this item.
 */
-std::set<RegexNode*, RegexNodeLess> RegexItem::next_nodes( int begin, int end ) const
+RegexNodeSet RegexItem::next_nodes( int begin, int end, const RegexSyntaxTree& syntax_tree ) const
 {
-    std::set<RegexNode*, RegexNodeLess> next_nodes;
+    RegexNodeSet next_nodes;
     
 //
 // Add transitions from non-action nodes to the nodes that are visitable
 // next.
 //    
-    std::set<RegexNode*, RegexNodeLess>::const_iterator i = next_nodes_.begin(); 
-    while ( i != next_nodes_.end() && (*i)->get_type() != LEXER_NODE_ACTION )
-    {   
-        const RegexNode* node = *i;
-        LALR_ASSERT( node );            
-        LALR_ASSERT( node->get_type() < LEXER_NODE_ACTION );
-
-        if ( node->is_match(begin, end) )
+    bool actions = false;
+    for ( int i = next_nodes_.next(0); i != RegexNodeSet::INVALID_INDEX; i = next_nodes_.next(i + 1) )
+    {
+        const RegexNode* node = syntax_tree.node_by_index( i );
+        LALR_ASSERT( node );
+        if ( node->get_type() == LEXER_NODE_ACTION )
         {
-            next_nodes.insert( node->get_follow_positions().begin(), node->get_follow_positions().end() );
+            actions = true;
+        }
+        else if ( node->is_match(begin, end) )
+        {
+            next_nodes.insert( node->get_follow_positions() );
         }
-        
-        ++i;
     }
 
 //
 // If there were no transitions from any other nodes then add transitions
 // from action nodes to the nodes that are visitable next.
 //    
-    if ( next_nodes.empty() )
+    if ( next_nodes.empty() && actions )
     {
-        while ( i != next_nodes_.end() )
+        for ( int i = next_nodes_.next(0); i != RegexNodeSet::INVALID_INDEX; i = next_nodes_.next(i + 1) )
         {
-            const RegexNode* node = *i;
-            LALR_ASSERT( node );            
-            LALR_ASSERT( node->get_type() == LEXER_NODE_ACTION );
-
-            if ( node->is_match(begin, end) )
+            const RegexNode* node = syntax_tree.node_by_index( i );
+            LALR_ASSERT( node );
+            if ( node->get_type() == LEXER_NODE_ACTION && node->is_match(begin, end) )
             {
-                next_nodes.insert( node->get_follow_positions().begin(), node->get_follow_positions().end() );
+                next_nodes.insert( node->get_follow_positions() );
             }
-            
-            ++i;
         }
     }
     
@@ -120,28 +119,47 @@ std::set<RegexNode*, RegexNodeLess> RegexItem::next_nodes( int begin, int end )
 // @param end
 //  The end character of the interval to calculate the next nodes for.
 //
+// @param syntax_tree
+//  The syntax tree that the nodes in this item belong to.
+//
 // @return
 //  The action that should be taken after [\e begin, \e end) is 
 //  transitioned on or null if there is no such action.
 */
-const RegexAction* RegexItem::find_action_by_interval( int begin, int end ) const
+const RegexAction* RegexItem::find_action_by_interval( int begin, int end, const RegexSyntaxTree& syntax_tree ) const
 {
-    std::set<RegexNode*, RegexNodeLess>::const_iterator i = next_nodes_.begin();
-    while ( i != next_nodes_.end() && !(*i)->is_action() && !(*i)->is_match(begin, end) )
+    for ( int i = next_nodes_.next(0); i != RegexNodeSet::INVALID_INDEX; i = next_nodes_.next(i + 1) )
     {
-        ++i;
+        const RegexNode* node = syntax_tree.node_by_index( i );
+        LALR_ASSERT( node );
+        if ( !node->is_action() && node->is_match(begin, end) )
+        {
+            return node->get_action();
+        }
     }
-    
-    if ( i != next_nodes_.end() && (*i)->is_action() )
+
+    for ( int i = next_nodes_.next(0); i != RegexNodeSet::INVALID_INDEX; i = next_nodes_.next(i + 1) )
     {
-        while ( i != next_nodes_.end() && !(*i)->is_match(begin, end) )
+        const RegexNode* node = syntax_tree.node_by_index( i );
+        LALR_ASSERT( node );
+        if ( node->is_action() && node->is_match(begin, end) )
         {
-            LALR_ASSERT( (*i)->is_action() );
-            ++i;
+            return node->get_action();
         }
     }
     
-    return i != next_nodes_.end() ? (*i)->get_action() : NULL;
+    return NULL;
+}
+
+/**
+// Hash the nodes in this item.
+//
+// @return
+//  The hash of the nodes after the dot in this item.
+*/
+size_t RegexItem::hash() const
+{
+    return next_nodes_.hash();
 }
 
 /**
@@ -155,3 +173,15 @@ bool RegexItem::operator<( const RegexItem& item ) const
 {
     return next_nodes_ < item.next_nodes_;
 }
+
+/**
+// Equality operator.
+//
+// @return
+//  True if the nodes after the dot in this item are the same as the nodes
+//  after the dot in \e item.
+*/
+bool RegexItem::operator==( const RegexItem& item ) const
+{
+    return next_nodes_ == item.next_nodes_;
+}
@@ -1,7 +1,7 @@
 #ifndef LALR_REGEXITEM_HPP_INCLUDED
 #define LALR_REGEXITEM_HPP_INCLUDED
 
-#include "RegexNodeLess.hpp"
+#include "RegexNodeSet.hpp"
 #include <string>
 #include <set>
 
@@ -10,6 +10,7 @@ namespace lalr
 
 class RegexNode;
 class RegexAction;
+class RegexSyntaxTree;
 
 /**
 // An item that defines the positions in a regular expression that a state 
@@ -17,15 +18,17 @@ class RegexAction;
 */
 class RegexItem
 {
-    std::set<RegexNode*, RegexNodeLess> next_nodes_; ///< The nodes that appear after the dot in this item.
+    RegexNodeSet next_nodes_; ///< The nodes that appear after the dot in this item.
 
 public:
     RegexItem();
-    RegexItem( const std::set<RegexNode*, RegexNodeLess>& next_nodes );
-    const std::set<RegexNode*, RegexNodeLess>& next_nodes() const;
-    std::set<RegexNode*, RegexNodeLess> next_nodes( int begin, int end ) const;
-    const RegexAction* find_action_by_interval( int begin, int end ) const;
+    RegexItem( const RegexNodeSet& next_nodes );
+    const RegexNodeSet& next_nodes() const;
+    RegexNodeSet next_nodes( int begin, int end, const RegexSyntaxTree& syntax_tree ) const;
+    const RegexAction* find_action_by_interval( int begin, int end, const RegexSyntaxTree& syntax_tree ) const;
+    size_t hash() const;
     bool operator<( const RegexItem& item ) const;
+    bool operator==( const RegexItem& item ) const;
 };
 
 }
@@ -5,6 +5,7 @@
 
 #include "RegexNode.hpp"
 #include "RegexAction.hpp"
+#include "RegexSyntaxTree.hpp"
 #include "assert.hpp"
 #include <algorithm>
 #include <stdio.h>
@@ -12,7 +13,6 @@
 
 using std::find;
 using std::vector;
-using std::set;
 using namespace lalr;
 
 const int lalr::BEGIN_CHARACTER = 0;
@@ -345,7 +345,7 @@ bool RegexNode::is_nullable() const
 // @return
 //  The first positions.
 */
-const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_first_positions() const
+const RegexNodeSet& RegexNode::get_first_positions() const
 {
     return first_positions_;
 }
@@ -356,7 +356,7 @@ const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_first_positions() cons
 // @return
 //  The last positions.
 */
-const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_last_positions() const
+const RegexNodeSet& RegexNode::get_last_positions() const
 {
     return last_positions_;
 }
@@ -367,7 +367,7 @@ const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_last_positions() const
 // @return
 //  The follow positions.
 */
-const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_follow_positions() const
+const RegexNodeSet& RegexNode::get_follow_positions() const
 {
     return follow_positions_;
 }
@@ -383,7 +383,7 @@ const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_follow_positions() con
 // @return
 //  The first or follow positions of this node depending on its type.
 */
-const std::set<RegexNode*, RegexNodeLess>& RegexNode::get_next_positions() const
+const RegexNodeSet& RegexNode::get_next_positions() const
 {
     return type_ == LEXER_NODE_SYMBOL ? follow_positions_ : first_positions_;
 }
@@ -461,30 +461,30 @@ void RegexNode::calculate_first_positions()
         case LEXER_NODE_CAT:
         {
             LALR_ASSERT( nodes_.size() == 2 );
-            first_positions_.insert( nodes_[0]->first_positions_.begin(), nodes_[0]->first_positions_.end() );
+            first_positions_.insert( nodes_[0]->first_positions_ );
             if ( nodes_[0]->is_nullable() )
             {
-                first_positions_.insert( nodes_[1]->first_positions_.begin(), nodes_[1]->first_positions_.end() );
+                first_positions_.insert( nodes_[1]->first_positions_ );
             }
             break;
         }
 
         case LEXER_NODE_OR:
             LALR_ASSERT( nodes_.size() == 2 );
-            first_positions_.insert( nodes_[0]->first_positions_.begin(), nodes_[0]->first_positions_.end() );
-            first_positions_.insert( nodes_[1]->first_positions_.begin(), nodes_[1]->first_positions_.end() );
+            first_positions_.insert( nodes_[0]->first_positions_ );
+            first_positions_.insert( nodes_[1]->first_positions_ );
             break;
 
         case LEXER_NODE_STAR:
         case LEXER_NODE_PLUS:
         case LEXER_NODE_OPTIONAL:
             LALR_ASSERT( nodes_.size() == 1 );
-            first_positions_.insert( nodes_[0]->first_positions_.begin(), nodes_[0]->first_positions_.end() );
+            first_positions_.insert( nodes_[0]->first_positions_ );
             break;
 
         case LEXER_NODE_SYMBOL:
         case LEXER_NODE_ACTION:
-            first_positions_.insert( this );
+            first_positions_.insert( index_ );
             break;
 
         default:
@@ -513,30 +513,30 @@ void RegexNode::calculate_last_positions()
         case LEXER_NODE_CAT:
         {
             LALR_ASSERT( nodes_.size() == 2 );
-            last_positions_.insert( nodes_[1]->last_positions_.begin(), nodes_[1]->last_positions_.end() );
+            last_positions_.insert( nodes_[1]->last_positions_ );
             if ( nodes_[1]->is_nullable() )
             {
-                last_positions_.insert( nodes_[0]->last_positions_.begin(), nodes_[0]->last_positions_.end() );
+                last_positions_.insert( nodes_[0]->last_positions_ );
             }
             break;
         }
 
         case LEXER_NODE_OR:
             LALR_ASSERT( nodes_.size() == 2 );
-            last_positions_.insert( nodes_[0]->last_positions_.begin(), nodes_[0]->last_positions_.end() );
-            last_positions_.insert( nodes_[1]->last_positions_.begin(), nodes_[1]->last_positions_.end() );
+            last_positions_.insert( nodes_[0]->last_positions_ );
+            last_positions_.insert( nodes_[1]->last_positions_ );
             break;
 
         case LEXER_NODE_STAR:
         case LEXER_NODE_PLUS:
         case LEXER_NODE_OPTIONAL:
             LALR_ASSERT( nodes_.size() == 1 );
-            last_positions_.insert( nodes_[0]->last_positions_.begin(), nodes_[0]->last_positions_.end() );
+            last_positions_.insert( nodes_[0]->last_positions_ );
             break;
 
         case LEXER_NODE_SYMBOL:
         case LEXER_NODE_ACTION:
-            last_positions_.insert( this );
+            last_positions_.insert( index_ );
             break;
 
         default:
@@ -548,13 +548,13 @@ void RegexNode::calculate_last_positions()
 /**
 // Recursively calculate the follow positions at this node.
 */
-void RegexNode::calculate_follow_positions()
+void RegexNode::calculate_follow_positions( const RegexSyntaxTree& syntax_tree )
 {
     for ( std::vector<std::shared_ptr<RegexNode> >::const_iterator i = nodes_.begin(); i != nodes_.end(); ++i )
     {
         RegexNode* node = i->get();
         LALR_ASSERT( node );
-        node->calculate_follow_positions();
+        node->calculate_follow_positions( syntax_tree );
     }
 
     switch ( type_ )
@@ -566,16 +566,16 @@ void RegexNode::calculate_follow_positions()
         {
             LALR_ASSERT( nodes_.size() == 2 );
 
-            const std::set<RegexNode*, RegexNodeLess>& last_positions = nodes_[0]->last_positions_;
-            const std::set<RegexNode*, RegexNodeLess>& first_positions = nodes_[1]->first_positions_;
+            const RegexNodeSet& last_positions = nodes_[0]->last_positions_;
+            const RegexNodeSet& first_positions = nodes_[1]->first_positions_;
 
-            for ( std::set<RegexNode*, RegexNodeLess>::const_iterator i = last_positions.begin(); i != last_positions.end(); ++i )
+            for ( int i = last_positions.next(0); i != RegexNodeSet::INVALID_INDEX; i = last_positions.next(i + 1) )
             {
-                RegexNode* node = *i;
+                RegexNode* node = syntax_tree.node_by_index( i );
                 LALR_ASSERT( node );
                 if ( node->get_type() == LEXER_NODE_SYMBOL || node->get_type() == LEXER_NODE_ACTION )
                 {
-                    node->follow_positions_.insert( first_positions.begin(), first_positions.end() );
+                    node->follow_positions_.insert( first_positions );
                 }
             }
 
@@ -586,16 +586,16 @@ void RegexNode::calculate_follow_positions()
         case LEXER_NODE_PLUS:
         {
             LALR_ASSERT( nodes_.size() == 1 );
-            const std::set<RegexNode*, RegexNodeLess>& last_positions = last_positions_;
-            const std::set<RegexNode*, RegexNodeLess>& first_positions = first_positions_;
+            const RegexNodeSet& last_positions = last_positions_;
+            const RegexNodeSet& first_positions = first_positions_;
 
-            for ( std::set<RegexNode*, RegexNodeLess>::const_iterator i = last_positions.begin(); i != last_positions.end(); ++i )
+            for ( int i = last_positions.next(0); i != RegexNodeSet::INVALID_INDEX; i = last_positions.next(i + 1) )
             {
-                RegexNode* node = *i;
+                RegexNode* node = syntax_tree.node_by_index( i );
                 LALR_ASSERT( node );
                 if ( node->get_type() == LEXER_NODE_SYMBOL || node->get_type() == LEXER_NODE_ACTION )
                 {
-                    node->follow_positions_.insert( first_positions.begin(), first_positions.end() );
+                    node->follow_positions_.insert( first_positions );
                 }
             }
 
@@ -614,28 +614,6 @@ void RegexNode::calculate_follow_positions()
     }
 }
 
-/**
-// Compare this RegexNode with \e node by type and then index.
-//
-// The type is part of the comparison so that action nodes (LEXER_NODE_ACTION)
-// sort at the end of the set of nodes for an item.  The value of 
-// LEXER_NODE_ACTION is assumed to be the highest value.
-//
-// @param node
-//  The node to compare this node with.
-//
-// @return
-//  True if the type of this RegexNode is less than that of \e node or if the 
-//  type of this RegexNode is equal to that of \e node then true if the index 
-//  of this RegexNode is less than that of \e node otherwise false.
-*/
-bool RegexNode::operator<( const RegexNode& node ) const
-{
-    return type_ < node.type_
-        || (type_ == node.type_ && index_ < node.index_)
-         ;
-}
-
 /**
 // Recursively print this RegexNode as part of a LexerItem.
 //
@@ -643,9 +621,9 @@ bool RegexNode::operator<( const RegexNode& node ) const
 //  The Nodes that appear after the dot in the LexerItem (if \e dot_nodes 
 //  contains this RegexNode then a leading dot is printed).
 */
-void RegexNode::print( const std::set<RegexNode*>& dot_nodes ) const
+void RegexNode::print( const RegexNodeSet& dot_nodes ) const
 {
-    if ( dot_nodes.find(const_cast<RegexNode*>(this)) != dot_nodes.end() )
+    if ( dot_nodes.contains(index_) )
     {
         printf( ". " );
     }
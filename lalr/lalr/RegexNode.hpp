@@ -1,10 +1,9 @@
 #ifndef LALR_REGEXNODE_HPP_INCLUDED
 #define LALR_REGEXNODE_HPP_INCLUDED
 
-#include "RegexNodeLess.hpp"
+#include "RegexNodeSet.hpp"
 #include "RegexNodeType.hpp"
 #include <memory>
-#include <set>
 #include <vector>
 
 namespace lalr
@@ -48,6 +47,7 @@ extern const int INVALID_END_CHARACTER;
 
 class RegexToken;
 class RegexAction;
+class RegexSyntaxTree;
 
 /**
 // @internal
@@ -64,9 +64,9 @@ class RegexNode : public std::enable_shared_from_this<RegexNode>
     const RegexAction* action_; ///< The action taken at the node or null if no action is taken at the node.
     std::vector<std::shared_ptr<RegexNode> > nodes_; ///< The child nodes.
     bool nullable_; ///< True if the node is nullable otherwise false.
-    std::set<RegexNode*, RegexNodeLess> first_positions_; ///< The first positions at the node.
-    std::set<RegexNode*, RegexNodeLess> last_positions_; ///< The last positions at the node.
-    std::set<RegexNode*, RegexNodeLess> follow_positions_; ///< The follow positions at the node.
+    RegexNodeSet first_positions_; ///< The first positions at the node.
+    RegexNodeSet last_positions_; ///< The last positions at the node.
+    RegexNodeSet follow_positions_; ///< The follow positions at the node.
 
     public:
         RegexNode( int index, RegexNodeType type );
@@ -90,19 +90,17 @@ class RegexNode : public std::enable_shared_from_this<RegexNode>
         const std::vector<std::shared_ptr<RegexNode> >& get_nodes() const;
 
         bool is_nullable() const;
-        const std::set<RegexNode*, RegexNodeLess>& get_first_positions() const;
-        const std::set<RegexNode*, RegexNodeLess>& get_last_positions() const;
-        const std::set<RegexNode*, RegexNodeLess>& get_follow_positions() const;
-        const std::set<RegexNode*, RegexNodeLess>& get_next_positions() const;
+        const RegexNodeSet& get_first_positions() const;
+        const RegexNodeSet& get_last_positions() const;
+        const RegexNodeSet& get_follow_positions() const;
+        const RegexNodeSet& get_next_positions() const;
 
         void calculate_nullable();
         void calculate_first_positions();
         void calculate_last_positions();
-        void calculate_follow_positions();
+        void calculate_follow_positions( const RegexSyntaxTree& syntax_tree );
 
-        bool operator<( const RegexNode& node ) const;
-
-        void print( const std::set<RegexNode*>& dot_nodes ) const;
+        void print( const RegexNodeSet& dot_nodes ) const;
 };
 
 }
@@ -0,0 +1,221 @@
+//
+// RegexNodeSet.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "RegexNodeSet.hpp"
+#include "assert.hpp"
+#include <algorithm>
+
+using std::vector;
+using std::pair;
+using std::make_pair;
+using std::lower_bound;
+using namespace lalr;
+
+namespace
+{
+
+const int BITS_PER_WORD = 64;
+
+/**
+// Compare the word index of a (word index, bits) pair with \e word.
+*/
+bool word_less( const pair<int, uint64_t>& lhs, int word )
+{
+    return lhs.first < word;
+}
+
+}
+
+/**
+// Constructor.
+*/
+RegexNodeSet::RegexNodeSet()
+: words_()
+{
+}
+
+/**
+// Is this set empty?
+//
+// @return
+//  True if this set contains no nodes otherwise false.
+*/
+bool RegexNodeSet::empty() const
+{
+    return words_.empty();
+}
+
+/**
+// Does this set contain the node with index \e index?
+//
+// @param index
+//  The index of the node to check for.
+//
+// @return
+//  True if this set contains the node otherwise false.
+*/
+bool RegexNodeSet::contains( int index ) const
+{
+    LALR_ASSERT( index >= 0 );
+    int word = index / BITS_PER_WORD;
+    vector<pair<int, uint64_t>>::const_iterator i = lower_bound( words_.begin(), words_.end(), word, &word_less );
+    return i != words_.end() && i->first == word && (i->second & (uint64_t(1) << (index % BITS_PER_WORD))) != 0;
+}
+
+/**
+// Get the index of the first node in this set at or after \e index.
+//
+// Iterate over the nodes in a set in index order with:
+//
+// ~~~c++
+// for ( int i = nodes.next(0); i != RegexNodeSet::INVALID_INDEX; i = nodes.next(i + 1) )
+// ~~~
+//
+// @param index
+//  The index to start searching from.
+//
+// @return
+//  The index of the first node in this set at or after \e index or
+//  `RegexNodeSet::INVALID_INDEX` if there is no such node.
+*/
+int RegexNodeSet::next( int index ) const
+{
+    LALR_ASSERT( index >= 0 );
+    int word = index / BITS_PER_WORD;
+    vector<pair<int, uint64_t>>::const_iterator i = lower_bound( words_.begin(), words_.end(), word, &word_less );
+    if ( i != words_.end() )
+    {
+        uint64_t bits = i->second;
+        if ( i->first == word )
+        {
+            bits &= ~uint64_t(0) << (index % BITS_PER_WORD);
+            if ( bits == 0 )
+            {
+                ++i;
+                if ( i == words_.end() )
+                {
+                    return INVALID_INDEX;
+                }
+                bits = i->second;
+            }
+        }
+        index = i->first * BITS_PER_WORD;
+        while ( (bits & 1) == 0 )
+        {
+            bits >>= 1;
+            ++index;
+        }
+        return index;
+    }
+    return INVALID_INDEX;
+}
+
+/**
+// Hash the nodes in this set.
+//
+// @return
+//  The hash of the nodes in this set.
+*/
+size_t RegexNodeSet::hash() const
+{
+    size_t hash = 0;
+    for ( vector<pair<int, uint64_t>>::const_iterator i = words_.begin(); i != words_.end(); ++i )
+    {
+        hash = hash * 31 + size_t(i->first);
+        hash = hash * 31 + size_t(i->second ^ (i->second >> 32));
+    }
+    return hash;
+}
+
+/**
+// Equality operator.
+//
+// @return
+//  True if this set contains the same nodes as \e node_set.
+*/
+bool RegexNodeSet::operator==( const RegexNodeSet& node_set ) const
+{
+    return words_ == node_set.words_;
+}
+
+/**
+// Less than operator.
+//
+// @return
+//  True if the words of this set are lexicographically less than the words
+//  of \e node_set.
+*/
+bool RegexNodeSet::operator<( const RegexNodeSet& node_set ) const
+{
+    return words_ < node_set.words_;
+}
+
+/**
+// Add the node with index \e index to this set.
+//
+// @param index
+//  The index of the node to add.
+*/
+void RegexNodeSet::insert( int index )
+{
+    LALR_ASSERT( index >= 0 );
+    int word = index / BITS_PER_WORD;
+    uint64_t bit = uint64_t(1) << (index % BITS_PER_WORD);
+    vector<pair<int, uint64_t>>::iterator i = lower_bound( words_.begin(), words_.end(), word, &word_less );
+    if ( i != words_.end() && i->first == word )
+    {
+        i->second |= bit;
+    }
+    else
+    {
+        words_.insert( i, make_pair(word, bit) );
+    }
+}
+
+/**
+// Add the nodes in \e node_set to this set.
+//
+// @param node_set
+//  The nodes to add.
+*/
+void RegexNodeSet::insert( const RegexNodeSet& node_set )
+{
+    if ( node_set.words_.empty() )
+    {
+        return;
+    }
+    if ( words_.empty() )
+    {
+        words_ = node_set.words_;
+        return;
+    }
+
+    vector<pair<int, uint64_t>> words;
+    words.reserve( words_.size() + node_set.words_.size() );
+    vector<pair<int, uint64_t>>::const_iterator i = words_.begin();
+    vector<pair<int, uint64_t>>::const_iterator j = node_set.words_.begin();
+    while ( i != words_.end() && j != node_set.words_.end() )
+    {
+        if ( i->first < j->first )
+        {
+            words.push_back( *i );
+            ++i;
+        }
+        else if ( j->first < i->first )
+        {
+            words.push_back( *j );
+            ++j;
+        }
+        else
+        {
+            words.push_back( make_pair(i->first, i->second | j->second) );
+            ++i;
+            ++j;
+        }
+    }
+    words.insert( words.end(), i, vector<pair<int, uint64_t>>::const_iterator(words_.end()) );
+    words.insert( words.end(), j, node_set.words_.end() );
+    words_.swap( words );
+}
@@ -0,0 +1,43 @@
+#ifndef LALR_REGEXNODESET_HPP_INCLUDED
+#define LALR_REGEXNODESET_HPP_INCLUDED
+
+#include <vector>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace lalr
+{
+
+/**
+// @internal
+//
+// A set of regular expression positions stored as a sparse bitset indexed
+// by node index.
+//
+// Only the non-zero 64 bit words of the bitset are stored, in order of 
+// their word index, so that the small and mostly contiguous follow position
+// sets of long runs of literals stay small while unions, comparisons, and 
+// hashing still work a word at a time.
+*/
+class RegexNodeSet
+{
+    std::vector<std::pair<int, uint64_t>> words_; ///< The non-zero words of this set as (word index, bits) pairs sorted by word index.
+
+public:
+    RegexNodeSet();
+    bool empty() const;
+    bool contains( int index ) const;
+    int next( int index ) const;
+    size_t hash() const;
+    bool operator==( const RegexNodeSet& node_set ) const;
+    bool operator<( const RegexNodeSet& node_set ) const;
+    void insert( int index );
+    void insert( const RegexNodeSet& node_set );
+
+    static const int INVALID_INDEX = -1;
+};
+
+}
+
+#endif
@@ -7,6 +7,7 @@
 #include "RegexItem.hpp"
 #include "RegexTransition.hpp"
 #include "assert.hpp"
+#include <algorithm>
 #include <stdio.h>
 
 using namespace lalr;
@@ -22,7 +23,6 @@ RegexState::RegexState()
 : items_(),
   transitions_(),
   symbol_( NULL ),
-  processed_( false ),
   index_( -1 )
 {
 }
@@ -83,37 +83,41 @@ const void* RegexState::get_symbol() const
 }
 
 /**
-// Has this state been processed?
+// Get the index of this state.
 //
 // @return
-//  True if this state has been processed otherwise false.
+//  The index of this state.
 */
-bool RegexState::is_processed() const
+int RegexState::get_index() const
 {
-    return processed_;
+    return index_;
 }
 
 /**
-// Get the index of this state.
+// Hash the items in this state.
 //
 // @return
-//  The index of this state.
+//  The hash of the indices of the nodes in the items of this state.
 */
-int RegexState::get_index() const
+size_t RegexState::hash() const
 {
-    return index_;
+    size_t hash = 0;
+    for ( std::set<RegexItem>::const_iterator item = items_.begin(); item != items_.end(); ++item )
+    {
+        hash = hash * 31 + item->hash();
+    }
+    return hash;
 }
 
 /**
-// Less than operator.
+// Equality operator.
 //
 // @return
-//  True if this items of this state are lexically less than the items of 
-//  \e state.
+//  True if the items of this state are the same as the items of \e state.
 */
-bool RegexState::operator<( const RegexState& state ) const
+bool RegexState::operator==( const RegexState& state ) const
 {
-    return std::lexicographical_compare( items_.begin(), items_.end(), state.items_.begin(), state.items_.end() );
+    return items_.size() == state.items_.size() && std::equal( items_.begin(), items_.end(), state.items_.begin() );
 }
 
 /**
@@ -129,7 +133,7 @@ bool RegexState::operator<( const RegexState& state ) const
 // @return
 //  The number of items added (0 or 1).
 */
-int RegexState::add_item( const std::set<RegexNode*, RegexNodeLess>& next_nodes )
+int RegexState::add_item( const RegexNodeSet& next_nodes )
 {
     return items_.insert( RegexItem(next_nodes) ).second ? 1 : 0;
 }
@@ -145,43 +149,89 @@ int RegexState::add_item( const std::set<RegexNode*, RegexNodeLess>& next_nodes
 //
 // @param end
 //  The end character in the range to transition on.
+//
+// @param syntax_tree
+//  The syntax tree that the nodes in the items of this state belong to.
 */
-void RegexState::add_transition( int begin, int end, RegexState* state )
+void RegexState::add_transition( int begin, int end, RegexState* state, const RegexSyntaxTree& syntax_tree )
 {
     const RegexAction* action = NULL;
     std::set<RegexItem>::const_iterator item = items_.begin();
     while ( item != items_.end() && !action )
     {
-        action = item->find_action_by_interval( begin, end );
+        action = item->find_action_by_interval( begin, end, syntax_tree );
         ++item;
     }
+    add_transition( begin, end, state, action );
+}
 
+/**
+// Add a transition from this state to \e state on [\e begin, \e end) that
+// takes \e action.
+//
+// @param begin
+//  The begin character in the range to transition on.
+//
+// @param end
+//  The end character in the range to transition on.
+//
+// @param state
+//  The state to add a transition to (assumed not null).
+//
+// @param action
+//  The action to take on the transition or null to take no action.
+*/
+void RegexState::add_transition( int begin, int end, RegexState* state, const RegexAction* action )
+{
     bool inserted = transitions_.insert( RegexTransition(begin, end, state, action) ).second;
     LALR_ASSERT( inserted );
     (void) inserted;
 }
 
 /**
-// Set the symbol that this state matches.
+// Replace the states transitioned to from this state.
 //
-// @param symbol
-//  The symbol to set this state as matching (assumed not null).
+// Each transition to a state with index *i* is replaced by a transition to
+// `states_by_index[i]`.  Adjacent transitions that then go to the same
+// state with the same action are merged into a single transition.
+//
+// @param states_by_index
+//  The replacement for each state by index (assumed to contain a non-null 
+//  entry for the index of each state transitioned to from this state).
 */
-void RegexState::set_symbol( const void* symbol )
+void RegexState::replace_transition_states( const std::vector<const RegexState*>& states_by_index )
 {
-    LALR_ASSERT( !symbol_ );
-    symbol_ = symbol;
+    std::set<RegexTransition> transitions;
+    std::set<RegexTransition>::const_iterator transition = transitions_.begin();
+    while ( transition != transitions_.end() )
+    {
+        LALR_ASSERT( transition->state() );
+        LALR_ASSERT( transition->state()->get_index() >= 0 && transition->state()->get_index() < int(states_by_index.size()) );
+        const RegexState* state = states_by_index[transition->state()->get_index()];
+        const RegexAction* action = transition->action();
+        int begin = transition->begin();
+        int end = transition->end();
+        ++transition;
+        while ( transition != transitions_.end() && transition->begin() == end && states_by_index[transition->state()->get_index()] == state && transition->action() == action )
+        {
+            end = transition->end();
+            ++transition;
+        }
+        transitions.insert( RegexTransition(begin, end, state, action) );
+    }
+    transitions_.swap( transitions );
 }
 
 /**
-// Set whether or not this state has been processed.
+// Set the symbol that this state matches.
 //
-// @param processed
-//  True to set this state as processed.
+// @param symbol
+//  The symbol to set this state as matching (assumed not null).
 */
-void RegexState::set_processed( bool processed )
+void RegexState::set_symbol( const void* symbol )
 {
-    processed_ = processed;
+    LALR_ASSERT( !symbol_ );
+    symbol_ = symbol;
 }
 
 /**
@@ -5,11 +5,15 @@
 #include "RegexTransition.hpp"
 #include <string>
 #include <set>
+#include <vector>
+#include <stddef.h>
 
 namespace lalr
 {
 
 class RegexNode;
+class RegexAction;
+class RegexSyntaxTree;
 
 /**
 // A state in a lexical analyzer's state machine.
@@ -19,7 +23,6 @@ class RegexState
     std::set<RegexItem> items_; ///< The items that define the positions within the regular expressions that this state represents.
     std::set<RegexTransition> transitions_; ///< The available transitions from this state to other states.
     const void* symbol_; ///< The symbol that this state recognizes or null if this state doesn't recognize a symbol.
-    bool processed_; ///< True if this state has been processed during state machine generation otherwise false.
     int index_; ///< The index of this state.
 
     public:
@@ -28,13 +31,14 @@ class RegexState
         const RegexTransition* find_transition_by_character( int character ) const;
         const std::set<RegexTransition>& get_transitions() const;
         const void* get_symbol() const;
-        bool is_processed() const;
         int get_index() const;
-        bool operator<( const RegexState& state ) const;
-        int add_item( const std::set<RegexNode*, RegexNodeLess>& next_nodes );
-        void add_transition( int begin, int end, RegexState* state );
+        size_t hash() const;
+        bool operator==( const RegexState& state ) const;
+        int add_item( const RegexNodeSet& next_nodes );
+        void add_transition( int begin, int end, RegexState* state, const RegexSyntaxTree& syntax_tree );
+        void add_transition( int begin, int end, RegexState* state, const RegexAction* action );
+        void replace_transition_states( const std::vector<const RegexState*>& states_by_index );
         void set_symbol( const void* symbol );
-        void set_processed( bool processed );
         void set_index( int index );
 };
 
@@ -0,0 +1,17 @@
+//
+// RegexStateEqual.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "RegexStateEqual.hpp"
+#include "RegexState.hpp"
+#include "assert.hpp"
+
+using namespace lalr;
+
+bool RegexStateEqual::operator()( const RegexState* lhs, const RegexState* rhs ) const
+{
+    LALR_ASSERT( lhs );
+    LALR_ASSERT( rhs );
+    return *lhs == *rhs;
+}
@@ -0,0 +1,20 @@
+#ifndef LALR_REGEXSTATEEQUAL_HPP_INCLUDED
+#define LALR_REGEXSTATEEQUAL_HPP_INCLUDED
+
+namespace lalr
+{
+
+class RegexState;
+
+/**
+// Indirectly compare two states through raw pointers.
+*/
+class RegexStateEqual
+{
+public:
+    bool operator()( const RegexState* lhs, const RegexState* rhs ) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,16 @@
+//
+// RegexStateHash.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "RegexStateHash.hpp"
+#include "RegexState.hpp"
+#include "assert.hpp"
+
+using namespace lalr;
+
+size_t RegexStateHash::operator()( const RegexState* state ) const
+{
+    LALR_ASSERT( state );
+    return state->hash();
+}
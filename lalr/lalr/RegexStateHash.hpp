@@ -0,0 +1,22 @@
+#ifndef LALR_REGEXSTATEHASH_HPP_INCLUDED
+#define LALR_REGEXSTATEHASH_HPP_INCLUDED
+
+#include <stddef.h>
+
+namespace lalr
+{
+
+class RegexState;
+
+/**
+// Indirectly hash a state through a raw pointer.
+*/
+class RegexStateHash
+{
+public:
+    size_t operator()( const RegexState* state ) const;
+};
+
+}
+
+#endif
@@ -6,7 +6,6 @@
 #include "RegexSyntaxTree.hpp"
 #include "RegexParser.hpp"
 #include "RegexNode.hpp"
-#include "RegexNodeLess.hpp"
 #include "RegexCharacter.hpp"
 #include "RegexGenerator.hpp"
 #include "ErrorCode.hpp"
@@ -33,6 +32,7 @@ RegexSyntaxTree::RegexSyntaxTree( const RegexToken& token, RegexGenerator* lexer
   bracket_expression_characters_(),
   index_( 0 ),
   nodes_(),
+  nodes_by_index_(),
   errors_( 0 )
 {
     LALR_ASSERT( lexer_generator_ );
@@ -48,6 +48,7 @@ RegexSyntaxTree::RegexSyntaxTree( const std::vector<RegexToken>& tokens, RegexGe
   bracket_expression_characters_(),
   index_( 0 ),
   nodes_(),
+  nodes_by_index_(),
   errors_( 0 )
 {
     LALR_ASSERT( lexer_generator_ );
@@ -84,6 +85,23 @@ const std::shared_ptr<RegexNode>& RegexSyntaxTree::node() const
     return nodes_.front();
 }
 
+/**
+// Get the node with index \e index.
+//
+// @param index
+//  The index of the node to get (assumed to be the index of a node created
+//  for this syntax tree).
+//
+// @return
+//  The node.
+*/
+RegexNode* RegexSyntaxTree::node_by_index( int index ) const
+{
+    LALR_ASSERT( index >= 0 && index < int(nodes_by_index_.size()) );
+    LALR_ASSERT( nodes_by_index_[index]->get_index() == index );
+    return nodes_by_index_[index].get();
+}
+
 /**
 // Print the regular expression parse tree.
 */
@@ -502,6 +520,7 @@ void RegexSyntaxTree::negative_item_xdigit()
 std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( RegexNodeType type )
 {
     std::shared_ptr<RegexNode> node( new RegexNode(index_, type) );
+    nodes_by_index_.push_back( node );
     ++index_;
     return node;
 }
@@ -522,6 +541,7 @@ std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( RegexNodeType type )
 std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( int begin, int end )
 {
     std::shared_ptr<RegexNode> node( new RegexNode(index_, begin, end) );
+    nodes_by_index_.push_back( node );
     ++index_;
     return node;
 }
@@ -545,6 +565,7 @@ std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( int begin, int end )
 std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( int begin, int end, const RegexToken* token )
 {
     std::shared_ptr<RegexNode> node( new RegexNode(index_, begin, end, token) );
+    nodes_by_index_.push_back( node );
     ++index_;
     return node;
 }
@@ -560,33 +581,30 @@ std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( int begin, int end, cons
 std::shared_ptr<RegexNode> RegexSyntaxTree::regex_node( const RegexAction* action )
 {
     std::shared_ptr<RegexNode> node( new RegexNode(index_, action) );
+    nodes_by_index_.push_back( node );
     ++index_;
     return node;
 }
 
 /**
-// Print the positions represented by the RegexNodes in \e positions.
+// Print the indices of the RegexNodes in \e positions.
 //
 // @param positions
-//  The RegexNodes that are the positions to print.
+//  The positions to print.
 */
-void RegexSyntaxTree::print_positions( const std::set<RegexNode*, RegexNodeLess>& positions ) const
+void RegexSyntaxTree::print_positions( const RegexNodeSet& positions ) const
 {
-    set<RegexNode*, RegexNodeLess>::const_iterator i = positions.begin();
-    if ( i != positions.end() )
+    int i = positions.next( 0 );
+    if ( i != RegexNodeSet::INVALID_INDEX )
     {
-        const RegexNode* node = *i;
-        LALR_ASSERT( node );
-        printf( "%d", node->get_index() );
-        ++i;
+        printf( "%d", i );
+        i = positions.next( i + 1 );
     }
 
-    while ( i != positions.end() )
+    while ( i != RegexNodeSet::INVALID_INDEX )
     {
-        const RegexNode* node = *i;
-        LALR_ASSERT( node );
-        printf( ", %d", node->get_index() );
-        ++i;
+        printf( ", %d", i );
+        i = positions.next( i + 1 );
     }
 }
 
@@ -683,7 +701,7 @@ void RegexSyntaxTree::calculate_nullable_first_last_and_follow()
         node->calculate_nullable();
         node->calculate_first_positions();
         node->calculate_last_positions();
-        node->calculate_follow_positions();
+        node->calculate_follow_positions( *this );
     }
 }
 
@@ -800,7 +818,7 @@ void RegexSyntaxTree::parse_literal( const RegexToken& token )
 // @return
 //  The character value.
 */
-int RegexSyntaxTree::escape( std::string::const_iterator start, std::string::const_iterator end, std::string::const_iterator* next ) const
+int RegexSyntaxTree::escape( std::string::const_iterator start, std::string::const_iterator end, std::string::const_iterator* next )
 {
     int character = *start;
     if ( character == '\\' )
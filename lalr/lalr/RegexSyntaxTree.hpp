@@ -2,7 +2,6 @@
 #define LALR_REGEXSYNTAXTREE_HPP_INCLUDED
 
 #include "RegexCharacter.hpp"
-#include "RegexNodeLess.hpp"
 #include "RegexNodeType.hpp"
 #include "RegexToken.hpp"
 #include <memory>
@@ -16,6 +15,7 @@ namespace lalr
 class RegexGenerator;
 class RegexAction;
 class RegexNode;
+class RegexNodeSet;
 
 /**
 // @internal
@@ -28,6 +28,7 @@ class RegexSyntaxTree
     std::set<RegexCharacter> bracket_expression_characters_; ///< The characters in the current bracket expression.
     int index_; ///< The current node index.
     std::vector<std::shared_ptr<RegexNode> > nodes_; ///< The current nodes.
+    std::vector<std::shared_ptr<RegexNode> > nodes_by_index_; ///< All of the nodes created for this syntax tree indexed by node index.
     int errors_; ///< The number of errors that have occured.
 
     public:
@@ -37,6 +38,7 @@ class RegexSyntaxTree
         bool empty() const;
         int errors() const;
         const std::shared_ptr<RegexNode>& node() const;
+        RegexNode* node_by_index( int index ) const;
         void print() const;
 
         void cat_expression();
@@ -81,13 +83,15 @@ class RegexSyntaxTree
         void negative_item_upper();
         void negative_item_xdigit();
 
+        static int escape( std::string::const_iterator start, std::string::const_iterator end, std::string::const_iterator* next );
+
     private:
         std::shared_ptr<RegexNode> regex_node( RegexNodeType type );
         std::shared_ptr<RegexNode> regex_node( int begin, int end );
         std::shared_ptr<RegexNode> regex_node( int begin, int end, const RegexToken* token );
         std::shared_ptr<RegexNode> regex_node( const RegexAction* action );
 
-        void print_positions( const std::set<RegexNode*, RegexNodeLess>& positions ) const;
+        void print_positions( const RegexNodeSet& positions ) const;
         void print_nodes( const std::vector<std::shared_ptr<RegexNode> >& nodes, int level ) const;
 
         void calculate_symbols_for_characters_start_and_end();
@@ -96,7 +100,6 @@ class RegexSyntaxTree
         void parse_regular_expression( const RegexToken& token );
         void parse_literal( const RegexToken& token );
 
-        int escape( std::string::const_iterator start, std::string::const_iterator end, std::string::const_iterator* next ) const;
         void insert_characters( int begin, int end );
         void erase_characters( int begin, int end );
         void insert_characters( const char* characters );
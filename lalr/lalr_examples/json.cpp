@@ -63,89 +63,118 @@ const ParserSymbol symbols [] =
 
 const ParserTransition transitions [] = 
 {
-    {&symbols[3], &states[1], nullptr, 0, 0, -1, (TransitionType) 0, 0},
-    {&symbols[4], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 1},
-    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, (TransitionType) 1, 2},
-    {&symbols[5], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 3},
-    {&symbols[16], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 4},
-    {&symbols[6], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 5},
-    {&symbols[1], nullptr, &symbols[3], 3, 0, 0, (TransitionType) 1, 6},
-    {&symbols[5], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 7},
-    {&symbols[8], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 8},
-    {&symbols[10], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 9},
-    {&symbols[11], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 10},
-    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 11},
-    {&symbols[5], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 12},
-    {&symbols[10], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 13},
-    {&symbols[11], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 14},
-    {&symbols[16], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 15},
-    {&symbols[7], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 16},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 17},
-    {&symbols[4], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 18},
-    {&symbols[4], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 19},
-    {&symbols[12], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 20},
-    {&symbols[13], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 21},
-    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 22},
-    {&symbols[15], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 23},
-    {&symbols[16], &states[23], nullptr, 0, 0, -1, (TransitionType) 0, 24},
-    {&symbols[17], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 25},
-    {&symbols[18], &states[22], nullptr, 0, 0, -1, (TransitionType) 0, 26},
-    {&symbols[6], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 27},
-    {&symbols[9], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 28},
-    {&symbols[6], nullptr, &symbols[5], 5, 0, 1, (TransitionType) 1, 29},
-    {&symbols[9], nullptr, &symbols[5], 5, 0, 1, (TransitionType) 1, 30},
-    {&symbols[6], nullptr, &symbols[8], 3, 0, 2, (TransitionType) 1, 31},
-    {&symbols[9], nullptr, &symbols[8], 3, 0, 2, (TransitionType) 1, 32},
-    {&symbols[6], nullptr, &symbols[8], 1, 0, 3, (TransitionType) 1, 33},
-    {&symbols[9], nullptr, &symbols[8], 1, 0, 3, (TransitionType) 1, 34},
-    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 35},
-    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 36},
-    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 37},
-    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, (TransitionType) 1, 38},
-    {&symbols[6], nullptr, &symbols[11], 3, 0, 5, (TransitionType) 1, 39},
-    {&symbols[9], nullptr, &symbols[11], 3, 0, 5, (TransitionType) 1, 40},
-    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 41},
-    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 42},
-    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 43},
-    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 44},
-    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 45},
-    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 46},
-    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 47},
-    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 48},
-    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 49},
-    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 50},
-    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 51},
-    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, (TransitionType) 1, 52},
-    {nullptr, nullptr, nullptr, 0, 0, 0, (TransitionType) 0, -1}
+    {&symbols[3], &states[1], nullptr, 0, 0, -1, -1, (TransitionType) 0, 0},
+    {&symbols[4], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 1},
+    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, 0, (TransitionType) 1, 2},
+    {&symbols[5], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 3},
+    {&symbols[16], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 4},
+    {&symbols[6], &states[5], nullptr, 0, 0, -1, -1, (TransitionType) 0, 5},
+    {&symbols[7], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 6},
+    {&symbols[1], nullptr, &symbols[3], 3, 0, 0, 1, (TransitionType) 1, 7},
+    {&symbols[4], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 8},
+    {&symbols[5], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 9},
+    {&symbols[8], &states[9], nullptr, 0, 0, -1, -1, (TransitionType) 0, 10},
+    {&symbols[10], &states[10], nullptr, 0, 0, -1, -1, (TransitionType) 0, 11},
+    {&symbols[11], &states[11], nullptr, 0, 0, -1, -1, (TransitionType) 0, 12},
+    {&symbols[16], &states[12], nullptr, 0, 0, -1, -1, (TransitionType) 0, 13},
+    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, 6, (TransitionType) 1, 14},
+    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, 6, (TransitionType) 1, 15},
+    {&symbols[6], &states[13], nullptr, 0, 0, -1, -1, (TransitionType) 0, 16},
+    {&symbols[9], &states[14], nullptr, 0, 0, -1, -1, (TransitionType) 0, 17},
+    {&symbols[6], nullptr, &symbols[8], 1, 0, 3, 4, (TransitionType) 1, 18},
+    {&symbols[9], nullptr, &symbols[8], 1, 0, 3, 4, (TransitionType) 1, 19},
+    {&symbols[6], nullptr, &symbols[10], 1, 0, 4, 5, (TransitionType) 1, 20},
+    {&symbols[9], nullptr, &symbols[10], 1, 0, 4, 5, (TransitionType) 1, 21},
+    {&symbols[7], &states[15], nullptr, 0, 0, -1, -1, (TransitionType) 0, 22},
+    {&symbols[6], nullptr, &symbols[5], 5, 0, 1, 2, (TransitionType) 1, 23},
+    {&symbols[9], nullptr, &symbols[5], 5, 0, 1, 2, (TransitionType) 1, 24},
+    {&symbols[5], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 25},
+    {&symbols[10], &states[16], nullptr, 0, 0, -1, -1, (TransitionType) 0, 26},
+    {&symbols[11], &states[11], nullptr, 0, 0, -1, -1, (TransitionType) 0, 27},
+    {&symbols[16], &states[12], nullptr, 0, 0, -1, -1, (TransitionType) 0, 28},
+    {&symbols[4], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 29},
+    {&symbols[12], &states[17], nullptr, 0, 0, -1, -1, (TransitionType) 0, 30},
+    {&symbols[13], &states[18], nullptr, 0, 0, -1, -1, (TransitionType) 0, 31},
+    {&symbols[14], &states[19], nullptr, 0, 0, -1, -1, (TransitionType) 0, 32},
+    {&symbols[15], &states[20], nullptr, 0, 0, -1, -1, (TransitionType) 0, 33},
+    {&symbols[16], &states[21], nullptr, 0, 0, -1, -1, (TransitionType) 0, 34},
+    {&symbols[17], &states[22], nullptr, 0, 0, -1, -1, (TransitionType) 0, 35},
+    {&symbols[18], &states[23], nullptr, 0, 0, -1, -1, (TransitionType) 0, 36},
+    {&symbols[6], nullptr, &symbols[8], 3, 0, 2, 3, (TransitionType) 1, 37},
+    {&symbols[9], nullptr, &symbols[8], 3, 0, 2, 3, (TransitionType) 1, 38},
+    {&symbols[6], nullptr, &symbols[11], 3, 0, 5, 7, (TransitionType) 1, 39},
+    {&symbols[9], nullptr, &symbols[11], 3, 0, 5, 7, (TransitionType) 1, 40},
+    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, 8, (TransitionType) 1, 41},
+    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, 8, (TransitionType) 1, 42},
+    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, 9, (TransitionType) 1, 43},
+    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, 9, (TransitionType) 1, 44},
+    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, 10, (TransitionType) 1, 45},
+    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, 10, (TransitionType) 1, 46},
+    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, 13, (TransitionType) 1, 47},
+    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, 13, (TransitionType) 1, 48},
+    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, 11, (TransitionType) 1, 49},
+    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, 11, (TransitionType) 1, 50},
+    {&symbols[6], nullptr, &symbols[12], 1, 0, 6, 12, (TransitionType) 1, 51},
+    {&symbols[9], nullptr, &symbols[12], 1, 0, 6, 12, (TransitionType) 1, 52},
+    {nullptr, nullptr, nullptr, 0, 0, 0, -1, (TransitionType) 0, -1}
 };
 
 const ParserState states [] = 
 {
-    {0, 2, &transitions[0]},
-    {1, 1, &transitions[2]},
-    {2, 2, &transitions[3]},
-    {3, 1, &transitions[5]},
-    {4, 1, &transitions[6]},
-    {5, 5, &transitions[7]},
-    {6, 4, &transitions[12]},
-    {7, 1, &transitions[16]},
-    {8, 1, &transitions[17]},
-    {9, 1, &transitions[18]},
-    {10, 8, &transitions[19]},
-    {11, 2, &transitions[27]},
-    {12, 2, &transitions[29]},
-    {13, 2, &transitions[31]},
-    {14, 2, &transitions[33]},
-    {15, 2, &transitions[35]},
-    {16, 2, &transitions[37]},
-    {17, 2, &transitions[39]},
-    {18, 2, &transitions[41]},
-    {19, 2, &transitions[43]},
-    {20, 2, &transitions[45]},
-    {21, 2, &transitions[47]},
-    {22, 2, &transitions[49]},
-    {23, 2, &transitions[51]},
-    {-1, 0, nullptr}
+    {0, 2, &transitions[0], nullptr},
+    {1, 1, &transitions[2], nullptr},
+    {2, 2, &transitions[3], nullptr},
+    {3, 1, &transitions[5], nullptr},
+    {4, 1, &transitions[6], nullptr},
+    {5, 1, &transitions[7], &transitions[7]},
+    {6, 1, &transitions[8], nullptr},
+    {7, 5, &transitions[9], nullptr},
+    {8, 2, &transitions[14], &transitions[14]},
+    {9, 2, &transitions[16], nullptr},
+    {10, 2, &transitions[18], &transitions[18]},
+    {11, 2, &transitions[20], &transitions[20]},
+    {12, 1, &transitions[22], nullptr},
+    {13, 2, &transitions[23], &transitions[23]},
+    {14, 4, &transitions[25], nullptr},
+    {15, 8, &transitions[29], nullptr},
+    {16, 2, &transitions[37], &transitions[37]},
+    {17, 2, &transitions[39], &transitions[39]},
+    {18, 2, &transitions[41], &transitions[41]},
+    {19, 2, &transitions[43], &transitions[43]},
+    {20, 2, &transitions[45], &transitions[45]},
+    {21, 2, &transitions[47], &transitions[47]},
+    {22, 2, &transitions[49], &transitions[49]},
+    {23, 2, &transitions[51], &transitions[51]},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int transition_table [] = 
+{
+    -1, -1, -1, 0, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1,
+    -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 9, -1, -1, 10, -1, 11, 12, -1, -1, -1, -1, 13, -1, -1,
+    -1, -1, -1, -1, -1, -1, 14, -1, -1, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 16, -1, -1, 17, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 18, -1, -1, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 20, -1, -1, 21, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 23, -1, -1, 24, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 25, -1, -1, -1, -1, 26, 27, -1, -1, -1, -1, 28, -1, -1,
+    -1, -1, -1, -1, 29, -1, -1, -1, -1, -1, -1, -1, 30, 31, 32, 33, 34, 35, 36,
+    -1, -1, -1, -1, -1, -1, 37, -1, -1, 38, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 39, -1, -1, 40, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 41, -1, -1, 42, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 43, -1, -1, 44, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 45, -1, -1, 46, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 47, -1, -1, 48, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 49, -1, -1, 50, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 51, -1, -1, 52, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1
 };
 
 const LexerAction lexer_actions [] = 
@@ -156,49 +185,49 @@ const LexerAction lexer_actions [] =
 
 const LexerTransition lexer_transitions [] = 
 {
-    {34, 35, &lexer_states[24], nullptr},
-    {39, 40, &lexer_states[24], nullptr},
-    {43, 44, &lexer_states[27], nullptr},
-    {44, 45, &lexer_states[10], nullptr},
-    {45, 46, &lexer_states[27], nullptr},
-    {46, 47, &lexer_states[1], nullptr},
-    {48, 58, &lexer_states[26], nullptr},
-    {58, 59, &lexer_states[9], nullptr},
-    {102, 103, &lexer_states[19], nullptr},
-    {110, 111, &lexer_states[11], nullptr},
-    {116, 117, &lexer_states[15], nullptr},
-    {123, 124, &lexer_states[7], nullptr},
-    {125, 126, &lexer_states[8], nullptr},
-    {101, 102, &lexer_states[2], nullptr},
-    {114, 115, &lexer_states[3], nullptr},
-    {114, 115, &lexer_states[4], nullptr},
-    {111, 112, &lexer_states[5], nullptr},
-    {114, 115, &lexer_states[6], nullptr},
-    {117, 118, &lexer_states[12], nullptr},
-    {108, 109, &lexer_states[13], nullptr},
-    {108, 109, &lexer_states[14], nullptr},
-    {114, 115, &lexer_states[16], nullptr},
+    {34, 35, &lexer_states[1], nullptr},
+    {39, 40, &lexer_states[1], nullptr},
+    {43, 44, &lexer_states[2], nullptr},
+    {44, 45, &lexer_states[3], nullptr},
+    {45, 46, &lexer_states[2], nullptr},
+    {46, 47, &lexer_states[4], nullptr},
+    {48, 58, &lexer_states[5], nullptr},
+    {58, 59, &lexer_states[6], nullptr},
+    {102, 103, &lexer_states[7], nullptr},
+    {110, 111, &lexer_states[8], nullptr},
+    {116, 117, &lexer_states[9], nullptr},
+    {123, 124, &lexer_states[10], nullptr},
+    {125, 126, &lexer_states[11], nullptr},
+    {0, 2147483647, &lexer_states[12], &lexer_actions[0]},
+    {48, 58, &lexer_states[5], nullptr},
+    {101, 102, &lexer_states[13], nullptr},
+    {46, 47, &lexer_states[14], nullptr},
+    {48, 58, &lexer_states[5], nullptr},
+    {69, 70, &lexer_states[15], nullptr},
+    {101, 102, &lexer_states[15], nullptr},
+    {97, 98, &lexer_states[16], nullptr},
     {117, 118, &lexer_states[17], nullptr},
-    {101, 102, &lexer_states[18], nullptr},
-    {97, 98, &lexer_states[20], nullptr},
-    {108, 109, &lexer_states[21], nullptr},
-    {115, 116, &lexer_states[22], nullptr},
-    {101, 102, &lexer_states[23], nullptr},
-    {0, 2147483647, &lexer_states[25], &lexer_actions[0]},
-    {46, 47, &lexer_states[28], nullptr},
-    {48, 58, &lexer_states[26], nullptr},
-    {69, 70, &lexer_states[30], nullptr},
-    {101, 102, &lexer_states[30], nullptr},
-    {48, 58, &lexer_states[26], nullptr},
-    {48, 58, &lexer_states[29], nullptr},
-    {48, 58, &lexer_states[29], nullptr},
-    {69, 70, &lexer_states[30], nullptr},
-    {101, 102, &lexer_states[30], nullptr},
-    {43, 44, &lexer_states[31], nullptr},
-    {45, 46, &lexer_states[31], nullptr},
-    {48, 58, &lexer_states[32], nullptr},
-    {48, 58, &lexer_states[32], nullptr},
-    {48, 58, &lexer_states[32], nullptr},
+    {114, 115, &lexer_states[18], nullptr},
+    {114, 115, &lexer_states[19], nullptr},
+    {48, 58, &lexer_states[20], nullptr},
+    {43, 44, &lexer_states[21], nullptr},
+    {45, 46, &lexer_states[21], nullptr},
+    {48, 58, &lexer_states[22], nullptr},
+    {108, 109, &lexer_states[23], nullptr},
+    {108, 109, &lexer_states[24], nullptr},
+    {117, 118, &lexer_states[25], nullptr},
+    {114, 115, &lexer_states[26], nullptr},
+    {48, 58, &lexer_states[20], nullptr},
+    {69, 70, &lexer_states[15], nullptr},
+    {101, 102, &lexer_states[15], nullptr},
+    {48, 58, &lexer_states[22], nullptr},
+    {48, 58, &lexer_states[22], nullptr},
+    {115, 116, &lexer_states[27], nullptr},
+    {108, 109, &lexer_states[28], nullptr},
+    {101, 102, &lexer_states[29], nullptr},
+    {111, 112, &lexer_states[30], nullptr},
+    {101, 102, &lexer_states[31], nullptr},
+    {114, 115, &lexer_states[32], nullptr},
     {-1, -1, nullptr, nullptr}
 };
 
@@ -207,39 +236,135 @@ const LexerState lexer_states [] =
     {0, 13, &lexer_transitions[0], nullptr},
     {1, 1, &lexer_transitions[13], nullptr},
     {2, 1, &lexer_transitions[14], nullptr},
-    {3, 1, &lexer_transitions[15], nullptr},
-    {4, 1, &lexer_transitions[16], nullptr},
-    {5, 1, &lexer_transitions[17], nullptr},
-    {6, 0, &lexer_transitions[18], &symbols[2]},
-    {7, 0, &lexer_transitions[18], &symbols[4]},
-    {8, 0, &lexer_transitions[18], &symbols[6]},
-    {9, 0, &lexer_transitions[18], &symbols[7]},
-    {10, 0, &lexer_transitions[18], &symbols[9]},
-    {11, 1, &lexer_transitions[18], nullptr},
-    {12, 1, &lexer_transitions[19], nullptr},
-    {13, 1, &lexer_transitions[20], nullptr},
-    {14, 0, &lexer_transitions[21], &symbols[13]},
-    {15, 1, &lexer_transitions[21], nullptr},
-    {16, 1, &lexer_transitions[22], nullptr},
-    {17, 1, &lexer_transitions[23], nullptr},
-    {18, 0, &lexer_transitions[24], &symbols[14]},
-    {19, 1, &lexer_transitions[24], nullptr},
-    {20, 1, &lexer_transitions[25], nullptr},
-    {21, 1, &lexer_transitions[26], nullptr},
-    {22, 1, &lexer_transitions[27], nullptr},
-    {23, 0, &lexer_transitions[28], &symbols[15]},
-    {24, 1, &lexer_transitions[28], nullptr},
-    {25, 0, &lexer_transitions[29], &symbols[16]},
-    {26, 4, &lexer_transitions[29], &symbols[17]},
-    {27, 1, &lexer_transitions[33], nullptr},
-    {28, 1, &lexer_transitions[34], nullptr},
-    {29, 3, &lexer_transitions[35], &symbols[18]},
-    {30, 3, &lexer_transitions[38], nullptr},
-    {31, 1, &lexer_transitions[41], nullptr},
-    {32, 1, &lexer_transitions[42], &symbols[18]},
+    {3, 0, &lexer_transitions[15], &symbols[9]},
+    {4, 1, &lexer_transitions[15], nullptr},
+    {5, 4, &lexer_transitions[16], &symbols[17]},
+    {6, 0, &lexer_transitions[20], &symbols[7]},
+    {7, 1, &lexer_transitions[20], nullptr},
+    {8, 1, &lexer_transitions[21], nullptr},
+    {9, 1, &lexer_transitions[22], nullptr},
+    {10, 0, &lexer_transitions[23], &symbols[4]},
+    {11, 0, &lexer_transitions[23], &symbols[6]},
+    {12, 0, &lexer_transitions[23], &symbols[16]},
+    {13, 1, &lexer_transitions[23], nullptr},
+    {14, 1, &lexer_transitions[24], nullptr},
+    {15, 3, &lexer_transitions[25], nullptr},
+    {16, 1, &lexer_transitions[28], nullptr},
+    {17, 1, &lexer_transitions[29], nullptr},
+    {18, 1, &lexer_transitions[30], nullptr},
+    {19, 1, &lexer_transitions[31], nullptr},
+    {20, 3, &lexer_transitions[32], &symbols[18]},
+    {21, 1, &lexer_transitions[35], nullptr},
+    {22, 1, &lexer_transitions[36], &symbols[18]},
+    {23, 1, &lexer_transitions[37], nullptr},
+    {24, 1, &lexer_transitions[38], nullptr},
+    {25, 1, &lexer_transitions[39], nullptr},
+    {26, 1, &lexer_transitions[40], nullptr},
+    {27, 1, &lexer_transitions[41], nullptr},
+    {28, 0, &lexer_transitions[42], &symbols[13]},
+    {29, 0, &lexer_transitions[42], &symbols[14]},
+    {30, 1, &lexer_transitions[42], nullptr},
+    {31, 0, &lexer_transitions[43], &symbols[15]},
+    {32, 0, &lexer_transitions[43], &symbols[2]},
     {-1, 0, nullptr, nullptr}
 };
 
+const int lexer_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 2, 3, 2, 4, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 0, 0, 0, 9, 10, 0, 0, 0, 0, 0, 11, 0, 12, 13,
+    0, 0, 14, 15, 16, 17, 0, 0, 0, 0, 0, 18, 0, 19, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int lexer_class_transitions [] = 
+{
+    -1, 0, 2, 3, 5, 6, 7, -1, -1, -1, 8, -1, 9, -1, -1, -1, 10, -1, 11, 12,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 16, 17, -1, 18, -1, 19, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 20, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 21, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 23, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 24, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 25, -1, -1, 27, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 28, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 29, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 30, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 31, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 32, -1, 33, -1, 34, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 35, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, 36, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 37, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 38, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 39, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 40, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 41, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 42, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1
+};
+
+const int lexer_loop_ranges [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    48, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    48, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    48, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1
+};
+
 const LexerStateMachine lexer_state_machine = 
 {
     1, // #actions
@@ -248,7 +373,12 @@ const LexerStateMachine lexer_state_machine =
     lexer_actions, // actions
     lexer_transitions, // transitions
     lexer_states, // states
-    &lexer_states[0] // start state
+    &lexer_states[0], // start state
+    20, // #classes
+    lexer_classes, // classes
+    lexer_class_transitions, // class transitions
+    lexer_loop_ranges, // loop ranges
+    nullptr // whitespace symbol
 };
 
 const LexerAction whitespace_lexer_actions [] = 
@@ -270,6 +400,38 @@ const LexerState whitespace_lexer_states [] =
     {-1, 0, nullptr, nullptr}
 };
 
+const int whitespace_lexer_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int whitespace_lexer_class_transitions [] = 
+{
+    -1, 0,
+    -1
+};
+
+const int whitespace_lexer_loop_ranges [] = 
+{
+    9, 11, 13, 14, 32, 33, 0, 0,
+    -1
+};
+
 const LexerStateMachine whitespace_lexer_state_machine = 
 {
     0, // #actions
@@ -278,7 +440,12 @@ const LexerStateMachine whitespace_lexer_state_machine =
     whitespace_lexer_actions, // actions
     whitespace_lexer_transitions, // transitions
     whitespace_lexer_states, // states
-    &whitespace_lexer_states[0] // start state
+    &whitespace_lexer_states[0], // start state
+    2, // #classes
+    whitespace_lexer_classes, // classes
+    whitespace_lexer_class_transitions, // class transitions
+    whitespace_lexer_loop_ranges, // loop ranges
+    nullptr // whitespace symbol
 };
 
 const ParserStateMachine parser_state_machine = 
@@ -297,7 +464,13 @@ const ParserStateMachine parser_state_machine =
     &symbols[2], // error symbol
     &states[0], // start state
     &lexer_state_machine, // lexer state machine
-    &whitespace_lexer_state_machine // whitespace lexer state machine
+    &whitespace_lexer_state_machine, // whitespace lexer state machine
+    transition_table, // transition table
+    0, // #compressed
+    nullptr, // compressed base
+    nullptr, // compressed check
+    nullptr, // compressed next
+    nullptr, // default transitions
 };
 
 }
@@ -35,7 +35,7 @@ static int compound( const ParserNode<int>* start, const ParserNode<int>* finish
 
 static int integer( const ParserNode<int>* start, const ParserNode<int>* finish )
 {
-    return ::atoi( start[0].lexeme().c_str() );
+    return ::atoi( string(start[0].lexeme()).c_str() );
 }
 
 void lalr_calculator_example()
@@ -14,7 +14,7 @@ struct Attribute
     std::string name_;
     std::string value_;
     
-    Attribute( const std::string& value )
+    Attribute( std::string_view value )
     : name_(),
       value_( value )
     {
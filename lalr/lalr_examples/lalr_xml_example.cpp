@@ -12,7 +12,7 @@ struct Attribute
     std::string name_;
     std::string value_;
     
-    Attribute( const std::string& name, const std::string& value )
+    Attribute( std::string_view name, std::string_view value )
     : name_( name ),
       value_( value )
     {
@@ -63,94 +63,122 @@ const ParserSymbol symbols [] =
 
 const ParserTransition transitions [] = 
 {
-    {&symbols[3], nullptr, &symbols[6], 0, 0, -1, (TransitionType) 1, 0},
-    {&symbols[5], &states[1], nullptr, 0, 0, -1, (TransitionType) 0, 1},
-    {&symbols[6], &states[2], nullptr, 0, 0, -1, (TransitionType) 0, 2},
-    {&symbols[8], &states[4], nullptr, 0, 0, -1, (TransitionType) 0, 3},
-    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, (TransitionType) 1, 4},
-    {&symbols[3], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 5},
-    {&symbols[7], &states[3], nullptr, 0, 0, -1, (TransitionType) 0, 6},
-    {&symbols[1], nullptr, &symbols[5], 2, 0, 0, (TransitionType) 1, 7},
-    {&symbols[9], &states[5], nullptr, 0, 0, -1, (TransitionType) 0, 8},
-    {&symbols[10], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 9},
-    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 10},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 11},
-    {&symbols[10], &states[6], nullptr, 0, 0, -1, (TransitionType) 0, 12},
-    {&symbols[14], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 13},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 14},
-    {&symbols[3], nullptr, &symbols[6], 3, 0, -1, (TransitionType) 1, 15},
-    {&symbols[3], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 16},
-    {&symbols[7], &states[10], nullptr, 0, 0, -1, (TransitionType) 0, 17},
-    {&symbols[11], &states[8], nullptr, 0, 0, -1, (TransitionType) 0, 18},
-    {&symbols[13], nullptr, &symbols[11], 0, 1, -1, (TransitionType) 1, 19},
-    {&symbols[3], &states[11], nullptr, 0, 0, -1, (TransitionType) 0, 20},
-    {&symbols[7], &states[9], nullptr, 0, 0, -1, (TransitionType) 0, 21},
-    {&symbols[13], &states[15], nullptr, 0, 0, -1, (TransitionType) 0, 22},
-    {&symbols[3], nullptr, &symbols[11], 2, 0, 1, (TransitionType) 1, 23},
-    {&symbols[13], nullptr, &symbols[11], 2, 0, 1, (TransitionType) 1, 24},
-    {&symbols[3], nullptr, &symbols[11], 1, 0, 2, (TransitionType) 1, 25},
-    {&symbols[13], nullptr, &symbols[11], 1, 0, 2, (TransitionType) 1, 26},
-    {&symbols[16], &states[12], nullptr, 0, 0, -1, (TransitionType) 0, 27},
-    {&symbols[4], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 28},
-    {&symbols[9], &states[13], nullptr, 0, 0, -1, (TransitionType) 0, 29},
-    {&symbols[12], nullptr, &symbols[9], 0, 2, -1, (TransitionType) 1, 30},
-    {&symbols[14], &states[19], nullptr, 0, 0, -1, (TransitionType) 0, 31},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 32},
-    {&symbols[4], &states[7], nullptr, 0, 0, -1, (TransitionType) 0, 33},
-    {&symbols[12], &states[14], nullptr, 0, 0, -1, (TransitionType) 0, 34},
-    {&symbols[14], &states[18], nullptr, 0, 0, -1, (TransitionType) 0, 35},
-    {&symbols[16], &states[20], nullptr, 0, 0, -1, (TransitionType) 0, 36},
-    {&symbols[1], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 37},
-    {&symbols[3], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 38},
-    {&symbols[13], nullptr, &symbols[7], 4, 0, 3, (TransitionType) 1, 39},
-    {&symbols[16], &states[16], nullptr, 0, 0, -1, (TransitionType) 0, 40},
-    {&symbols[4], &states[17], nullptr, 0, 0, -1, (TransitionType) 0, 41},
-    {&symbols[1], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 42},
-    {&symbols[3], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 43},
-    {&symbols[13], nullptr, &symbols[7], 8, 1, 4, (TransitionType) 1, 44},
-    {&symbols[4], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 45},
-    {&symbols[10], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 46},
-    {&symbols[12], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 47},
-    {&symbols[16], nullptr, &symbols[9], 2, 0, 5, (TransitionType) 1, 48},
-    {&symbols[4], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 49},
-    {&symbols[10], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 50},
-    {&symbols[12], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 51},
-    {&symbols[16], nullptr, &symbols[9], 1, 0, 6, (TransitionType) 1, 52},
-    {&symbols[15], &states[21], nullptr, 0, 0, -1, (TransitionType) 0, 53},
-    {&symbols[17], &states[22], nullptr, 0, 0, -1, (TransitionType) 0, 54},
-    {&symbols[4], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 55},
-    {&symbols[10], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 56},
-    {&symbols[12], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 57},
-    {&symbols[16], nullptr, &symbols[14], 3, 0, 7, (TransitionType) 1, 58},
-    {nullptr, nullptr, nullptr, 0, 0, 0, (TransitionType) 0, -1}
+    {&symbols[3], nullptr, &symbols[6], 0, 0, -1, 3, (TransitionType) 1, 0},
+    {&symbols[5], &states[1], nullptr, 0, 0, -1, -1, (TransitionType) 0, 1},
+    {&symbols[6], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 2},
+    {&symbols[8], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 3},
+    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, 0, (TransitionType) 1, 4},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 5},
+    {&symbols[7], &states[5], nullptr, 0, 0, -1, -1, (TransitionType) 0, 6},
+    {&symbols[9], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 7},
+    {&symbols[10], nullptr, &symbols[9], 0, 2, -1, 11, (TransitionType) 1, 8},
+    {&symbols[14], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 9},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 10},
+    {&symbols[16], &states[9], nullptr, 0, 0, -1, -1, (TransitionType) 0, 11},
+    {&symbols[1], nullptr, &symbols[5], 2, 0, 0, 1, (TransitionType) 1, 12},
+    {&symbols[10], &states[10], nullptr, 0, 0, -1, -1, (TransitionType) 0, 13},
+    {&symbols[14], &states[11], nullptr, 0, 0, -1, -1, (TransitionType) 0, 14},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 15},
+    {&symbols[4], nullptr, &symbols[9], 1, 0, 6, 10, (TransitionType) 1, 16},
+    {&symbols[10], nullptr, &symbols[9], 1, 0, 6, 10, (TransitionType) 1, 17},
+    {&symbols[12], nullptr, &symbols[9], 1, 0, 6, 10, (TransitionType) 1, 18},
+    {&symbols[16], nullptr, &symbols[9], 1, 0, 6, 10, (TransitionType) 1, 19},
+    {&symbols[15], &states[12], nullptr, 0, 0, -1, -1, (TransitionType) 0, 20},
+    {&symbols[4], nullptr, &symbols[9], 0, 2, -1, 11, (TransitionType) 1, 21},
+    {&symbols[9], &states[13], nullptr, 0, 0, -1, -1, (TransitionType) 0, 22},
+    {&symbols[12], nullptr, &symbols[9], 0, 2, -1, 11, (TransitionType) 1, 23},
+    {&symbols[14], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 24},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 25},
+    {&symbols[3], nullptr, &symbols[6], 3, 0, -1, 2, (TransitionType) 1, 26},
+    {&symbols[4], nullptr, &symbols[9], 2, 0, 5, 9, (TransitionType) 1, 27},
+    {&symbols[10], nullptr, &symbols[9], 2, 0, 5, 9, (TransitionType) 1, 28},
+    {&symbols[12], nullptr, &symbols[9], 2, 0, 5, 9, (TransitionType) 1, 29},
+    {&symbols[16], nullptr, &symbols[9], 2, 0, 5, 9, (TransitionType) 1, 30},
+    {&symbols[17], &states[14], nullptr, 0, 0, -1, -1, (TransitionType) 0, 31},
+    {&symbols[4], &states[15], nullptr, 0, 0, -1, -1, (TransitionType) 0, 32},
+    {&symbols[12], &states[16], nullptr, 0, 0, -1, -1, (TransitionType) 0, 33},
+    {&symbols[14], &states[11], nullptr, 0, 0, -1, -1, (TransitionType) 0, 34},
+    {&symbols[16], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 35},
+    {&symbols[4], nullptr, &symbols[14], 3, 0, 7, 12, (TransitionType) 1, 36},
+    {&symbols[10], nullptr, &symbols[14], 3, 0, 7, 12, (TransitionType) 1, 37},
+    {&symbols[12], nullptr, &symbols[14], 3, 0, 7, 12, (TransitionType) 1, 38},
+    {&symbols[16], nullptr, &symbols[14], 3, 0, 7, 12, (TransitionType) 1, 39},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 40},
+    {&symbols[7], &states[17], nullptr, 0, 0, -1, -1, (TransitionType) 0, 41},
+    {&symbols[11], &states[18], nullptr, 0, 0, -1, -1, (TransitionType) 0, 42},
+    {&symbols[13], nullptr, &symbols[11], 0, 1, -1, 6, (TransitionType) 1, 43},
+    {&symbols[1], nullptr, &symbols[7], 4, 0, 3, 7, (TransitionType) 1, 44},
+    {&symbols[3], nullptr, &symbols[7], 4, 0, 3, 7, (TransitionType) 1, 45},
+    {&symbols[13], nullptr, &symbols[7], 4, 0, 3, 7, (TransitionType) 1, 46},
+    {&symbols[3], nullptr, &symbols[11], 1, 0, 2, 5, (TransitionType) 1, 47},
+    {&symbols[13], nullptr, &symbols[11], 1, 0, 2, 5, (TransitionType) 1, 48},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 49},
+    {&symbols[7], &states[19], nullptr, 0, 0, -1, -1, (TransitionType) 0, 50},
+    {&symbols[13], &states[20], nullptr, 0, 0, -1, -1, (TransitionType) 0, 51},
+    {&symbols[3], nullptr, &symbols[11], 2, 0, 1, 4, (TransitionType) 1, 52},
+    {&symbols[13], nullptr, &symbols[11], 2, 0, 1, 4, (TransitionType) 1, 53},
+    {&symbols[16], &states[21], nullptr, 0, 0, -1, -1, (TransitionType) 0, 54},
+    {&symbols[4], &states[22], nullptr, 0, 0, -1, -1, (TransitionType) 0, 55},
+    {&symbols[1], nullptr, &symbols[7], 8, 1, 4, 8, (TransitionType) 1, 56},
+    {&symbols[3], nullptr, &symbols[7], 8, 1, 4, 8, (TransitionType) 1, 57},
+    {&symbols[13], nullptr, &symbols[7], 8, 1, 4, 8, (TransitionType) 1, 58},
+    {nullptr, nullptr, nullptr, 0, 0, 0, -1, (TransitionType) 0, -1}
 };
 
 const ParserState states [] = 
 {
-    {0, 4, &transitions[0]},
-    {1, 1, &transitions[4]},
-    {2, 2, &transitions[5]},
-    {3, 1, &transitions[7]},
-    {4, 4, &transitions[8]},
-    {5, 3, &transitions[12]},
-    {6, 1, &transitions[15]},
-    {7, 4, &transitions[16]},
-    {8, 3, &transitions[20]},
-    {9, 2, &transitions[23]},
-    {10, 2, &transitions[25]},
-    {11, 1, &transitions[27]},
-    {12, 5, &transitions[28]},
-    {13, 4, &transitions[33]},
-    {14, 3, &transitions[37]},
-    {15, 1, &transitions[40]},
-    {16, 1, &transitions[41]},
-    {17, 3, &transitions[42]},
-    {18, 4, &transitions[45]},
-    {19, 4, &transitions[49]},
-    {20, 1, &transitions[53]},
-    {21, 1, &transitions[54]},
-    {22, 4, &transitions[55]},
-    {-1, 0, nullptr}
+    {0, 4, &transitions[0], nullptr},
+    {1, 1, &transitions[4], nullptr},
+    {2, 2, &transitions[5], nullptr},
+    {3, 4, &transitions[7], nullptr},
+    {4, 1, &transitions[11], nullptr},
+    {5, 1, &transitions[12], &transitions[12]},
+    {6, 3, &transitions[13], nullptr},
+    {7, 4, &transitions[16], &transitions[16]},
+    {8, 1, &transitions[20], nullptr},
+    {9, 5, &transitions[21], nullptr},
+    {10, 1, &transitions[26], &transitions[26]},
+    {11, 4, &transitions[27], &transitions[27]},
+    {12, 1, &transitions[31], nullptr},
+    {13, 4, &transitions[32], nullptr},
+    {14, 4, &transitions[36], &transitions[36]},
+    {15, 4, &transitions[40], nullptr},
+    {16, 3, &transitions[44], &transitions[44]},
+    {17, 2, &transitions[47], &transitions[47]},
+    {18, 3, &transitions[49], nullptr},
+    {19, 2, &transitions[52], &transitions[52]},
+    {20, 1, &transitions[54], nullptr},
+    {21, 1, &transitions[55], nullptr},
+    {22, 3, &transitions[56], &transitions[56]},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int transition_table [] = 
+{
+    -1, -1, -1, 0, -1, 1, 2, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, 5, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, 8, -1, -1, -1, 9, -1, 10, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11, -1,
+    -1, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, -1, -1, -1, 14, -1, 15, -1,
+    -1, -1, -1, -1, 16, -1, -1, -1, -1, -1, 17, -1, 18, -1, -1, -1, 19, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 20, -1, -1,
+    -1, -1, -1, -1, 21, -1, -1, -1, -1, 22, -1, -1, 23, -1, 24, -1, 25, -1,
+    -1, -1, -1, 26, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 27, -1, -1, -1, -1, -1, 28, -1, 29, -1, -1, -1, 30, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 31,
+    -1, -1, -1, -1, 32, -1, -1, -1, -1, -1, -1, -1, 33, -1, 34, -1, 35, -1,
+    -1, -1, -1, -1, 36, -1, -1, -1, -1, -1, 37, -1, 38, -1, -1, -1, 39, -1,
+    -1, -1, -1, 40, -1, -1, -1, 41, -1, -1, -1, 42, -1, 43, -1, -1, -1, -1,
+    -1, 44, -1, 45, -1, -1, -1, -1, -1, -1, -1, -1, -1, 46, -1, -1, -1, -1,
+    -1, -1, -1, 47, -1, -1, -1, -1, -1, -1, -1, -1, -1, 48, -1, -1, -1, -1,
+    -1, -1, -1, 49, -1, -1, -1, 50, -1, -1, -1, -1, -1, 51, -1, -1, -1, -1,
+    -1, -1, -1, 52, -1, -1, -1, -1, -1, -1, -1, -1, -1, 53, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 54, -1,
+    -1, -1, -1, -1, 55, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, 56, -1, 57, -1, -1, -1, -1, -1, -1, -1, -1, -1, 58, -1, -1, -1, -1,
+    -1
 };
 
 const LexerAction lexer_actions [] = 
@@ -161,36 +189,36 @@ const LexerAction lexer_actions [] =
 
 const LexerTransition lexer_transitions [] = 
 {
-    {34, 35, &lexer_states[20], nullptr},
-    {39, 40, &lexer_states[20], nullptr},
-    {46, 47, &lexer_states[1], nullptr},
-    {47, 48, &lexer_states[15], nullptr},
-    {58, 59, &lexer_states[19], nullptr},
-    {60, 61, &lexer_states[7], nullptr},
-    {61, 62, &lexer_states[18], nullptr},
-    {62, 63, &lexer_states[8], nullptr},
+    {34, 35, &lexer_states[1], nullptr},
+    {39, 40, &lexer_states[1], nullptr},
+    {46, 47, &lexer_states[2], nullptr},
+    {47, 48, &lexer_states[3], nullptr},
+    {58, 59, &lexer_states[4], nullptr},
+    {60, 61, &lexer_states[5], nullptr},
+    {61, 62, &lexer_states[6], nullptr},
+    {62, 63, &lexer_states[7], nullptr},
+    {63, 64, &lexer_states[8], nullptr},
+    {65, 91, &lexer_states[4], nullptr},
+    {95, 96, &lexer_states[4], nullptr},
+    {97, 123, &lexer_states[4], nullptr},
+    {0, 2147483647, &lexer_states[9], &lexer_actions[0]},
+    {101, 102, &lexer_states[10], nullptr},
+    {62, 63, &lexer_states[11], nullptr},
+    {45, 47, &lexer_states[4], nullptr},
+    {48, 59, &lexer_states[4], nullptr},
+    {65, 91, &lexer_states[4], nullptr},
+    {95, 96, &lexer_states[4], nullptr},
+    {97, 123, &lexer_states[4], nullptr},
+    {47, 48, &lexer_states[12], nullptr},
     {63, 64, &lexer_states[13], nullptr},
-    {65, 91, &lexer_states[19], nullptr},
-    {95, 96, &lexer_states[19], nullptr},
-    {97, 123, &lexer_states[19], nullptr},
-    {101, 102, &lexer_states[2], nullptr},
-    {114, 115, &lexer_states[3], nullptr},
-    {114, 115, &lexer_states[4], nullptr},
-    {111, 112, &lexer_states[5], nullptr},
-    {114, 115, &lexer_states[6], nullptr},
-    {47, 48, &lexer_states[17], nullptr},
-    {63, 64, &lexer_states[9], nullptr},
-    {120, 121, &lexer_states[10], nullptr},
-    {109, 110, &lexer_states[11], nullptr},
-    {108, 109, &lexer_states[12], nullptr},
     {62, 63, &lexer_states[14], nullptr},
-    {62, 63, &lexer_states[16], nullptr},
-    {45, 47, &lexer_states[19], nullptr},
-    {48, 59, &lexer_states[19], nullptr},
-    {65, 91, &lexer_states[19], nullptr},
-    {95, 96, &lexer_states[19], nullptr},
-    {97, 123, &lexer_states[19], nullptr},
-    {0, 2147483647, &lexer_states[21], &lexer_actions[0]},
+    {114, 115, &lexer_states[15], nullptr},
+    {120, 121, &lexer_states[16], nullptr},
+    {114, 115, &lexer_states[17], nullptr},
+    {109, 110, &lexer_states[18], nullptr},
+    {111, 112, &lexer_states[19], nullptr},
+    {108, 109, &lexer_states[20], nullptr},
+    {114, 115, &lexer_states[21], nullptr},
     {-1, -1, nullptr, nullptr}
 };
 
@@ -200,27 +228,101 @@ const LexerState lexer_states [] =
     {1, 1, &lexer_transitions[12], nullptr},
     {2, 1, &lexer_transitions[13], nullptr},
     {3, 1, &lexer_transitions[14], nullptr},
-    {4, 1, &lexer_transitions[15], nullptr},
-    {5, 1, &lexer_transitions[16], nullptr},
-    {6, 0, &lexer_transitions[17], &symbols[2]},
-    {7, 2, &lexer_transitions[17], &symbols[3]},
-    {8, 0, &lexer_transitions[19], &symbols[4]},
-    {9, 1, &lexer_transitions[19], nullptr},
-    {10, 1, &lexer_transitions[20], nullptr},
-    {11, 1, &lexer_transitions[21], nullptr},
-    {12, 0, &lexer_transitions[22], &symbols[8]},
-    {13, 1, &lexer_transitions[22], nullptr},
-    {14, 0, &lexer_transitions[23], &symbols[10]},
-    {15, 1, &lexer_transitions[23], nullptr},
-    {16, 0, &lexer_transitions[24], &symbols[12]},
-    {17, 0, &lexer_transitions[24], &symbols[13]},
-    {18, 0, &lexer_transitions[24], &symbols[15]},
-    {19, 5, &lexer_transitions[24], &symbols[16]},
-    {20, 1, &lexer_transitions[29], nullptr},
-    {21, 0, &lexer_transitions[30], &symbols[17]},
+    {4, 5, &lexer_transitions[15], &symbols[16]},
+    {5, 2, &lexer_transitions[20], &symbols[3]},
+    {6, 0, &lexer_transitions[22], &symbols[15]},
+    {7, 0, &lexer_transitions[22], &symbols[4]},
+    {8, 1, &lexer_transitions[22], nullptr},
+    {9, 0, &lexer_transitions[23], &symbols[17]},
+    {10, 1, &lexer_transitions[23], nullptr},
+    {11, 0, &lexer_transitions[24], &symbols[12]},
+    {12, 0, &lexer_transitions[24], &symbols[13]},
+    {13, 1, &lexer_transitions[24], nullptr},
+    {14, 0, &lexer_transitions[25], &symbols[10]},
+    {15, 1, &lexer_transitions[25], nullptr},
+    {16, 1, &lexer_transitions[26], nullptr},
+    {17, 1, &lexer_transitions[27], nullptr},
+    {18, 1, &lexer_transitions[28], nullptr},
+    {19, 1, &lexer_transitions[29], nullptr},
+    {20, 0, &lexer_transitions[30], &symbols[8]},
+    {21, 0, &lexer_transitions[30], &symbols[2]},
     {-1, 0, nullptr, nullptr}
 };
 
+const int lexer_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 3, 4,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 0, 6, 7, 8, 9,
+    0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 5,
+    0, 5, 5, 5, 5, 10, 5, 5, 5, 5, 5, 5, 11, 12, 5, 13,
+    5, 5, 14, 5, 5, 5, 5, 5, 15, 5, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int lexer_class_transitions [] = 
+{
+    -1, 0, -1, 2, 3, 4, 5, 6, 7, 8, 11, 11, 11, 11, 11, 11,
+    12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 14, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 15, 15, -1, 16, -1, -1, -1, -1, 19, 19, 19, 19, 19, 19,
+    -1, -1, -1, -1, 20, -1, -1, -1, -1, 21, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 22, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 23, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 24,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 25, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 26, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 27, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 28, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 29, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1
+};
+
+const int lexer_loop_ranges [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    45, 47, 48, 59, 65, 91, 95, 96,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1
+};
+
 const LexerStateMachine lexer_state_machine = 
 {
     1, // #actions
@@ -229,7 +331,12 @@ const LexerStateMachine lexer_state_machine =
     lexer_actions, // actions
     lexer_transitions, // transitions
     lexer_states, // states
-    &lexer_states[0] // start state
+    &lexer_states[0], // start state
+    16, // #classes
+    lexer_classes, // classes
+    lexer_class_transitions, // class transitions
+    lexer_loop_ranges, // loop ranges
+    nullptr // whitespace symbol
 };
 
 const LexerAction whitespace_lexer_actions [] = 
@@ -251,6 +358,38 @@ const LexerState whitespace_lexer_states [] =
     {-1, 0, nullptr, nullptr}
 };
 
+const int whitespace_lexer_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int whitespace_lexer_class_transitions [] = 
+{
+    -1, 0,
+    -1
+};
+
+const int whitespace_lexer_loop_ranges [] = 
+{
+    9, 11, 13, 14, 32, 33, 0, 0,
+    -1
+};
+
 const LexerStateMachine whitespace_lexer_state_machine = 
 {
     0, // #actions
@@ -259,7 +398,12 @@ const LexerStateMachine whitespace_lexer_state_machine =
     whitespace_lexer_actions, // actions
     whitespace_lexer_transitions, // transitions
     whitespace_lexer_states, // states
-    &whitespace_lexer_states[0] // start state
+    &whitespace_lexer_states[0], // start state
+    2, // #classes
+    whitespace_lexer_classes, // classes
+    whitespace_lexer_class_transitions, // class transitions
+    whitespace_lexer_loop_ranges, // loop ranges
+    nullptr // whitespace symbol
 };
 
 const ParserStateMachine parser_state_machine = 
@@ -278,7 +422,13 @@ const ParserStateMachine parser_state_machine =
     &symbols[2], // error symbol
     &states[0], // start state
     &lexer_state_machine, // lexer state machine
-    &whitespace_lexer_state_machine // whitespace lexer state machine
+    &whitespace_lexer_state_machine, // whitespace lexer state machine
+    transition_table, // transition table
+    0, // #compressed
+    nullptr, // compressed base
+    nullptr, // compressed check
+    nullptr, // compressed next
+    nullptr, // default transitions
 };
 
 }
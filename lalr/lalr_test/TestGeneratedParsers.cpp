@@ -0,0 +1,141 @@
+//
+// TestGeneratedParsers.cpp
+// Copyright (c) Charles Baker. All rights reserved.
+//
+
+#include "calculator_actions.hpp"
+#include "calculator_tables.hpp"
+#include <lalr/Parser.ipp>
+#include <lalr/ParserStateMachine.hpp>
+#include <lalr/ParserState.hpp>
+#include <lalr/ParserSymbol.hpp>
+#include <lalr/ParserTransition.hpp>
+#include <UnitTest++/UnitTest++.h>
+#include <string>
+#include <stdlib.h>
+#include <string.h>
+
+using namespace lalr;
+
+SUITE( GeneratedParsers )
+{
+    // Handles the actions of calculator.g through the methods that
+    // calculator_actions.hpp, generated by lalrc --actions, binds to them.
+    struct Calculator
+    {
+        typedef Parser<const char*, int>::ParserNode ParserNode;
+
+        int comments_;
+
+        Calculator()
+        : comments_( 0 )
+        {
+        }
+
+        int add( ParserNode* start, ParserNode* /*finish*/ )
+        {
+            return start[0].user_data() + start[2].user_data();
+        }
+
+        int subtract( ParserNode* start, ParserNode* /*finish*/ )
+        {
+            return start[0].user_data() - start[2].user_data();
+        }
+
+        int multiply( ParserNode* start, ParserNode* /*finish*/ )
+        {
+            return start[0].user_data() * start[2].user_data();
+        }
+
+        int divide( ParserNode* start, ParserNode* /*finish*/ )
+        {
+            return start[0].user_data() / start[2].user_data();
+        }
+
+        int compound( ParserNode* start, ParserNode* /*finish*/ )
+        {
+            return start[1].user_data();
+        }
+
+        int integer( ParserNode* start, ParserNode* /*finish*/ )
+        {
+            return atoi( std::string(start[0].lexeme()).c_str() );
+        }
+
+        void line_comment( const char** begin, const char* end, std::string* lexeme, const void** /*symbol*/ )
+        {
+            lexeme->clear();
+            const char* position = *begin;
+            while ( position != end && *position != '\n' )
+            {
+                ++position;
+            }
+            *begin = position;
+            ++comments_;
+        }
+    };
+
+    TEST( GeneratedActionHandlers )
+    {
+        static_assert( calculator_actions::action_count == 6, "Unexpected number of actions in calculator.g" );
+
+        Calculator calculator;
+        Parser<const char*, int> parser( calculator_parser_state_machine );
+        calculator_actions::bind_action_handlers( &parser, &calculator );
+
+        const char* input =
+            "(1 + 2) * 3 # nine\n"
+            "- 8 / 4 # less two\n"
+        ;
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 7, parser.accepted() ? parser.user_data() : 0 );
+        CHECK_EQUAL( 2, calculator.comments_ );
+    }
+
+    // The start state shifts '(', symbol 8 in calculator.g, and can't be
+    // followed by the end of input, symbol 1.
+    static_assert( calculator_parser_tables::transition_table[0 * calculator_parser_tables::symbols_size + 8] != -1, "No transition on '(' from the start state" );
+    static_assert( calculator_parser_tables::transition_table[0 * calculator_parser_tables::symbols_size + 1] == -1, "Transition on end from the start state" );
+
+    TEST( GeneratedTables )
+    {
+        const ParserStateMachine* state_machine = calculator_parser_state_machine;
+        CHECK_EQUAL( state_machine->states_size, calculator_parser_tables::states_size );
+        CHECK_EQUAL( state_machine->symbols_size, calculator_parser_tables::symbols_size );
+        CHECK_EQUAL( state_machine->transitions_size, calculator_parser_tables::transitions_size );
+        CHECK( strcmp(state_machine->symbols[1].lexeme, ".end") == 0 );
+        CHECK( strcmp(state_machine->symbols[8].lexeme, "(") == 0 );
+
+        int transitions = 0;
+        for ( int i = 0; i < calculator_parser_tables::states_size * calculator_parser_tables::symbols_size; ++i )
+        {
+            transitions += calculator_parser_tables::transition_table[i] != -1 ? 1 : 0;
+        }
+        CHECK_EQUAL( state_machine->transitions_size, transitions );
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            for ( int j = 0; j < state->length; ++j )
+            {
+                const ParserTransition* transition = &state->transitions[j];
+                CHECK_EQUAL( transition->index, calculator_parser_tables::transition_table[state->index * calculator_parser_tables::symbols_size + transition->symbol->index] );
+            }
+        }
+
+        Calculator calculator;
+        Parser<const char*, int, char, std::char_traits<char>, std::allocator<char>, calculator_parser_tables> parser( state_machine );
+        calculator_actions::bind_action_handlers( &parser, &calculator );
+
+        const char* input = "(1 + 2) * 3 - 8 / 4";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 7, parser.accepted() ? parser.user_data() : 0 );
+
+        input = "((1 + 2) * 3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( !parser.accepted() );
+    }
+}
@@ -8,7 +8,12 @@
 #include <lalr/ErrorCode.hpp>
 #include <lalr/GrammarCompiler.hpp>
 #include <lalr/ErrorPolicy.hpp>
+#include <lalr/PositionIterator.hpp>
+#include <lalr/ParserStateMachineFile.hpp>
+#include <lalr/RegexCompiler.hpp>
+#include <lalr/ConstexprGrammar.hpp>
 #include <functional>
+#include <memory>
 #include <UnitTest++/UnitTest++.h>
 #include <string.h>
 
@@ -858,6 +863,283 @@ SUITE( Parsers )
         CHECK( parser.full() );
     }
 
+    TEST( FusedWhitespace )
+    {
+        struct FusedWhitespace
+        {
+            static void block_comment( const char** begin, const char* end, std::string* /*lexeme*/, const void** /*symbol*/ )
+            {
+                LALR_ASSERT( begin );
+                const char* position = *begin;
+                while ( position != end && !(position[0] == '*' && position + 1 != end && position[1] == '/') )
+                {
+                    ++position;
+                }
+                *begin = position != end ? position + 2 : end;
+            }
+        };
+
+        const char* fused_whitespace_grammar = 
+            "FusedWhitespace {\n"
+            "   %whitespace \"([ \\t\\r\\n]|\\/\\*:block_comment:)*\";\n"
+            "   unit: digits;\n"
+            "   digits: digits digit | digit;\n"
+            "   digit: \"[0-9]\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.set_fused_whitespace( true );
+        compiler.compile( fused_whitespace_grammar, fused_whitespace_grammar + strlen(fused_whitespace_grammar) );
+        const ParserStateMachine* compiled_state_machine = compiler.parser_state_machine();
+        CHECK( !compiled_state_machine->whitespace_lexer_state_machine );
+        CHECK( compiled_state_machine->lexer_state_machine->whitespace_symbol );
+
+        const char* filename = "FusedWhitespace.lalr";
+        CHECK( ParserStateMachineFile::save(compiled_state_machine, filename) );
+        ParserStateMachineFile file;
+        CHECK( file.load(filename) );
+        remove( filename );
+
+        const ParserStateMachine* state_machines [] = { compiled_state_machine, file.parser_state_machine() };
+        for ( const ParserStateMachine* state_machine : state_machines )
+        {
+            CHECK( state_machine );
+            if ( state_machine )
+            {
+                Parser<const char*> parser( state_machine );
+                parser.lexer_action_handlers()
+                    ( "block_comment", &FusedWhitespace::block_comment )
+                ;
+
+                const char* input = " 1 2 /* comment\n3 */ 4\n\t5 /**/6 ";
+                parser.parse( input, input + strlen(input) );
+                CHECK( parser.accepted() );
+                CHECK( parser.full() );
+
+                input = "1 2 x";
+                parser.parse( input, input + strlen(input) );
+                CHECK( !parser.accepted() );
+            }
+        }
+    }
+
+    TEST( PlainFunctionActionHandlers )
+    {
+        struct Calculator
+        {
+            int reductions;
+            int strings;
+
+            static int add( void* context, ParserNode<int>* start, ParserNode<int>* /*finish*/ )
+            {
+                ++static_cast<Calculator*>( context )->reductions;
+                return start[0].user_data() + start[2].user_data();
+            }
+
+            static int integer( void* context, ParserNode<int>* start, ParserNode<int>* /*finish*/ )
+            {
+                ++static_cast<Calculator*>( context )->reductions;
+                return atoi( std::string(start[0].lexeme()).c_str() );
+            }
+
+            static int quoted( void* context, ParserNode<int>* start, ParserNode<int>* /*finish*/ )
+            {
+                ++static_cast<Calculator*>( context )->reductions;
+                return int( start[0].lexeme().size() );
+            }
+
+            static void string_lexer( void* context, const char** begin, const char* end, std::string* lexeme, const void** /*symbol*/ )
+            {
+                ++static_cast<Calculator*>( context )->strings;
+                const char* position = *begin;
+                while ( position != end && *position != '\'' )
+                {
+                    *lexeme += *position;
+                    ++position;
+                }
+                if ( position != end )
+                {
+                    ++position;
+                }
+                *begin = position;
+            }
+        };
+
+        const char* calculator_grammar = 
+            "PlainFunctions {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   sum: sum '+' value [add] | value;\n"
+            "   value: integer [integer] | string [quoted];\n"
+            "   integer: \"[0-9]+\";\n"
+            "   string: \"':string:\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( calculator_grammar, calculator_grammar + strlen(calculator_grammar) );
+        Calculator calculator = { 0, 0 };
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.parser_action_handlers()
+            ( "add", &Calculator::add, &calculator )
+            ( "integer", &Calculator::integer, &calculator )
+            ( "quoted", &Calculator::quoted, &calculator )
+        ;
+        parser.lexer_action_handlers()
+            ( "string", &Calculator::string_lexer, &calculator )
+        ;
+
+        const char* input = "1 + 'four' + 23";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 28, parser.user_data() );
+        CHECK_EQUAL( 5, calculator.reductions );
+        CHECK_EQUAL( 1, calculator.strings );
+    }
+
+    TEST( StreamedInput )
+    {
+        const char* streamed_input_grammar = 
+            "StreamedInput {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   sum: sum '+' integer [add] | integer [integer];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( streamed_input_grammar, streamed_input_grammar + strlen(streamed_input_grammar) );
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.parser_action_handlers()
+            ( "add", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data() + atoi(std::string(start[2].lexeme()).c_str()); } )
+            ( "integer", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return atoi(std::string(start[0].lexeme()).c_str()); } )
+        ;
+
+        // Inputs ending part way through a token check that a match 
+        // suspended at the end of the last chunk is finished by 
+        // Parser::feed_end().
+        struct StreamedInput
+        {
+            const char* input;
+            int sum;
+        };
+        const StreamedInput inputs [] =
+        {
+            { " 1 + 23 +  456\n+ 7890 ", 8370 },
+            { "1 + 23", 24 },
+            { "12", 12 },
+            { "1+2", 3 },
+            { "1 + 2 ", 3 }
+        };
+        for ( const StreamedInput& streamed_input : inputs )
+        {
+            const char* input = streamed_input.input;
+            for ( size_t chunk_size = 1; chunk_size <= 8; ++chunk_size )
+            {
+                parser.reset();
+                size_t length = strlen( input );
+                for ( size_t i = 0; i < length; i += chunk_size )
+                {
+                    // Copy each chunk so that lexemes referring to the chunk 
+                    // after it has been fed are caught.
+                    std::string chunk( input + i, std::min(chunk_size, length - i) );
+                    CHECK( parser.feed(chunk.data(), chunk.data() + chunk.size()) );
+                    chunk.assign( chunk.size(), 'x' );
+                }
+                CHECK( !parser.feed_end() );
+                CHECK( parser.accepted() );
+                CHECK( parser.full() );
+                CHECK_EQUAL( streamed_input.sum, parser.accepted() ? parser.user_data() : 0 );
+            }
+        }
+
+        parser.reset();
+        const char* input = "1 + + 2";
+        CHECK( !parser.feed(input, input + strlen(input)) );
+        CHECK( !parser.feed_end() );
+        CHECK( !parser.accepted() );
+    }
+
+    TEST( StreamedLexerActions )
+    {
+        struct StreamedLexerActions
+        {
+            // Match the rest of a string after its opening quote.  The quote
+            // stays at the start of the lexeme until the closing quote is 
+            // found so that the string can be carried on with the next 
+            // chunk when the end of this chunk is reached first.
+            static void string( const char** begin, const char* end, std::string* lexeme, const void** symbol )
+            {
+                const char* position = *begin;
+                char terminator = lexeme->at( 0 );
+                while ( position != end && *position != terminator )
+                {
+                    *lexeme += *position;
+                    ++position;
+                }
+                if ( position != end )
+                {
+                    lexeme->erase( 0, 1 );
+                    ++position;
+                }
+                else
+                {
+                    *symbol = &LexerAction::MORE_INPUT;
+                }
+                *begin = position;
+            }
+        };
+
+        const char* streamed_lexer_actions_grammar = 
+            "StreamedLexerActions {\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   strings: strings string [concatenate] | string [string];\n"
+            "   string: \"[\\\"']:string:\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( streamed_lexer_actions_grammar, streamed_lexer_actions_grammar + strlen(streamed_lexer_actions_grammar) );
+        std::string strings;
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.lexer_action_handlers()
+            ( "string", &StreamedLexerActions::string )
+        ;
+        parser.parser_action_handlers()
+            ( "concatenate", [&strings](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { strings += "|" + std::string(start[1].lexeme()); return 0; } )
+            ( "string", [&strings](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { strings += std::string(start[0].lexeme()); return 0; } )
+        ;
+
+        // Strings split across chunks are finished by calling the string
+        // action again with the next chunk and strings that are still open
+        // at the end of the input are rejected.
+        const char* input = "\"one\" 'two \"2\"' \"\" \"three\"";
+        for ( size_t chunk_size = 1; chunk_size <= 8; ++chunk_size )
+        {
+            strings.clear();
+            parser.reset();
+            size_t length = strlen( input );
+            for ( size_t i = 0; i < length; i += chunk_size )
+            {
+                std::string chunk( input + i, std::min(chunk_size, length - i) );
+                CHECK( parser.feed(chunk.data(), chunk.data() + chunk.size()) );
+                chunk.assign( chunk.size(), 'x' );
+            }
+            CHECK( !parser.feed_end() );
+            CHECK( parser.accepted() );
+            CHECK( parser.full() );
+            CHECK_EQUAL( "one|two \"2\"||three", strings );
+        }
+
+        parser.reset();
+        input = "\"one\" \"two";
+        CHECK( parser.feed(input, input + 4) );
+        CHECK( parser.feed(input + 4, input + strlen(input)) );
+        CHECK( !parser.feed_end() );
+        CHECK( !parser.accepted() );
+    }
+
     /*
     TEST( SyntaxErrorsInGrammar )
     {
@@ -1238,4 +1520,792 @@ SUITE( Parsers )
         compiler.compile( unterminated_block_comment_grammar, unterminated_block_comment_grammar + strlen(unterminated_block_comment_grammar), &error_policy );
         CHECK( error_policy.errors == 0 );
     }
+
+    TEST( TransitionTable )
+    {
+        const char* binary_operator_grammar =
+            "BinaryOperator {\n"
+            "    E: E '+' T | T;\n"
+            "    T: T '*' F | F;\n"
+            "    F: '(' E ')' | i;\n"
+            "    i: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( binary_operator_grammar, binary_operator_grammar + strlen(binary_operator_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK( state_machine->transition_table );
+
+        int transitions = 0;
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            for ( int j = 0; j < state_machine->symbols_size; ++j )
+            {
+                int index = state_machine->transition_table[i * state_machine->symbols_size + j];
+                const ParserTransition* transition = state->transitions;
+                const ParserTransition* transitions_end = state->transitions + state->length;
+                while ( transition != transitions_end && transition->symbol->index != j )
+                {
+                    ++transition;
+                }
+                CHECK( index == (transition != transitions_end ? transition->index : -1) );
+                transitions += index >= 0 ? 1 : 0;
+            }
+        }
+        CHECK( transitions == state_machine->transitions_size );
+    }
+
+    TEST( CompressedTransitionTable )
+    {
+        const char* binary_operator_grammar =
+            "BinaryOperator {\n"
+            "    E: E '+' T | T;\n"
+            "    T: T '*' F | F;\n"
+            "    F: '(' E ')' | i;\n"
+            "    i: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.set_compressed( true );
+        compiler.compile( binary_operator_grammar, binary_operator_grammar + strlen(binary_operator_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+        CHECK( !state_machine->transition_table );
+        CHECK( state_machine->compressed_base );
+        CHECK( state_machine->compressed_size < state_machine->states_size * state_machine->symbols_size );
+        Parser<const char*> parser( state_machine );
+
+        const char* input = "1+2*3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+
+        input = "(1+2)*3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );               
+        
+        input = "((1+2)*3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( !parser.accepted() );
+        
+        input = "1+";
+        parser.parse( input, input + strlen(input) );
+        CHECK( !parser.accepted() );
+
+        input = "4)";
+        parser.parse( input, input + strlen(input) );
+        CHECK( !parser.accepted() );
+        CHECK( !parser.full() );
+
+        const char* error_processing_grammar =
+            "ErrorProcessing {"
+            "   %left error;\n"
+            "   %left '+';\n"
+            "   expr: expr '+' expr [add] | expr error expr [error] | integer;\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        compiler.compile( error_processing_grammar, error_processing_grammar + strlen(error_processing_grammar) );
+        Parser<const char*> error_parser( compiler.parser_state_machine() );
+        input = "1-2";
+        error_parser.parse( input, input + strlen(input) );
+        CHECK( error_parser.accepted() );
+        CHECK( error_parser.full() );       
+    }
+
+    TEST( DefaultReductions )
+    {
+        const char* default_reductions_grammar =
+            "DefaultReductions {\n"
+            "    E: E '+' T [add] | T [term];\n"
+            "    T: T '*' F [multiply] | F [term];\n"
+            "    F: '(' E ')' [parenthesis] | i [term];\n"
+            "    i: \"[0-9]+\" [integer];\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( default_reductions_grammar, default_reductions_grammar + strlen(default_reductions_grammar) );
+        const ParserStateMachine* state_machine = compiler.parser_state_machine();
+
+        int default_reductions = 0;
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserState* state = &state_machine->states[i];
+            const ParserTransition* default_reduction = state->default_reduction;
+            if ( default_reduction )
+            {
+                CHECK( default_reduction >= state->transitions && default_reduction < state->transitions + state->length );
+                CHECK( default_reduction->reduced_symbol != state_machine->start_symbol );
+                for ( int j = 0; j < state->length; ++j )
+                {
+                    const ParserTransition* transition = &state->transitions[j];
+                    CHECK( transition->type == TRANSITION_REDUCE );
+                    CHECK( transition->reduced_symbol == default_reduction->reduced_symbol );
+                    CHECK( transition->reduced_length == default_reduction->reduced_length );
+                    CHECK( transition->action == default_reduction->action );
+                    CHECK( transition->production == default_reduction->production );
+                }
+                ++default_reductions;
+            }
+        }
+        CHECK( default_reductions > 0 );
+
+        Parser<const char*, int> parser( state_machine );
+        parser.parser_action_handlers()
+            ( "add", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data() + start[2].user_data(); } )
+            ( "multiply", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data() * start[2].user_data(); } )
+            ( "parenthesis", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[1].user_data(); } )
+            ( "term", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data(); } )
+            ( "integer", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return atoi(std::string(start[0].lexeme()).c_str()); } )
+        ;
+
+        const char* input = "1+2*3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK_EQUAL( 7, parser.accepted() ? parser.user_data() : 0 );
+
+        input = "(1+2)*3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK_EQUAL( 9, parser.accepted() ? parser.user_data() : 0 );
+
+        input = "1+2)";
+        parser.parse( input, input + strlen(input) );
+        CHECK( !parser.accepted() );
+
+        input = "(1+2";
+        parser.parse( input, input + strlen(input) );
+        CHECK( !parser.accepted() );
+
+        const char* filename = "DefaultReductions.lalr";
+        CHECK( ParserStateMachineFile::save(state_machine, filename) );
+        ParserStateMachineFile file;
+        CHECK( file.load(filename) );
+        remove( filename );
+        if ( file.parser_state_machine() )
+        {
+            for ( int i = 0; i < state_machine->states_size; ++i )
+            {
+                const ParserState* state = &state_machine->states[i];
+                const ParserState* loaded_state = &file.parser_state_machine()->states[i];
+                CHECK( (state->default_reduction ? state->default_reduction->index : -1) == (loaded_state->default_reduction ? loaded_state->default_reduction->index : -1) );
+            }
+        }
+    }
+
+#if defined(__cpp_lib_constexpr_vector) && defined(__cpp_lib_constexpr_string)
+    using DefaultReductionsGrammar = ConstexprGrammar<
+        "DefaultReductions {\n"
+        "    %whitespace \"[ \\t\\r\\n]*\";\n"
+        "    E: E '+' T [add] | T [term];\n"
+        "    T: T '*' F [multiply] | F [term];\n"
+        "    F: '(' E ')' [parenthesis] | i [term] | error [error];\n"
+        "    i: \"[0-9]+\" [integer];\n"
+        "}"
+    >;
+
+    static_assert( DefaultReductionsGrammar::states_size > 0, "Grammar not compiled during constant evaluation" );
+
+    TEST( ConstexprGrammars )
+    {
+        const char* default_reductions_grammar =
+            "DefaultReductions {\n"
+            "    %whitespace \"[ \\t\\r\\n]*\";\n"
+            "    E: E '+' T [add] | T [term];\n"
+            "    T: T '*' F [multiply] | F [term];\n"
+            "    F: '(' E ')' [parenthesis] | i [term] | error [error];\n"
+            "    i: \"[0-9]+\" [integer];\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( default_reductions_grammar, default_reductions_grammar + strlen(default_reductions_grammar) );
+        const ParserStateMachine* expected_state_machine = compiler.parser_state_machine();
+        const ParserStateMachine* state_machine = DefaultReductionsGrammar::state_machine;
+        CHECK( strcmp(expected_state_machine->identifier, state_machine->identifier) == 0 );
+        CHECK_EQUAL( expected_state_machine->actions_size, state_machine->actions_size );
+        CHECK_EQUAL( expected_state_machine->symbols_size, state_machine->symbols_size );
+        CHECK_EQUAL( expected_state_machine->transitions_size, state_machine->transitions_size );
+        CHECK_EQUAL( expected_state_machine->states_size, state_machine->states_size );
+        CHECK_EQUAL( state_machine->states_size, DefaultReductionsGrammar::states_size );
+        CHECK_EQUAL( state_machine->symbols_size, DefaultReductionsGrammar::symbols_size );
+        CHECK_EQUAL( state_machine->transitions_size, DefaultReductionsGrammar::transitions_size );
+        CHECK( state_machine->whitespace_lexer_state_machine != nullptr );
+        CHECK_EQUAL( expected_state_machine->lexer_state_machine->states_size, state_machine->lexer_state_machine->states_size );
+        CHECK_EQUAL( expected_state_machine->lexer_state_machine->transitions_size, state_machine->lexer_state_machine->transitions_size );
+        CHECK_EQUAL( expected_state_machine->whitespace_lexer_state_machine->states_size, state_machine->whitespace_lexer_state_machine->states_size );
+
+        for ( int i = 0; i < state_machine->actions_size && i < expected_state_machine->actions_size; ++i )
+        {
+            CHECK( strcmp(expected_state_machine->actions[i].identifier, state_machine->actions[i].identifier) == 0 );
+        }
+
+        for ( int i = 0; i < state_machine->symbols_size && i < expected_state_machine->symbols_size; ++i )
+        {
+            const ParserSymbol* expected_symbol = &expected_state_machine->symbols[i];
+            const ParserSymbol* symbol = &state_machine->symbols[i];
+            CHECK( strcmp(expected_symbol->identifier, symbol->identifier) == 0 );
+            CHECK( strcmp(expected_symbol->lexeme, symbol->lexeme) == 0 );
+            CHECK( expected_symbol->type == symbol->type );
+        }
+
+        for ( int i = 0; i < state_machine->states_size && i < expected_state_machine->states_size; ++i )
+        {
+            const ParserState* expected_state = &expected_state_machine->states[i];
+            const ParserState* state = &state_machine->states[i];
+            CHECK_EQUAL( expected_state->length, state->length );
+            CHECK( (expected_state->default_reduction ? expected_state->default_reduction->index : -1) == (state->default_reduction ? state->default_reduction->index : -1) );
+            for ( int j = 0; j < state->length && j < expected_state->length; ++j )
+            {
+                const ParserTransition* expected_transition = &expected_state->transitions[j];
+                const ParserTransition* transition = &state->transitions[j];
+                CHECK_EQUAL( expected_transition->symbol->index, transition->symbol->index );
+                CHECK( (expected_transition->state ? expected_transition->state->index : -1) == (transition->state ? transition->state->index : -1) );
+                CHECK( (expected_transition->reduced_symbol ? expected_transition->reduced_symbol->index : -1) == (transition->reduced_symbol ? transition->reduced_symbol->index : -1) );
+                CHECK_EQUAL( expected_transition->reduced_length, transition->reduced_length );
+                CHECK_EQUAL( expected_transition->precedence, transition->precedence );
+                CHECK_EQUAL( expected_transition->action, transition->action );
+                CHECK_EQUAL( expected_transition->production, transition->production );
+                CHECK( expected_transition->type == transition->type );
+                CHECK_EQUAL( expected_transition->index, transition->index );
+                CHECK_EQUAL( transition->index, DefaultReductionsGrammar::transition_table[state->index * state_machine->symbols_size + transition->symbol->index] );
+            }
+        }
+
+        Parser<const char*, int, char, std::char_traits<char>, std::allocator<char>, DefaultReductionsGrammar> parser( state_machine );
+        parser.parser_action_handlers()
+            ( "add", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data() + start[2].user_data(); } )
+            ( "multiply", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data() * start[2].user_data(); } )
+            ( "parenthesis", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[1].user_data(); } )
+            ( "term", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return start[0].user_data(); } )
+            ( "error", [](const ParserNode<int>* /*start*/, const ParserNode<int>* /*finish*/) { return 0; } )
+            ( "integer", [](const ParserNode<int>* start, const ParserNode<int>* /*finish*/) { return atoi(std::string(start[0].lexeme()).c_str()); } )
+        ;
+
+        const char* input = "1 + 2 * (3 + 4) + 5";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        CHECK_EQUAL( 20, parser.accepted() ? parser.user_data() : 0 );
+
+        input = "(1 + 2) * 3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK_EQUAL( 9, parser.accepted() ? parser.user_data() : 0 );
+    }
+#endif
+
+    TEST( LexemeSpans )
+    {
+        struct LexemeSpans
+        {
+            static void string_lexer( const char** begin, const char* end, std::string* lexeme, const void** /*symbol*/ )
+            {
+                LALR_ASSERT( lexeme && lexeme->length() == 1 );
+                lexeme->clear();
+                const char* position = *begin;
+                while ( position != end && *position != '\'' )
+                {
+                    *lexeme += *position;
+                    ++position;
+                }
+                *begin = position != end ? position + 1 : position;
+            }
+
+            static int name( const ParserNode<int>* start, const ParserNode<int>* /*finish*/ )
+            {
+                CHECK( start[0].spanned() );
+                CHECK( start[0].lexeme() == "name" );
+                return 1;
+            }
+
+            static int string( const ParserNode<int>* start, const ParserNode<int>* /*finish*/ )
+            {
+                CHECK( !start[0].spanned() );
+                CHECK( start[0].lexeme() == "value" );
+                return 2;
+            }
+        };
+
+        const char* lexeme_spans_grammar = 
+            "LexemeSpans { \n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   unit: name string;\n"
+            "   name: \"[a-z]+\" [name];\n"
+            "   string: \"':string:\" [string];\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( lexeme_spans_grammar, lexeme_spans_grammar + strlen(lexeme_spans_grammar) );
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.lexer_action_handlers()
+            ( "string", &LexemeSpans::string_lexer )
+        ;            
+        parser.parser_action_handlers()
+            ( "name", &LexemeSpans::name )
+            ( "string", &LexemeSpans::string )
+        ;
+
+        const char* input = "name 'value'";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+
+        Parser<PositionIterator<const char*>, int> position_parser( compiler.parser_state_machine() );
+        position_parser.lexer_action_handlers()
+            ( "string", [](PositionIterator<const char*>* begin, PositionIterator<const char*> end, std::string* lexeme, const void** /*symbol*/) {
+                lexeme->clear();
+                while ( *begin != end && **begin != '\'' )
+                {
+                    *lexeme += **begin;
+                    ++*begin;
+                }
+                ++*begin;
+            } )
+        ;
+        position_parser.parser_action_handlers()
+            ( "name", &LexemeSpans::name )
+            ( "string", &LexemeSpans::string )
+        ;
+        position_parser.parse( PositionIterator<const char*>(input, input + strlen(input)), PositionIterator<const char*>() );
+        CHECK( position_parser.accepted() );
+        CHECK( position_parser.full() );
+    }
+
+    TEST( MoveOnlyUserData )
+    {
+        struct Sum
+        {
+            int value;
+            std::unique_ptr<Sum> left;
+            std::unique_ptr<Sum> right;
+
+            Sum( int value, std::unique_ptr<Sum> left, std::unique_ptr<Sum> right )
+            : value( value ),
+              left( std::move(left) ),
+              right( std::move(right) )
+            {
+            }
+        };
+
+        typedef ParserNode<std::unique_ptr<Sum>> ParserNode;
+
+        struct MoveOnlyUserData
+        {
+            static std::unique_ptr<Sum> add( ParserNode* start, ParserNode* /*finish*/ )
+            {
+                std::unique_ptr<Sum>& left = start[0].user_data();
+                std::unique_ptr<Sum>& right = start[2].user_data();
+                int value = left->value + right->value;
+                return std::unique_ptr<Sum>( new Sum(value, std::move(left), std::move(right)) );
+            }
+
+            static std::unique_ptr<Sum> term( ParserNode* start, ParserNode* /*finish*/ )
+            {
+                return std::move( start[0].user_data() );
+            }
+
+            static std::unique_ptr<Sum> integer( ParserNode* start, ParserNode* /*finish*/ )
+            {
+                return std::unique_ptr<Sum>( new Sum(::atoi(std::string(start[0].lexeme()).c_str()), nullptr, nullptr) );
+            }
+        };
+
+        const char* move_only_user_data_grammar = 
+            "MoveOnlyUserData { \n"
+            "   %left '+';\n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   expr: expr '+' term [add] | term [term];\n"
+            "   term: \"[0-9]+\" [integer];\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( move_only_user_data_grammar, move_only_user_data_grammar + strlen(move_only_user_data_grammar) );
+        Parser<const char*, std::unique_ptr<Sum>> parser( compiler.parser_state_machine() );
+        parser.parser_action_handlers()
+            ( "add", &MoveOnlyUserData::add )
+            ( "term", &MoveOnlyUserData::term )
+            ( "integer", &MoveOnlyUserData::integer )
+        ;
+
+        const char* input = "1 + 2 + 3";
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        std::unique_ptr<Sum> sum = std::move( parser.user_data() );
+        CHECK( sum && sum->value == 6 );
+        CHECK( sum && sum->left && sum->left->value == 3 );
+        CHECK( sum && sum->right && sum->right->value == 3 );
+        CHECK( !parser.user_data() );
+    }
+
+    TEST( ParserTrees )
+    {
+        const char* parser_trees_grammar = 
+            "ParserTrees { \n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   assignments: assignments assignment | assignment;\n"
+            "   assignment: name '=' value ';';\n"
+            "   name: \"[a-z]+\";\n"
+            "   value: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( parser_trees_grammar, parser_trees_grammar + strlen(parser_trees_grammar) );
+        const ParserSymbol* assignments = find_symbol_by_identifier( compiler.parser_state_machine(), "assignments" );
+        const ParserSymbol* assignment = find_symbol_by_identifier( compiler.parser_state_machine(), "assignment" );
+
+        const char* input = "a = 1; b = 22;";
+        Parser<const char*, const ParserTree<char>*> parser( compiler.parser_state_machine() );
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+        const ParserTree<char>* tree = parser.user_data();
+        CHECK( tree && tree->symbol() == assignments && tree->size() == 2 );
+        if ( tree && tree->size() == 2 )
+        {
+            const ParserTree<char>* first = tree->child( 0 );
+            CHECK( first->symbol() == assignments && first->size() == 1 );
+            CHECK( first->child(0)->symbol() == assignment && first->child(0)->size() == 4 );
+            CHECK( first->child(0)->child(0)->lexeme() == "a" );
+            CHECK( first->child(0)->child(0)->lexeme().data() == input );
+            const ParserTree<char>* second = tree->child( 1 );
+            CHECK( second->symbol() == assignment && second->size() == 4 );
+            CHECK( second->child(2)->lexeme() == "22" );
+            CHECK( second->child(2)->size() == 0 );
+        }
+
+        std::string copied_input = "c = 333;";
+        Parser<std::string::const_iterator, const ParserTree<char>*> copying_parser( compiler.parser_state_machine() );
+        copying_parser.parse( copied_input.cbegin(), copied_input.cend() );
+        CHECK( copying_parser.accepted() );
+        CHECK( copying_parser.full() );
+        tree = copying_parser.user_data();
+        CHECK( tree && tree->size() == 1 && tree->child(0)->size() == 4 );
+        if ( tree && tree->size() == 1 && tree->child(0)->size() == 4 )
+        {
+            CHECK( tree->child(0)->child(2)->lexeme() == "333" );
+            CHECK( tree->child(0)->child(2)->lexeme().data() != copied_input.data() + 4 );
+        }
+    }
+
+    TEST( FlatTrees )
+    {
+        const char* flat_trees_grammar = 
+            "FlatTrees { \n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   assignments: assignments assignment | assignment;\n"
+            "   assignment: name '=' value ';' [assignment];\n"
+            "   name: \"[a-z]+\";\n"
+            "   value: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        GrammarCompiler compiler;
+        compiler.compile( flat_trees_grammar, flat_trees_grammar + strlen(flat_trees_grammar) );
+        const ParserSymbol* assignments = find_symbol_by_identifier( compiler.parser_state_machine(), "assignments" );
+        const ParserSymbol* assignment = find_symbol_by_identifier( compiler.parser_state_machine(), "assignment" );
+        const ParserSymbol* semicolon = find_symbol_by_identifier( compiler.parser_state_machine(), "semi_colon_terminal" );
+
+        const char* input = "a = 1; b = 22;";
+        Parser<const char*, int> parser( compiler.parser_state_machine() );
+        parser.set_flat_tree_enabled( true );
+        parser.parse( input, input + strlen(input) );
+        CHECK( parser.accepted() );
+        CHECK( parser.full() );
+
+        const ParserFlatTree& tree = parser.flat_tree();
+        CHECK_EQUAL( 12, tree.size() );
+        if ( tree.size() == 12 )
+        {
+            CHECK_EQUAL( 0, tree.begin(0) );
+            CHECK_EQUAL( 1, tree.end(0) );
+            CHECK( semicolon && tree.symbol(3) == semicolon->index );
+            CHECK( tree.action(3) == ParserAction::INVALID_INDEX );
+            CHECK( tree.symbol(4) == assignment->index );
+            CHECK( tree.action(4) != ParserAction::INVALID_INDEX );
+            CHECK_EQUAL( 4, tree.children(4) );
+            CHECK_EQUAL( 0, tree.begin(4) );
+            CHECK_EQUAL( 6, tree.end(4) );
+            CHECK( tree.symbol(5) == assignments->index );
+            CHECK_EQUAL( 1, tree.children(5) );
+            CHECK( tree.production(5) >= 0 );
+            CHECK( tree.production(5) != tree.production(11) );
+            CHECK( tree.production(3) == -1 );
+            CHECK_EQUAL( 11, tree.begin(8) );
+            CHECK_EQUAL( 13, tree.end(8) );
+            CHECK_EQUAL( 7, tree.begin(10) );
+            CHECK_EQUAL( 14, tree.end(10) );
+            CHECK( tree.symbol(11) == assignments->index );
+            CHECK( tree.action(11) == ParserAction::INVALID_INDEX );
+            CHECK_EQUAL( 2, tree.children(11) );
+            CHECK_EQUAL( 0, tree.begin(11) );
+            CHECK_EQUAL( 14, tree.end(11) );
+        }
+    }
+
+    // Check that every entry in the tables of a lexer state machine loaded 
+    // from a file refers to a transition or character class in range and 
+    // that every state matches a symbol of \e parser_state_machine, nothing,
+    // or the whitespace symbol of a lexer that whitespace is fused into.
+    bool lexer_tables_within_range( const LexerStateMachine* state_machine, const ParserStateMachine* parser_state_machine )
+    {
+        for ( int i = 0; i < state_machine->states_size; ++i )
+        {
+            const ParserSymbol* symbol = static_cast<const ParserSymbol*>( state_machine->states[i].symbol );
+            if ( symbol && symbol != state_machine->whitespace_symbol && (symbol < parser_state_machine->symbols || symbol >= parser_state_machine->symbols + parser_state_machine->symbols_size) )
+            {
+                return false;
+            }
+        }
+
+        for ( int i = 0; state_machine->classes && i < LEXER_CLASS_CHARACTERS; ++i )
+        {
+            if ( state_machine->classes[i] < 0 || state_machine->classes[i] >= state_machine->classes_size )
+            {
+                return false;
+            }
+        }
+        for ( long long i = 0; state_machine->class_transitions && i < (long long) state_machine->states_size * state_machine->classes_size; ++i )
+        {
+            if ( state_machine->class_transitions[i] < -1 || state_machine->class_transitions[i] >= state_machine->transitions_size )
+            {
+                return false;
+            }
+        }
+        for ( long long i = 0; state_machine->loop_ranges && i < (long long) state_machine->states_size * LEXER_LOOP_RANGES * 2; ++i )
+        {
+            if ( state_machine->loop_ranges[i] < 0 || state_machine->loop_ranges[i] > LEXER_LOOP_CHARACTERS )
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Check that every transition and every entry in the tables of a parser
+    // state machine loaded from a file refers to a transition, state, or 
+    // symbol in range.
+    bool tables_within_range( const ParserStateMachine* state_machine )
+    {
+        for ( int i = 0; i < state_machine->transitions_size; ++i )
+        {
+            const ParserTransition* transition = &state_machine->transitions[i];
+            if ( !transition->symbol || (transition->type == TRANSITION_SHIFT && !transition->state) || (transition->type == TRANSITION_REDUCE && !transition->reduced_symbol) )
+            {
+                return false;
+            }
+        }
+        for ( long long i = 0; state_machine->transition_table && i < (long long) state_machine->states_size * state_machine->symbols_size; ++i )
+        {
+            if ( state_machine->transition_table[i] < -1 || state_machine->transition_table[i] >= state_machine->transitions_size )
+            {
+                return false;
+            }
+        }
+        for ( int i = 0; state_machine->compressed_base && i < state_machine->states_size; ++i )
+        {
+            if ( state_machine->compressed_base[i] < 0 || state_machine->default_transitions[i] < -1 || state_machine->default_transitions[i] >= state_machine->transitions_size )
+            {
+                return false;
+            }
+        }
+        for ( int i = 0; state_machine->compressed_base && i < state_machine->compressed_size; ++i )
+        {
+            if ( state_machine->compressed_next[i] < -1 || state_machine->compressed_next[i] >= state_machine->transitions_size )
+            {
+                return false;
+            }
+        }
+        return 
+            (!state_machine->lexer_state_machine || lexer_tables_within_range(state_machine->lexer_state_machine, state_machine)) &&
+            (!state_machine->whitespace_lexer_state_machine || lexer_tables_within_range(state_machine->whitespace_lexer_state_machine, state_machine))
+        ;
+    }
+
+    TEST( StateMachineFiles )
+    {
+        struct StateMachineFiles
+        {
+            static int add( const ParserNode<int>* start, const ParserNode<int>* /*finish*/ )
+            {
+                return start[0].user_data() + ::atoi( std::string(start[2].lexeme()).c_str() );
+            }
+
+            static int integer( const ParserNode<int>* start, const ParserNode<int>* /*finish*/ )
+            {
+                return ::atoi( std::string(start[0].lexeme()).c_str() );
+            }
+        };
+
+        const char* state_machine_files_grammar = 
+            "StateMachineFiles { \n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   expr: expr '+' integer [add] | integer [integer];\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+
+        const char* filename = "StateMachineFiles.lalr";
+        for ( int compressed = 0; compressed < 2; ++compressed )
+        {
+            GrammarCompiler compiler;
+            compiler.set_compressed( compressed != 0 );
+            compiler.compile( state_machine_files_grammar, state_machine_files_grammar + strlen(state_machine_files_grammar) );
+            CHECK( ParserStateMachineFile::save(compiler.parser_state_machine(), filename) );
+
+            ParserStateMachineFile file;
+            CHECK( file.load(filename) );
+            const ParserStateMachine* state_machine = file.parser_state_machine();
+            CHECK( state_machine );
+            if ( state_machine )
+            {
+                const ParserStateMachine* compiled_state_machine = compiler.parser_state_machine();
+                CHECK( strcmp(state_machine->identifier, "StateMachineFiles") == 0 );
+                CHECK_EQUAL( compiled_state_machine->states_size, state_machine->states_size );
+                CHECK_EQUAL( compiled_state_machine->transitions_size, state_machine->transitions_size );
+                CHECK_EQUAL( compressed != 0, state_machine->compressed_base != nullptr );
+
+                Parser<const char*, int> parser( state_machine );
+                parser.parser_action_handlers()
+                    ( "add", &StateMachineFiles::add )
+                    ( "integer", &StateMachineFiles::integer )
+                ;
+                const char* input = "1 + 2 + 39";
+                parser.parse( input, input + strlen(input) );
+                CHECK( parser.accepted() );
+                CHECK( parser.full() );
+                CHECK_EQUAL( 42, parser.accepted() ? parser.user_data() : 0 );
+            }
+
+            // Corrupt each int in turn and check that files that still load
+            // only refer to transitions, states, and character classes that
+            // are within their tables.  Counts whose products with the size
+            // of each table entry or another count wrap around to a small
+            // size, counts too large to allocate, and the index one past the
+            // last symbol, which is only valid for the whitespace symbol of a 
+            // lexer that whitespace is fused into, are included.
+            const ParserStateMachine* compiled_state_machine = compiler.parser_state_machine();
+            std::vector<int> values = { -2, 0x3fffffff, 0x20000001, compiled_state_machine->symbols_size };
+            const int dimensions [] = { 
+                3, 4, 5, 6, 7, 8, 9,
+                compiled_state_machine->states_size, 
+                compiled_state_machine->symbols_size, 
+                compiled_state_machine->lexer_state_machine->states_size,
+                compiled_state_machine->whitespace_lexer_state_machine ? compiled_state_machine->whitespace_lexer_state_machine->states_size : 0
+            };
+            for ( int dimension : dimensions )
+            {
+                if ( dimension >= 3 )
+                {
+                    values.push_back( int((0x100000000LL + dimension - 1) / dimension) );
+                }
+            }
+            std::vector<char> image;
+            ParserStateMachineFile::write( compiled_state_machine, &image );
+            for ( size_t i = 0; i < image.size() / sizeof(int); ++i )
+            {
+                for ( int value : values )
+                {
+                    std::vector<char> corrupt_image( image );
+                    memcpy( &corrupt_image[i * sizeof(int)], &value, sizeof(int) );
+                    FILE* corrupt_file = fopen( filename, "wb" );
+                    CHECK( corrupt_file );
+                    if ( corrupt_file )
+                    {
+                        fwrite( corrupt_image.data(), 1, corrupt_image.size(), corrupt_file );
+                        fclose( corrupt_file );
+                        ParserStateMachineFile corrupt_state_machine_file;
+                        if ( corrupt_state_machine_file.load(filename) )
+                        {
+                            CHECK( tables_within_range(corrupt_state_machine_file.parser_state_machine()) );
+                        }
+                    }
+                }
+            }
+        }
+
+        FILE* file = fopen( filename, "wb" );
+        CHECK( file );
+        if ( file )
+        {
+            fputs( "not a state machine", file );
+            fclose( file );
+            ParserStateMachineFile invalid_file;
+            CHECK( !invalid_file.load(filename) );
+            CHECK( !invalid_file.parser_state_machine() );
+        }
+        remove( filename );
+
+        ParserStateMachineFile missing_file;
+        CHECK( !missing_file.load(filename) );
+    }
+
+    TEST( CachedStateMachines )
+    {
+        const char* cached_state_machines_grammar = 
+            "CachedStateMachines { \n"
+            "   %whitespace \"[ \\t\\r\\n]*\";\n"
+            "   expr: expr '+' integer | integer;\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+        const char* begin = cached_state_machines_grammar;
+        const char* end = begin + strlen( begin );
+
+        GrammarCompiler compiler;
+        compiler.set_cache_directory( "." );
+        std::string filename = compiler.cache_filename( begin, end );
+        remove( filename.c_str() );
+
+        for ( int pass = 0; pass < 2; ++pass )
+        {
+            GrammarCompiler compiler;
+            compiler.set_cache_directory( "." );
+            compiler.compile( begin, end );
+            const ParserStateMachine* state_machine = compiler.parser_state_machine();
+            bool cached = state_machine->lexer_state_machine != compiler.lexer()->state_machine();
+            CHECK_EQUAL( pass == 1, cached );
+
+            Parser<const char*> parser( state_machine );
+            const char* input = "1 + 2 + 39";
+            parser.parse( input, input + strlen(input) );
+            CHECK( parser.accepted() );
+            CHECK( parser.full() );
+        }
+
+        GrammarCompiler compressed_compiler;
+        compressed_compiler.set_cache_directory( "." );
+        compressed_compiler.set_compressed( true );
+        CHECK( compressed_compiler.cache_filename(begin, end) != filename );
+
+        // A file with the cached name that was saved for another grammar, 
+        // as if their names collide, or without a key is compiled over.
+        const char* other_grammar = 
+            "OtherGrammar { \n"
+            "   expr: expr '*' integer | integer;\n"
+            "   integer: \"[0-9]+\";\n"
+            "}"
+        ;
+        GrammarCompiler other_compiler;
+        other_compiler.compile( other_grammar, other_grammar + strlen(other_grammar) );
+        const char* keys [] = { other_grammar, nullptr };
+        for ( const char* key : keys )
+        {
+            CHECK( ParserStateMachineFile::save(other_compiler.parser_state_machine(), filename.c_str(), nullptr, key) );
+            GrammarCompiler compiler;
+            compiler.set_cache_directory( "." );
+            compiler.compile( begin, end );
+            const ParserStateMachine* state_machine = compiler.parser_state_machine();
+            CHECK( state_machine->lexer_state_machine == compiler.lexer()->state_machine() );
+            CHECK( strcmp(state_machine->identifier, "CachedStateMachines") == 0 );
+        }
+        remove( filename.c_str() );
+    }
 }
@@ -8,6 +8,7 @@
 #include <lalr/Lexer.ipp>
 #include <lalr/PositionIterator.hpp>
 #include <string.h>
+#include <wchar.h>
 
 using std::string;
 using namespace lalr;
@@ -1028,6 +1029,75 @@ SUITE( RegularExpressions )
         lexer.advance();
         CHECK( lexer.symbol() == NULL );
     }
+
+
+    TEST( LiteralsAndRegularExpressionsLexer )
+    {
+        void* if_ = (void*) 0x1;
+        void* in = (void*) 0x2;
+        void* identifier = (void*) 0x3;
+        std::vector<RegexToken> tokens;
+        tokens.push_back( RegexToken(TOKEN_LITERAL, 0, if_, "if") );
+        tokens.push_back( RegexToken(TOKEN_REGULAR_EXPRESSION, 0, identifier, "[a-z]+") );
+        tokens.push_back( RegexToken(TOKEN_LITERAL, 0, in, "in") );
+        RegexCompiler compiler;
+        compiler.compile( tokens );
+        Lexer<const char*> lexer( compiler.state_machine() );
+
+        const char* regex = "if";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == if_ );
+        CHECK( lexer.lexeme() == "if" );
+
+        regex = "in";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == in );
+        CHECK( lexer.lexeme() == "in" );
+
+        regex = "i";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == identifier );
+        CHECK( lexer.lexeme() == "i" );
+
+        regex = "ifs";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == identifier );
+        CHECK( lexer.lexeme() == "ifs" );
+    }
+
+    TEST( LongRunsOfCharactersAreSkipped )
+    {
+        int identifier;
+        RegexCompiler compiler;
+        compiler.compile( "[a-z_][a-z0-9_]*", &identifier );
+        CHECK( compiler.state_machine()->loop_ranges );
+        Lexer<const char*> lexer( compiler.state_machine() );
+
+        const char* regex = "a_very_long_identifier_that_spans_several_blocks_0123456789 next";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &identifier );
+        CHECK( lexer.lexeme() == "a_very_long_identifier_that_spans_several_blocks_0123456789" );
+    }
+
+    TEST( LongRunsStopAtFirstCharacterOutsideRun )
+    {
+        int lower;
+        RegexCompiler compiler;
+        compiler.compile( "[a-z]+", &lower );
+        CHECK( compiler.state_machine()->loop_ranges );
+        Lexer<const char*> lexer( compiler.state_machine() );
+
+        const char* regex = "abcdefghijklmnopqrstuvwxyz0abcdefghijklmnopqrstuvwxyz";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &lower );
+        CHECK( lexer.lexeme() == "abcdefghijklmnopqrstuvwxyz" );
+    }
     
     
     TEST( Alnum )
@@ -1288,4 +1358,72 @@ SUITE( RegularExpressions )
         CHECK( lexer.symbol() == &whitespace );
         CHECK( lexer.position().line() == 5 );        
     }
+
+
+    TEST( CharactersOutsideClasses )
+    {
+        void* not_a;
+        RegexCompiler compiler;
+        compiler.compile( "[^a]+", &not_a );
+        CHECK( compiler.state_machine()->classes );
+        Lexer<const wchar_t*> lexer( compiler.state_machine(), NULL );
+
+        const wchar_t* regex = L"b\u03b1\u03b2c";
+        lexer.reset( regex, regex + wcslen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &not_a );
+        CHECK( lexer.lexeme() == regex );
+
+        regex = L"\u03b1a";
+        lexer.reset( regex, regex + wcslen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &not_a );
+        CHECK( lexer.lexeme() == L"\u03b1" );
+    }
+
+
+    TEST( CharactersWithTheHighBitSet )
+    {
+        void* not_a;
+        RegexCompiler compiler;
+        compiler.compile( "[^a]+", &not_a );
+        CHECK( compiler.state_machine()->classes );
+        Lexer<const char*> lexer( compiler.state_machine(), NULL );
+
+        const char* regex = "b\xce\xb1" "c";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &not_a );
+        CHECK( lexer.lexeme() == regex );
+
+        void* high;
+        compiler.compile( "[\\xc0-\\xff]+", &high );
+        Lexer<const char*> high_lexer( compiler.state_machine(), NULL );
+        regex = "\xce\xb1" "a";
+        high_lexer.reset( regex, regex + strlen(regex) );
+        high_lexer.advance();
+        CHECK( high_lexer.symbol() == &high );
+        CHECK( high_lexer.lexeme() == "\xce" );
+    }
+
+
+    TEST( EquivalentStatesAreMerged )
+    {
+        void* bc;
+        RegexCompiler compiler;
+        compiler.compile( "abc|xbc|ybc", &bc );
+        CHECK_EQUAL( 4, compiler.state_machine()->states_size );
+        Lexer<const char*> lexer( compiler.state_machine(), NULL );
+
+        const char* regex = "xbc";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == &bc );
+        CHECK( lexer.lexeme() == "xbc" );
+
+        regex = "ybd";
+        lexer.reset( regex, regex + strlen(regex) );
+        lexer.advance();
+        CHECK( lexer.symbol() == NULL );
+    }
 }
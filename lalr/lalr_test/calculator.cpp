@@ -0,0 +1,380 @@
+
+#include <lalr/ParserStateMachine.hpp>
+#include <lalr/ParserState.hpp>
+#include <lalr/ParserTransition.hpp>
+#include <lalr/ParserSymbol.hpp>
+#include <lalr/ParserAction.hpp>
+#include <lalr/LexerStateMachine.hpp>
+#include <lalr/LexerState.hpp>
+#include <lalr/LexerTransition.hpp>
+#include <lalr/LexerAction.hpp>
+
+using namespace lalr;
+
+namespace
+{
+
+extern const LexerAction lexer_actions [];
+extern const LexerTransition lexer_transitions [];
+extern const LexerState lexer_states [];
+extern const LexerAction whitespace_lexer_actions [];
+extern const LexerTransition whitespace_lexer_transitions [];
+extern const LexerState whitespace_lexer_states [];
+extern const ParserAction actions [];
+extern const ParserSymbol symbols [];
+extern const ParserTransition transitions [];
+extern const ParserState states [];
+
+const ParserAction actions [] = 
+{
+    {0, "add"},
+    {1, "subtract"},
+    {2, "multiply"},
+    {3, "divide"},
+    {4, "compound"},
+    {5, "integer"},
+    {-1, nullptr}
+};
+
+const ParserSymbol symbols [] = 
+{
+    {0, "dot_start", ".start", (SymbolType) 2},
+    {1, "dot_end", ".end", (SymbolType) 3},
+    {2, "dot_error", ".error", (SymbolType) 1},
+    {3, "plus_terminal", "+", (SymbolType) 1},
+    {4, "minus_terminal", "-", (SymbolType) 1},
+    {5, "star_terminal", "*", (SymbolType) 1},
+    {6, "slash_terminal", "/", (SymbolType) 1},
+    {7, "expr", "expr", (SymbolType) 2},
+    {8, "left_paren_terminal", "(", (SymbolType) 1},
+    {9, "right_paren_terminal", ")", (SymbolType) 1},
+    {10, "integer", "[0-9]+", (SymbolType) 1},
+    {-1, nullptr, nullptr, (SymbolType) 0}
+};
+
+const ParserTransition transitions [] = 
+{
+    {&symbols[7], &states[1], nullptr, 0, 0, -1, -1, (TransitionType) 0, 0},
+    {&symbols[8], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 1},
+    {&symbols[10], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 2},
+    {&symbols[1], nullptr, &symbols[0], 1, 0, -1, 0, (TransitionType) 1, 3},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 4},
+    {&symbols[4], &states[5], nullptr, 0, 0, -1, -1, (TransitionType) 0, 5},
+    {&symbols[5], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 6},
+    {&symbols[6], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 7},
+    {&symbols[7], &states[8], nullptr, 0, 0, -1, -1, (TransitionType) 0, 8},
+    {&symbols[8], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 9},
+    {&symbols[10], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 10},
+    {&symbols[1], nullptr, &symbols[7], 1, 3, 5, 6, (TransitionType) 1, 11},
+    {&symbols[3], nullptr, &symbols[7], 1, 3, 5, 6, (TransitionType) 1, 12},
+    {&symbols[4], nullptr, &symbols[7], 1, 3, 5, 6, (TransitionType) 1, 13},
+    {&symbols[5], nullptr, &symbols[7], 1, 3, 5, 6, (TransitionType) 1, 14},
+    {&symbols[6], nullptr, &symbols[7], 1, 3, 5, 6, (TransitionType) 1, 15},
+    {&symbols[9], nullptr, &symbols[7], 1, 3, 5, 6, (TransitionType) 1, 16},
+    {&symbols[7], &states[9], nullptr, 0, 0, -1, -1, (TransitionType) 0, 17},
+    {&symbols[8], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 18},
+    {&symbols[10], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 19},
+    {&symbols[7], &states[10], nullptr, 0, 0, -1, -1, (TransitionType) 0, 20},
+    {&symbols[8], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 21},
+    {&symbols[10], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 22},
+    {&symbols[7], &states[11], nullptr, 0, 0, -1, -1, (TransitionType) 0, 23},
+    {&symbols[8], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 24},
+    {&symbols[10], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 25},
+    {&symbols[7], &states[12], nullptr, 0, 0, -1, -1, (TransitionType) 0, 26},
+    {&symbols[8], &states[2], nullptr, 0, 0, -1, -1, (TransitionType) 0, 27},
+    {&symbols[10], &states[3], nullptr, 0, 0, -1, -1, (TransitionType) 0, 28},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 29},
+    {&symbols[4], &states[5], nullptr, 0, 0, -1, -1, (TransitionType) 0, 30},
+    {&symbols[5], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 31},
+    {&symbols[6], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 32},
+    {&symbols[9], &states[13], nullptr, 0, 0, -1, -1, (TransitionType) 0, 33},
+    {&symbols[1], nullptr, &symbols[7], 3, 1, 0, 1, (TransitionType) 1, 34},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 35},
+    {&symbols[4], &states[5], nullptr, 0, 0, -1, -1, (TransitionType) 0, 36},
+    {&symbols[5], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 37},
+    {&symbols[6], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 38},
+    {&symbols[9], nullptr, &symbols[7], 3, 1, 0, 1, (TransitionType) 1, 39},
+    {&symbols[1], nullptr, &symbols[7], 3, 1, 1, 2, (TransitionType) 1, 40},
+    {&symbols[3], &states[4], nullptr, 0, 0, -1, -1, (TransitionType) 0, 41},
+    {&symbols[4], &states[5], nullptr, 0, 0, -1, -1, (TransitionType) 0, 42},
+    {&symbols[5], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 43},
+    {&symbols[6], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 44},
+    {&symbols[9], nullptr, &symbols[7], 3, 1, 1, 2, (TransitionType) 1, 45},
+    {&symbols[1], nullptr, &symbols[7], 3, 2, 2, 3, (TransitionType) 1, 46},
+    {&symbols[3], nullptr, &symbols[7], 3, 2, 2, 3, (TransitionType) 1, 47},
+    {&symbols[4], nullptr, &symbols[7], 3, 2, 2, 3, (TransitionType) 1, 48},
+    {&symbols[5], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 49},
+    {&symbols[6], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 50},
+    {&symbols[9], nullptr, &symbols[7], 3, 2, 2, 3, (TransitionType) 1, 51},
+    {&symbols[1], nullptr, &symbols[7], 3, 2, 3, 4, (TransitionType) 1, 52},
+    {&symbols[3], nullptr, &symbols[7], 3, 2, 3, 4, (TransitionType) 1, 53},
+    {&symbols[4], nullptr, &symbols[7], 3, 2, 3, 4, (TransitionType) 1, 54},
+    {&symbols[5], &states[6], nullptr, 0, 0, -1, -1, (TransitionType) 0, 55},
+    {&symbols[6], &states[7], nullptr, 0, 0, -1, -1, (TransitionType) 0, 56},
+    {&symbols[9], nullptr, &symbols[7], 3, 2, 3, 4, (TransitionType) 1, 57},
+    {&symbols[1], nullptr, &symbols[7], 3, 0, 4, 5, (TransitionType) 1, 58},
+    {&symbols[3], nullptr, &symbols[7], 3, 0, 4, 5, (TransitionType) 1, 59},
+    {&symbols[4], nullptr, &symbols[7], 3, 0, 4, 5, (TransitionType) 1, 60},
+    {&symbols[5], nullptr, &symbols[7], 3, 0, 4, 5, (TransitionType) 1, 61},
+    {&symbols[6], nullptr, &symbols[7], 3, 0, 4, 5, (TransitionType) 1, 62},
+    {&symbols[9], nullptr, &symbols[7], 3, 0, 4, 5, (TransitionType) 1, 63},
+    {nullptr, nullptr, nullptr, 0, 0, 0, -1, (TransitionType) 0, -1}
+};
+
+const ParserState states [] = 
+{
+    {0, 3, &transitions[0], nullptr},
+    {1, 5, &transitions[3], nullptr},
+    {2, 3, &transitions[8], nullptr},
+    {3, 6, &transitions[11], &transitions[11]},
+    {4, 3, &transitions[17], nullptr},
+    {5, 3, &transitions[20], nullptr},
+    {6, 3, &transitions[23], nullptr},
+    {7, 3, &transitions[26], nullptr},
+    {8, 5, &transitions[29], nullptr},
+    {9, 6, &transitions[34], nullptr},
+    {10, 6, &transitions[40], nullptr},
+    {11, 6, &transitions[46], nullptr},
+    {12, 6, &transitions[52], nullptr},
+    {13, 6, &transitions[58], &transitions[58]},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int transition_table [] = 
+{
+    -1, -1, -1, -1, -1, -1, -1, 0, 1, -1, 2,
+    -1, 3, -1, 4, 5, 6, 7, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, 8, 9, -1, 10,
+    -1, 11, -1, 12, 13, 14, 15, -1, -1, 16, -1,
+    -1, -1, -1, -1, -1, -1, -1, 17, 18, -1, 19,
+    -1, -1, -1, -1, -1, -1, -1, 20, 21, -1, 22,
+    -1, -1, -1, -1, -1, -1, -1, 23, 24, -1, 25,
+    -1, -1, -1, -1, -1, -1, -1, 26, 27, -1, 28,
+    -1, -1, -1, 29, 30, 31, 32, -1, -1, 33, -1,
+    -1, 34, -1, 35, 36, 37, 38, -1, -1, 39, -1,
+    -1, 40, -1, 41, 42, 43, 44, -1, -1, 45, -1,
+    -1, 46, -1, 47, 48, 49, 50, -1, -1, 51, -1,
+    -1, 52, -1, 53, 54, 55, 56, -1, -1, 57, -1,
+    -1, 58, -1, 59, 60, 61, 62, -1, -1, 63, -1,
+    -1
+};
+
+const LexerAction lexer_actions [] = 
+{
+    {-1, nullptr}
+};
+
+const LexerTransition lexer_transitions [] = 
+{
+    {40, 41, &lexer_states[1], nullptr},
+    {41, 42, &lexer_states[2], nullptr},
+    {42, 43, &lexer_states[3], nullptr},
+    {43, 44, &lexer_states[4], nullptr},
+    {45, 46, &lexer_states[5], nullptr},
+    {46, 47, &lexer_states[6], nullptr},
+    {47, 48, &lexer_states[7], nullptr},
+    {48, 58, &lexer_states[8], nullptr},
+    {101, 102, &lexer_states[9], nullptr},
+    {48, 58, &lexer_states[8], nullptr},
+    {114, 115, &lexer_states[10], nullptr},
+    {114, 115, &lexer_states[11], nullptr},
+    {111, 112, &lexer_states[12], nullptr},
+    {114, 115, &lexer_states[13], nullptr},
+    {-1, -1, nullptr, nullptr}
+};
+
+const LexerState lexer_states [] = 
+{
+    {0, 8, &lexer_transitions[0], nullptr},
+    {1, 0, &lexer_transitions[8], &symbols[8]},
+    {2, 0, &lexer_transitions[8], &symbols[9]},
+    {3, 0, &lexer_transitions[8], &symbols[5]},
+    {4, 0, &lexer_transitions[8], &symbols[3]},
+    {5, 0, &lexer_transitions[8], &symbols[4]},
+    {6, 1, &lexer_transitions[8], nullptr},
+    {7, 0, &lexer_transitions[9], &symbols[6]},
+    {8, 1, &lexer_transitions[9], &symbols[10]},
+    {9, 1, &lexer_transitions[10], nullptr},
+    {10, 1, &lexer_transitions[11], nullptr},
+    {11, 1, &lexer_transitions[12], nullptr},
+    {12, 1, &lexer_transitions[13], nullptr},
+    {13, 0, &lexer_transitions[14], &symbols[2]},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int lexer_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 5, 6, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int lexer_class_transitions [] = 
+{
+    -1, 0, 1, 2, 3, 4, 5, 6, 7, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 8, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, 9, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 11,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 12, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 13,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1
+};
+
+const int lexer_loop_ranges [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    48, 58, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1
+};
+
+const LexerStateMachine lexer_state_machine = 
+{
+    0, // #actions
+    14, // #transitions
+    14, // #states
+    lexer_actions, // actions
+    lexer_transitions, // transitions
+    lexer_states, // states
+    &lexer_states[0], // start state
+    12, // #classes
+    lexer_classes, // classes
+    lexer_class_transitions, // class transitions
+    lexer_loop_ranges, // loop ranges
+    nullptr // whitespace symbol
+};
+
+const LexerAction whitespace_lexer_actions [] = 
+{
+    {0, "line_comment"},
+    {-1, nullptr}
+};
+
+const LexerTransition whitespace_lexer_transitions [] = 
+{
+    {9, 11, &whitespace_lexer_states[0], nullptr},
+    {13, 14, &whitespace_lexer_states[0], nullptr},
+    {32, 33, &whitespace_lexer_states[0], nullptr},
+    {35, 36, &whitespace_lexer_states[1], nullptr},
+    {0, 2147483647, &whitespace_lexer_states[0], &whitespace_lexer_actions[0]},
+    {-1, -1, nullptr, nullptr}
+};
+
+const LexerState whitespace_lexer_states [] = 
+{
+    {0, 4, &whitespace_lexer_transitions[0], nullptr},
+    {1, 1, &whitespace_lexer_transitions[4], nullptr},
+    {-1, 0, nullptr, nullptr}
+};
+
+const int whitespace_lexer_classes [] = 
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int whitespace_lexer_class_transitions [] = 
+{
+    -1, 0, 3,
+    4, 4, 4,
+    -1
+};
+
+const int whitespace_lexer_loop_ranges [] = 
+{
+    9, 11, 13, 14, 32, 33, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    -1
+};
+
+const LexerStateMachine whitespace_lexer_state_machine = 
+{
+    1, // #actions
+    5, // #transitions
+    2, // #states
+    whitespace_lexer_actions, // actions
+    whitespace_lexer_transitions, // transitions
+    whitespace_lexer_states, // states
+    &whitespace_lexer_states[0], // start state
+    3, // #classes
+    whitespace_lexer_classes, // classes
+    whitespace_lexer_class_transitions, // class transitions
+    whitespace_lexer_loop_ranges, // loop ranges
+    nullptr // whitespace symbol
+};
+
+const ParserStateMachine parser_state_machine = 
+{
+    "calculator",
+    6, // #actions
+    11, // #symbols
+    64, // #transitions
+    14, // #states
+    actions,
+    symbols,
+    transitions,
+    states,
+    &symbols[0], // start symbol
+    &symbols[1], // end symbol
+    &symbols[2], // error symbol
+    &states[0], // start state
+    &lexer_state_machine, // lexer state machine
+    &whitespace_lexer_state_machine, // whitespace lexer state machine
+    transition_table, // transition table
+    0, // #compressed
+    nullptr, // compressed base
+    nullptr, // compressed check
+    nullptr, // compressed next
+    nullptr, // default transitions
+};
+
+}
+
+const ParserStateMachine* calculator_parser_state_machine = &parser_state_machine;
+
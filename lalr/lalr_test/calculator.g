@@ -0,0 +1,15 @@
+calculator {
+   %left '+' '-';
+   %left '*' '/';
+   %none integer;
+   %whitespace "([ \t\r\n]|#:line_comment:)*";
+   expr:
+      expr '+' expr [add] |
+      expr '-' expr [subtract] |
+      expr '*' expr [multiply] |
+      expr '/' expr [divide] |
+      '(' expr ')' [compound] |
+      integer [integer]
+   ;
+   integer: "[0-9]+";
+}
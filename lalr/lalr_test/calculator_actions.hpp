@@ -0,0 +1,46 @@
+
+#ifndef LALR_CALCULATOR_ACTIONS_HPP_INCLUDED
+#define LALR_CALCULATOR_ACTIONS_HPP_INCLUDED
+
+#include <type_traits>
+
+namespace lalr
+{
+
+class ParserStateMachine;
+
+}
+
+extern const lalr::ParserStateMachine* calculator_parser_state_machine;
+
+namespace calculator_actions
+{
+
+enum ParserActionIndex
+{
+    action_add = 0,
+    action_subtract = 1,
+    action_multiply = 2,
+    action_divide = 3,
+    action_compound = 4,
+    action_integer = 5,
+    action_count = 6
+};
+
+template <class Parser, class Handlers>
+void bind_action_handlers( Parser* parser, Handlers* handlers )
+{
+    typedef typename Parser::ParserNode ParserNode;
+    typedef typename std::remove_reference<decltype(parser->user_data())>::type UserData;
+    parser->set_action_handler( action_add, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->add( start, finish ); }, handlers );
+    parser->set_action_handler( action_subtract, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->subtract( start, finish ); }, handlers );
+    parser->set_action_handler( action_multiply, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->multiply( start, finish ); }, handlers );
+    parser->set_action_handler( action_divide, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->divide( start, finish ); }, handlers );
+    parser->set_action_handler( action_compound, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->compound( start, finish ); }, handlers );
+    parser->set_action_handler( action_integer, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->integer( start, finish ); }, handlers );
+    parser->set_lexer_action_handler( "line_comment", [](void* context, auto* begin, auto end, auto* lexeme, const void** symbol) { static_cast<Handlers*>(context)->line_comment( begin, end, lexeme, symbol ); }, handlers );
+}
+
+}
+
+#endif
@@ -0,0 +1,38 @@
+
+#ifndef LALR_CALCULATOR_TABLES_HPP_INCLUDED
+#define LALR_CALCULATOR_TABLES_HPP_INCLUDED
+
+namespace lalr
+{
+
+class ParserStateMachine;
+
+}
+
+extern const lalr::ParserStateMachine* calculator_parser_state_machine;
+
+struct calculator_parser_tables
+{
+    static constexpr int states_size = 14;
+    static constexpr int symbols_size = 11;
+    static constexpr int transitions_size = 64;
+    static constexpr int transition_table [states_size * symbols_size] = 
+    {
+        -1, -1, -1, -1, -1, -1, -1, 0, 1, -1, 2,
+        -1, 3, -1, 4, 5, 6, 7, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, 8, 9, -1, 10,
+        -1, 11, -1, 12, 13, 14, 15, -1, -1, 16, -1,
+        -1, -1, -1, -1, -1, -1, -1, 17, 18, -1, 19,
+        -1, -1, -1, -1, -1, -1, -1, 20, 21, -1, 22,
+        -1, -1, -1, -1, -1, -1, -1, 23, 24, -1, 25,
+        -1, -1, -1, -1, -1, -1, -1, 26, 27, -1, 28,
+        -1, -1, -1, 29, 30, 31, 32, -1, -1, 33, -1,
+        -1, 34, -1, 35, 36, 37, 38, -1, -1, 39, -1,
+        -1, 40, -1, 41, 42, 43, 44, -1, -1, 45, -1,
+        -1, 46, -1, 47, 48, 49, 50, -1, -1, 51, -1,
+        -1, 52, -1, 53, 54, 55, 56, -1, -1, 57, -1,
+        -1, 58, -1, 59, 60, 61, 62, -1, -1, 63, -1,
+    };
+};
+
+#endif
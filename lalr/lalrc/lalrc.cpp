@@ -14,8 +14,11 @@
 #include <lalr/LexerState.hpp>
 #include <lalr/LexerTransition.hpp>
 #include <lalr/LexerAction.hpp>
+#include <lalr/ParserStateMachineFile.hpp>
+#include <algorithm>
 #include <string>
 #include <vector>
+#include <ctype.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <errno.h>
@@ -27,14 +30,24 @@ using namespace lalr;
 
 static void print_cxx_parser_state_machine( const ParserStateMachine* state_machine, FILE* file );
 static void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine, FILE* file );
-static void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* lexer_state_machine, const char* prefix );
+static void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* lexer_state_machine, const ParserStateMachine* parser_state_machine, const char* prefix );
+static void generate_cxx_int_array( FILE* file, const char* identifier, const int* values, int values_size );
+static void generate_cxx_action_handlers( const ParserStateMachine* state_machine, FILE* file );
+static void generate_cxx_constexpr_tables( const ParserStateMachine* state_machine, FILE* file );
+static void generate_cxx_lexer_action_handlers( const LexerStateMachine* lexer_state_machine, vector<string>* identifiers, FILE* file );
 
 int main( int argc, char** argv )
 {
     string input;
     string output;
+    string actions;
+    string tables;
     bool print = false;
+    bool compress = false;
+    bool fuse_whitespace = false;
+    bool binary = false;
     bool help = false;
+    bool unknown = false;
     bool version = false;
 
     int argi = 1;
@@ -50,11 +63,36 @@ int main( int argc, char** argv )
             output = argv[argi + 1];
             argi += 2;
         }
+        else if ( strcmp(argv[argi], "-a") == 0 || strcmp(argv[argi], "--actions") == 0 )
+        {
+            actions = argv[argi + 1];
+            argi += 2;
+        }
+        else if ( strcmp(argv[argi], "-t") == 0 || strcmp(argv[argi], "--tables") == 0 )
+        {
+            tables = argv[argi + 1];
+            argi += 2;
+        }
         else if ( strcmp(argv[argi], "-p") == 0 || strcmp(argv[argi], "--print") == 0 )
         {
             print = true;
             argi += 1;
         }
+        else if ( strcmp(argv[argi], "-c") == 0 || strcmp(argv[argi], "--compress") == 0 )
+        {
+            compress = true;
+            argi += 1;
+        }
+        else if ( strcmp(argv[argi], "-w") == 0 || strcmp(argv[argi], "--fuse-whitespace") == 0 )
+        {
+            fuse_whitespace = true;
+            argi += 1;
+        }
+        else if ( strcmp(argv[argi], "-b") == 0 || strcmp(argv[argi], "--binary") == 0 )
+        {
+            binary = true;
+            argi += 1;
+        }
         else if ( strcmp(argv[argi], "-h") == 0 || strcmp(argv[argi], "--help") == 0 )
         {
             help = true;
@@ -65,6 +103,12 @@ int main( int argc, char** argv )
             version = true;
             argi += 1;
         }
+        else
+        {
+            fprintf( stderr, "Unknown option '%s'\n", argv[argi] );
+            unknown = true;
+            argi += 1;
+        }
     }
 
     if ( version )
@@ -73,15 +117,20 @@ int main( int argc, char** argv )
         printf( "Copyright (c) Charles Baker. All rights reserved.\n" );
     }
 
-    if ( help || input.empty() )
+    if ( help || unknown || input.empty() || (binary && output.empty()) )
     {
         printf( "lalrc [options] [-o|--output OUTPUT] INPUT\n" );
         printf( "-h|--help     Display this help message\n" );
         printf( "-v|--version  Display version\n" );
         printf( "-p|--print    Print parser state machine\n" );
+        printf( "-c|--compress Generate a compressed parser transition table\n" );
+        printf( "-w|--fuse-whitespace Match whitespace in the lexer state machine\n" );
+        printf( "-b|--binary   Write a compiled state machine file rather than C++\n" );
+        printf( "-a|--actions  Write a C++ header that binds handler methods to actions\n" );
+        printf( "-t|--tables   Write a C++ header with constexpr parser tables\n" );
         printf( "-o|--output   Output file\n" );
         printf( "\n" );
-        return help ? EXIT_SUCCESS : EXIT_FAILURE;
+        return help && !unknown ? EXIT_SUCCESS : EXIT_FAILURE;
     }
 
     if ( !input.empty() )
@@ -114,9 +163,47 @@ int main( int argc, char** argv )
         }
 
         GrammarCompiler compiler;
+        compiler.set_compressed( compress );
+        compiler.set_fused_whitespace( fuse_whitespace );
         compiler.compile( &grammar_source[0], &grammar_source[0] + grammar_source.size() );
         const ParserStateMachine* state_machine = compiler.parser_state_machine();
 
+        if ( !actions.empty() )
+        {
+            file = fopen( actions.c_str(), "wb" );
+            if ( !file )
+            {
+                fprintf( stderr, "Opening '%s' to write action handlers failed - errno=%d\n", actions.c_str(), errno );
+                return EXIT_FAILURE;
+            }
+            generate_cxx_action_handlers( state_machine, file );
+            fclose( file );
+            file = nullptr;
+        }
+
+        if ( !tables.empty() )
+        {
+            file = fopen( tables.c_str(), "wb" );
+            if ( !file )
+            {
+                fprintf( stderr, "Opening '%s' to write constexpr tables failed - errno=%d\n", tables.c_str(), errno );
+                return EXIT_FAILURE;
+            }
+            generate_cxx_constexpr_tables( state_machine, file );
+            fclose( file );
+            file = nullptr;
+        }
+
+        if ( binary )
+        {
+            if ( !ParserStateMachineFile::save(state_machine, output.c_str()) )
+            {
+                fprintf( stderr, "Writing parser state machine to '%s' failed - errno=%d\n", output.c_str(), errno );
+                return EXIT_FAILURE;
+            }
+            return EXIT_SUCCESS;
+        }
+
         if ( !output.empty() )
         {
             file = fopen( output.c_str(), "wb" );
@@ -244,30 +331,32 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine,
     {
         if ( transition->reduced_symbol )
         {
-            fprintf( file, "    {&symbols[%d], nullptr, &symbols[%d], %d, %d, %d, (TransitionType) %d, %d},\n",
+            fprintf( file, "    {&symbols[%d], nullptr, &symbols[%d], %d, %d, %d, %d, (TransitionType) %d, %d},\n",
                 transition->symbol ? transition->symbol->index : -1,
                 transition->reduced_symbol->index,
                 transition->reduced_length,
                 transition->precedence,
                 transition->action,
+                transition->production,
                 transition->type,
                 transition->index
             );
         }
         else
         {
-            fprintf( file, "    {&symbols[%d], &states[%d], nullptr, %d, %d, %d, (TransitionType) %d, %d},\n",
+            fprintf( file, "    {&symbols[%d], &states[%d], nullptr, %d, %d, %d, %d, (TransitionType) %d, %d},\n",
                 transition->symbol ? transition->symbol->index : -1,
                 transition->state ? transition->state->index : -1,
                 transition->reduced_length,
                 transition->precedence,
                 transition->action,
+                transition->production,
                 transition->type,
                 transition->index
             );
         }
     }
-    fprintf( file, "    {nullptr, nullptr, nullptr, 0, 0, 0, (TransitionType) 0, -1}\n" );
+    fprintf( file, "    {nullptr, nullptr, nullptr, 0, 0, 0, -1, (TransitionType) 0, -1}\n" );
     fprintf( file, "};\n" );
     fprintf( file, "\n" );
 
@@ -277,18 +366,60 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine,
     const ParserState* states_end = states + state_machine->states_size;
     for ( const ParserState* state = states; state != states_end; ++state )
     {
-        fprintf( file, "    {%d, %d, &transitions[%d]},\n",
-            state->index,
-            state->length,
-            state->transitions->index 
-        );
+        if ( state->default_reduction )
+        {
+            fprintf( file, "    {%d, %d, &transitions[%d], &transitions[%d]},\n",
+                state->index,
+                state->length,
+                state->transitions->index,
+                state->default_reduction->index
+            );
+        }
+        else
+        {
+            fprintf( file, "    {%d, %d, &transitions[%d], nullptr},\n",
+                state->index,
+                state->length,
+                state->transitions->index 
+            );
+        }
     }
-    fprintf( file, "    {-1, 0, nullptr}\n" );
+    fprintf( file, "    {-1, 0, nullptr, nullptr}\n" );
     fprintf( file, "};\n" );
     fprintf( file, "\n" );
 
-    generate_cxx_lexer_state_machine( file, state_machine->lexer_state_machine, "lexer" );
-    generate_cxx_lexer_state_machine( file, state_machine->whitespace_lexer_state_machine, "whitespace_lexer" );
+    if ( state_machine->transition_table )
+    {
+        fprintf( file, "const int transition_table [] = \n" );
+        fprintf( file, "{\n" );
+        const int* transition_table = state_machine->transition_table;
+        for ( int state = 0; state < state_machine->states_size; ++state )
+        {
+            fprintf( file, "   " );
+            for ( int i = 0; i < state_machine->symbols_size; ++i )
+            {
+                fprintf( file, " %d,", transition_table[state * state_machine->symbols_size + i] );
+            }
+            fprintf( file, "\n" );
+        }
+        fprintf( file, "    -1\n" );
+        fprintf( file, "};\n" );
+        fprintf( file, "\n" );
+    }
+
+    if ( state_machine->compressed_base )
+    {
+        generate_cxx_int_array( file, "compressed_base", state_machine->compressed_base, state_machine->states_size );
+        generate_cxx_int_array( file, "compressed_check", state_machine->compressed_check, state_machine->compressed_size );
+        generate_cxx_int_array( file, "compressed_next", state_machine->compressed_next, state_machine->compressed_size );
+        generate_cxx_int_array( file, "default_transitions", state_machine->default_transitions, state_machine->states_size );
+    }
+
+    generate_cxx_lexer_state_machine( file, state_machine->lexer_state_machine, state_machine, "lexer" );
+    if ( state_machine->whitespace_lexer_state_machine )
+    {
+        generate_cxx_lexer_state_machine( file, state_machine->whitespace_lexer_state_machine, state_machine, "whitespace_lexer" );
+    }
 
     fprintf( file, "const ParserStateMachine parser_state_machine = \n" );
     fprintf( file, "{\n" );
@@ -306,7 +437,24 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine,
     fprintf( file, "    &symbols[%d], // error symbol\n", state_machine->error_symbol->index );
     fprintf( file, "    &states[%d], // start state\n", state_machine->start_state->index );
     fprintf( file, "    &lexer_state_machine, // lexer state machine\n" );
-    fprintf( file, "    &whitespace_lexer_state_machine // whitespace lexer state machine\n" );
+    fprintf( file, "    %s, // whitespace lexer state machine\n", state_machine->whitespace_lexer_state_machine ? "&whitespace_lexer_state_machine" : "nullptr" );
+    fprintf( file, "    %s, // transition table\n", state_machine->transition_table ? "transition_table" : "nullptr" );
+    if ( state_machine->compressed_base )
+    {
+        fprintf( file, "    %d, // #compressed\n", state_machine->compressed_size );
+        fprintf( file, "    compressed_base, // compressed base\n" );
+        fprintf( file, "    compressed_check, // compressed check\n" );
+        fprintf( file, "    compressed_next, // compressed next\n" );
+        fprintf( file, "    default_transitions, // default transitions\n" );
+    }
+    else
+    {
+        fprintf( file, "    0, // #compressed\n" );
+        fprintf( file, "    nullptr, // compressed base\n" );
+        fprintf( file, "    nullptr, // compressed check\n" );
+        fprintf( file, "    nullptr, // compressed next\n" );
+        fprintf( file, "    nullptr, // default transitions\n" );
+    }
     fprintf( file, "};\n" );
 
     fprintf( file, "\n" );
@@ -317,7 +465,7 @@ void generate_cxx_parser_state_machine( const ParserStateMachine* state_machine,
     fprintf( file, "\n" );
 }
 
-void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* state_machine, const char* prefix )
+void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* state_machine, const ParserStateMachine* parser_state_machine, const char* prefix )
 {
     fprintf( file, "const LexerAction %s_actions [] = \n", prefix );
     fprintf( file, "{\n" );
@@ -374,7 +522,7 @@ void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* stat
         const ParserSymbol* symbol = reinterpret_cast<const ParserSymbol*>( state->symbol );
         if ( symbol )
         {
-            fprintf( file, "&symbols[%d]},\n", symbol->index );
+            fprintf( file, "&symbols[%d]},\n", int(symbol - parser_state_machine->symbols) );
         }
         else
         {
@@ -385,6 +533,58 @@ void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* stat
     fprintf( file, "};\n" );
     fprintf( file, "\n" );
 
+    if ( state_machine->classes )
+    {
+        fprintf( file, "const int %s_classes [] = \n", prefix );
+        fprintf( file, "{\n" );
+        for ( int character = 0; character < LEXER_CLASS_CHARACTERS; character += 16 )
+        {
+            fprintf( file, "   " );
+            for ( int i = character; i < character + 16; ++i )
+            {
+                fprintf( file, " %d,", state_machine->classes[i] );
+            }
+            fprintf( file, "\n" );
+        }
+        fprintf( file, "};\n" );
+        fprintf( file, "\n" );
+
+        fprintf( file, "const int %s_class_transitions [] = \n", prefix );
+        fprintf( file, "{\n" );
+        const int* class_transitions = state_machine->class_transitions;
+        for ( int state = 0; state < state_machine->states_size; ++state )
+        {
+            fprintf( file, "   " );
+            for ( int i = 0; i < state_machine->classes_size; ++i )
+            {
+                fprintf( file, " %d,", class_transitions[state * state_machine->classes_size + i] );
+            }
+            fprintf( file, "\n" );
+        }
+        fprintf( file, "    -1\n" );
+        fprintf( file, "};\n" );
+        fprintf( file, "\n" );
+    }
+
+    if ( state_machine->loop_ranges )
+    {
+        fprintf( file, "const int %s_loop_ranges [] = \n", prefix );
+        fprintf( file, "{\n" );
+        const int* loop_ranges = state_machine->loop_ranges;
+        for ( int state = 0; state < state_machine->states_size; ++state )
+        {
+            fprintf( file, "   " );
+            for ( int i = 0; i < LEXER_LOOP_RANGES * 2; ++i )
+            {
+                fprintf( file, " %d,", loop_ranges[state * LEXER_LOOP_RANGES * 2 + i] );
+            }
+            fprintf( file, "\n" );
+        }
+        fprintf( file, "    -1\n" );
+        fprintf( file, "};\n" );
+        fprintf( file, "\n" );
+    }
+
     fprintf( file, "const LexerStateMachine %s_state_machine = \n", prefix );
     fprintf( file, "{\n" );
     fprintf( file, "    %d, // #actions\n", state_machine->actions_size );
@@ -393,7 +593,207 @@ void generate_cxx_lexer_state_machine( FILE* file, const LexerStateMachine* stat
     fprintf( file, "    %s_actions, // actions\n", prefix );
     fprintf( file, "    %s_transitions, // transitions\n", prefix );
     fprintf( file, "    %s_states, // states\n", prefix );
-    fprintf( file, "    &%s_states[%d] // start state\n", prefix, state_machine->start_state->index );
+    fprintf( file, "    &%s_states[%d], // start state\n", prefix, state_machine->start_state->index );
+    if ( state_machine->classes )
+    {
+        fprintf( file, "    %d, // #classes\n", state_machine->classes_size );
+        fprintf( file, "    %s_classes, // classes\n", prefix );
+        fprintf( file, "    %s_class_transitions, // class transitions\n", prefix );
+    }
+    else
+    {
+        fprintf( file, "    0, // #classes\n" );
+        fprintf( file, "    nullptr, // classes\n" );
+        fprintf( file, "    nullptr, // class transitions\n" );
+    }
+    if ( state_machine->loop_ranges )
+    {
+        fprintf( file, "    %s_loop_ranges, // loop ranges\n", prefix );
+    }
+    else
+    {
+        fprintf( file, "    nullptr, // loop ranges\n" );
+    }
+    if ( state_machine->whitespace_symbol )
+    {
+        const ParserSymbol* whitespace_symbol = reinterpret_cast<const ParserSymbol*>( state_machine->whitespace_symbol );
+        fprintf( file, "    &symbols[%d] // whitespace symbol\n", int(whitespace_symbol - parser_state_machine->symbols) );
+    }
+    else
+    {
+        fprintf( file, "    nullptr // whitespace symbol\n" );
+    }
     fprintf( file, "};\n" );
     fprintf( file, "\n" );
 }
+
+void generate_cxx_int_array( FILE* file, const char* identifier, const int* values, int values_size )
+{
+    const int VALUES_PER_LINE = 16;
+    fprintf( file, "const int %s [] = \n", identifier );
+    fprintf( file, "{\n" );
+    for ( int i = 0; i < values_size; i += VALUES_PER_LINE )
+    {
+        fprintf( file, "   " );
+        for ( int j = i; j < values_size && j < i + VALUES_PER_LINE; ++j )
+        {
+            fprintf( file, " %d,", values[j] );
+        }
+        fprintf( file, "\n" );
+    }
+    fprintf( file, "    -1\n" );
+    fprintf( file, "};\n" );
+    fprintf( file, "\n" );
+}
+
+void generate_cxx_action_handlers( const ParserStateMachine* state_machine, FILE* file )
+{
+    const char* identifier = state_machine->identifier;
+    string guard = identifier;
+    for ( string::iterator i = guard.begin(); i != guard.end(); ++i )
+    {
+        *i = char( toupper(*i) );
+    }
+
+    fprintf( file, "\n" );
+    fprintf( file, "#ifndef LALR_%s_ACTIONS_HPP_INCLUDED\n", guard.c_str() );
+    fprintf( file, "#define LALR_%s_ACTIONS_HPP_INCLUDED\n", guard.c_str() );
+    fprintf( file, "\n" );
+    fprintf( file, "#include <type_traits>\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "namespace lalr\n" );
+    fprintf( file, "{\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "class ParserStateMachine;\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "}\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "extern const lalr::ParserStateMachine* %s_parser_state_machine;\n", identifier );
+    fprintf( file, "\n" );
+    fprintf( file, "namespace %s_actions\n", identifier );
+    fprintf( file, "{\n" );
+    fprintf( file, "\n" );
+
+    const ParserAction* actions = state_machine->actions;
+    const ParserAction* actions_end = actions + state_machine->actions_size;
+    fprintf( file, "enum ParserActionIndex\n" );
+    fprintf( file, "{\n" );
+    for ( const ParserAction* action = actions; action != actions_end; ++action )
+    {
+        fprintf( file, "    action_%s = %d,\n", action->identifier, action->index );
+    }
+    fprintf( file, "    action_count = %d\n", state_machine->actions_size );
+    fprintf( file, "};\n" );
+    fprintf( file, "\n" );
+
+    // Each action is bound to the method of the same name on Handlers by a
+    // captureless lambda that converts to the plain function pointer that 
+    // the parser calls directly; the call to the method can be inlined.
+    fprintf( file, "template <class Parser, class Handlers>\n" );
+    fprintf( file, "void bind_action_handlers( Parser* parser, Handlers* handlers )\n" );
+    fprintf( file, "{\n" );
+    fprintf( file, "    typedef typename Parser::ParserNode ParserNode;\n" );
+    fprintf( file, "    typedef typename std::remove_reference<decltype(parser->user_data())>::type UserData;\n" );
+    for ( const ParserAction* action = actions; action != actions_end; ++action )
+    {
+        fprintf( file, "    parser->set_action_handler( action_%s, [](void* context, ParserNode* start, ParserNode* finish) -> UserData { return static_cast<Handlers*>(context)->%s( start, finish ); }, handlers );\n", 
+            action->identifier,
+            action->identifier
+        );
+    }
+
+    vector<string> identifiers;
+    generate_cxx_lexer_action_handlers( state_machine->lexer_state_machine, &identifiers, file );
+    if ( state_machine->whitespace_lexer_state_machine )
+    {
+        generate_cxx_lexer_action_handlers( state_machine->whitespace_lexer_state_machine, &identifiers, file );
+    }
+    fprintf( file, "}\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "}\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "#endif\n" );
+}
+
+void generate_cxx_constexpr_tables( const ParserStateMachine* state_machine, FILE* file )
+{
+    const char* identifier = state_machine->identifier;
+    string guard = identifier;
+    for ( string::iterator i = guard.begin(); i != guard.end(); ++i )
+    {
+        *i = char( toupper(*i) );
+    }
+
+    fprintf( file, "\n" );
+    fprintf( file, "#ifndef LALR_%s_TABLES_HPP_INCLUDED\n", guard.c_str() );
+    fprintf( file, "#define LALR_%s_TABLES_HPP_INCLUDED\n", guard.c_str() );
+    fprintf( file, "\n" );
+    fprintf( file, "namespace lalr\n" );
+    fprintf( file, "{\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "class ParserStateMachine;\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "}\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "extern const lalr::ParserStateMachine* %s_parser_state_machine;\n", identifier );
+    fprintf( file, "\n" );
+
+    // The dense table is always generated from the transitions of each 
+    // state so that it is available whether or not the state machine was
+    // compiled with a dense or compressed table of its own.
+    int states_size = state_machine->states_size;
+    int symbols_size = state_machine->symbols_size;
+    vector<int> transition_table( states_size * symbols_size, -1 );
+    const ParserState* states = state_machine->states;
+    const ParserState* states_end = states + states_size;
+    for ( const ParserState* state = states; state != states_end; ++state )
+    {
+        const ParserTransition* transitions = state->transitions;
+        const ParserTransition* transitions_end = transitions + state->length;
+        for ( const ParserTransition* transition = transitions; transition != transitions_end; ++transition )
+        {
+            transition_table[state->index * symbols_size + transition->symbol->index] = transition->index;
+        }
+    }
+
+    fprintf( file, "struct %s_parser_tables\n", identifier );
+    fprintf( file, "{\n" );
+    fprintf( file, "    static constexpr int states_size = %d;\n", states_size );
+    fprintf( file, "    static constexpr int symbols_size = %d;\n", symbols_size );
+    fprintf( file, "    static constexpr int transitions_size = %d;\n", state_machine->transitions_size );
+    fprintf( file, "    static constexpr int transition_table [states_size * symbols_size] = \n" );
+    fprintf( file, "    {\n" );
+    for ( int state = 0; state < states_size; ++state )
+    {
+        fprintf( file, "       " );
+        for ( int i = 0; i < symbols_size; ++i )
+        {
+            fprintf( file, " %d,", transition_table[state * symbols_size + i] );
+        }
+        fprintf( file, "\n" );
+    }
+    fprintf( file, "    };\n" );
+    fprintf( file, "};\n" );
+    fprintf( file, "\n" );
+    fprintf( file, "#endif\n" );
+}
+
+void generate_cxx_lexer_action_handlers( const LexerStateMachine* lexer_state_machine, vector<string>* identifiers, FILE* file )
+{
+    if ( lexer_state_machine )
+    {
+        const LexerAction* actions = lexer_state_machine->actions;
+        const LexerAction* actions_end = actions + lexer_state_machine->actions_size;
+        for ( const LexerAction* action = actions; action != actions_end; ++action )
+        {
+            if ( std::find(identifiers->begin(), identifiers->end(), action->identifier) == identifiers->end() )
+            {
+                identifiers->push_back( action->identifier );
+                fprintf( file, "    parser->set_lexer_action_handler( \"%s\", [](void* context, auto* begin, auto end, auto* lexeme, const void** symbol) { static_cast<Handlers*>(context)->%s( begin, end, lexeme, symbol ); }, handlers );\n", 
+                    action->identifier,
+                    action->identifier
+                );
+            }
+        }
+    }
+}